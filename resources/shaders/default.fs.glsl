@@ -7,8 +7,34 @@
 	precision mediump float;
 #endif
 
-const int MAX_LIGHT_SOURCES = 13;
-const int MAX_TEXTURES      = 6;
+const int MAX_LIGHT_SOURCES   = 13;
+const int MAX_SHADOW_CASCADES = 4;
+const int MAX_TEXTURES        = 6;
+
+// SHADER PERMUTATIONS (ShaderFeature) - OPENGL INJECTS #defines, VULKAN SETS SPECIALIZATION CONSTANTS.
+// THE DEFAULTS ENABLE EVERYTHING AND FALL BACK TO THE UNIFORM FLAGS, A VARIANT COMPILES THE UNUSED PATHS OUT.
+#if defined VULKAN
+	layout(constant_id = 0) const int FEATURES    = 0x3FF;
+	layout(constant_id = 1) const int LIGHT_COUNT = MAX_LIGHT_SOURCES;
+#elif !defined FEATURES
+	#define FEATURES    0x3FF
+	#define LIGHT_COUNT MAX_LIGHT_SOURCES
+#endif
+
+const int FEATURE_CLIPPING          = 0x001;
+const int FEATURE_DIFFUSE_MAP       = 0x002;
+const int FEATURE_SPECULAR_MAP      = 0x004;
+const int FEATURE_SRGB              = 0x008;
+const int FEATURE_TERRAIN           = 0x010;
+const int FEATURE_WATER             = 0x020;
+const int FEATURE_LIGHT_DIRECTIONAL = 0x040;
+const int FEATURE_LIGHT_POINT       = 0x080;
+const int FEATURE_LIGHT_SPOT        = 0x100;
+const int FEATURE_LIGHT_CLUSTERED   = 0x200;
+
+// CLUSTERED LIGHTS (LightCluster) - 32-BIT WORDS IN THE RGBA8 DATA TEXTURE OF THE LAST MESH TEXTURE SLOT
+const int CLUSTER_LIGHT_WORDS = 24;
+const int CLUSTER_TEXTURE     = 5;
 
 struct CBLight
 {
@@ -48,6 +74,16 @@ layout(binding = 1) uniform DefaultBuffer
 	vec4 ComponentType;
     vec4 EnableSRGB;
 	vec4 WaterProps;
+
+	vec4 ClusterDepth;
+	vec4 ClusterGrid;
+	mat4 ClusterViewProjection;
+
+	vec4 ShadowCascadeLight;
+	vec4 ShadowCascadeBias;
+	vec4 ShadowCascadeDepth;
+	vec4 ShadowCascadeSplits;
+	mat4 ShadowCascadeViewProjections[MAX_SHADOW_CASCADES];
 } db;
 
 layout(binding = 2) uniform sampler2D        Textures[MAX_TEXTURES];
@@ -65,11 +101,16 @@ const vec3 ShadowPointSampleOffsets[NR_OF_POINT_OFFSETS] =
 	vec3(0, 1,  1), vec3( 0, -1,  1), vec3( 0, -1, -1), vec3( 0, 1, -1)
 };
 
+bool HasFeature(int feature)
+{
+	return ((FEATURES & feature) != 0);
+}
+
 bool ClipFragment()
 {
 	vec4 fp = FragmentPosition;
 
-	return ((db.EnableClipping.x > 0.1) && (
+	return (HasFeature(FEATURE_CLIPPING) && (db.EnableClipping.x > 0.1) && (
 		(fp.x > db.ClipMax.x) || (fp.y > db.ClipMax.y) || (fp.z > db.ClipMax.z) ||
 		(fp.x < db.ClipMin.x) || (fp.y < db.ClipMin.y) || (fp.z < db.ClipMin.z)
 	));
@@ -83,7 +124,7 @@ float GetAttenuationFactor(vec3 lightPosition, vec3 attenuation)
     float linearFactor    = (attenuation.y * distanceToLight);
 	
     // WITHOUT SRGB - LINEAR
-    if (db.EnableSRGB.x < 0.1)
+    if (!HasFeature(FEATURE_SRGB) || (db.EnableSRGB.x < 0.1))
         return (1.0f / (constantFactor + linearFactor + 0.0001));
 
     // WITH SRGB - QUADRATIC
@@ -106,7 +147,7 @@ vec2 GetTiledTexCoords(vec4 textureScale)
 // MESH DIFFUSE (COLOR)
 vec4 GetMaterialColor()
 {
-	if (db.IsTextured[0].x > 0.1)
+	if (HasFeature(FEATURE_DIFFUSE_MAP) && (db.IsTextured[0].x > 0.1))
 		return texture(Textures[0], GetTiledTexCoords(db.TextureScales[0]));
 
 	return db.MeshDiffuse;
@@ -115,7 +156,7 @@ vec4 GetMaterialColor()
 // MESH SPECULAR HIGHLIGHTS
 vec4 GetMaterialSpecular()
 {
-	if (db.IsTextured[1].x > 0.1)
+	if (HasFeature(FEATURE_SPECULAR_MAP) && (db.IsTextured[1].x > 0.1))
 		return texture(Textures[1], GetTiledTexCoords(db.TextureScales[1]));
 
 	return db.MeshSpecular;
@@ -168,7 +209,7 @@ vec4 GetMaterialColorWater(vec3 cameraView, out vec3 normal)
 }
 
 // Shadow - the impact of the light on the the fragment from the perspective of the directional/spot light
-float GetShadowFactor(int depthLayer, vec3 lightDirection, vec3 normal, vec4 positionLightSpace)
+float GetShadowFactor(int depthLayer, vec3 lightDirection, vec3 normal, vec4 positionLightSpace, float biasScale)
 {
 	// Convert shadow map UV and Depth coordinates
 	vec3 shadowMapCoordinates = vec3(positionLightSpace.xyz / positionLightSpace.w); // Perspective projection divide
@@ -191,7 +232,7 @@ float GetShadowFactor(int depthLayer, vec3 lightDirection, vec3 normal, vec4 pos
 	// SOLUTION: Offset depth.
 	const float MIN_OFFSET = 0.005;
 	const float MAX_OFFSET = 0.05;
-	float       offsetBias = max(MAX_OFFSET * (1.0 - dot(normal, lightDirection)), MIN_OFFSET);
+	float       offsetBias = (max(MAX_OFFSET * (1.0 - dot(normal, lightDirection)), MIN_OFFSET) * biasScale);
 	
 	// PCF - Percentage-Closer Filtering
 	// Produces softer shadows, making them appear less blocky or hard.
@@ -226,6 +267,21 @@ float GetShadowFactor(int depthLayer, vec3 lightDirection, vec3 normal, vec4 pos
 	return min(shadowFactor, MAX_INTENSITY);
 }
 
+// Cascaded shadow (ShadowCascades) - the first cascade that reaches the view depth of the fragment, -1 beyond the shadow distance
+int GetShadowCascade()
+{
+	float viewDepth = (dot(db.ShadowCascadeDepth.xyz, FragmentPosition.xyz) + db.ShadowCascadeDepth.w);
+	int   cascades  = int(db.ShadowCascadeLight.x);
+
+	for (int c = 0; c < cascades; c++)
+	{
+		if (viewDepth <= db.ShadowCascadeSplits[c])
+			return c;
+	}
+
+	return -1;
+}
+
 // Shadow - the impact of the light on the the fragment from the perspective of the point light
 float GetShadowFactorOmni(int depthLayer, vec3 lightPosition)
 {
@@ -296,9 +352,23 @@ vec4 GetDirectionalLight(int i, vec3 normal, vec3 cameraView, vec4 materialColor
     // Specular - reflects/mirrors the light direction over the normal
 	float specularFactor = GetSpecularFactor(lightDirection, normal, cameraView, materialSpec.a);
 	
-	// Shadow
-	vec4  positionLightSpace = (light.ViewProjection * vec4(FragmentPosition.xyz, 1.0));
-	float shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace));
+	// Shadow - the first directional light is cascaded, cascade 0 uses the layer of the light and the others the layers after the lights
+	float shadowFactor = 1.0;
+
+	if ((db.ShadowCascadeLight.x > 0.5) && (i == int(db.ShadowCascadeLight.y)))
+	{
+		int cascade = GetShadowCascade();
+
+		if (cascade >= 0) {
+			vec4 positionLightSpace = (db.ShadowCascadeViewProjections[cascade] * vec4(FragmentPosition.xyz, 1.0));
+			int  depthLayer         = (cascade > 0 ? (MAX_LIGHT_SOURCES + cascade - 1) : i);
+
+			shadowFactor = (1.0 - GetShadowFactor(depthLayer, lightDirection, normal, positionLightSpace, db.ShadowCascadeBias[cascade]));
+		}
+	} else {
+		vec4 positionLightSpace = (light.ViewProjection * vec4(FragmentPosition.xyz, 1.0));
+		shadowFactor            = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace, 1.0));
+	}
 
     // Combine the light calculations
     vec3 ambientFinal  = (light.Ambient.rgb  * materialColor.rgb);
@@ -358,7 +428,7 @@ vec4 GetSpotLight(int i, vec3 normal, vec3 cameraView, vec4 materialColor, vec4
 	
 	// Shadow
 	vec4  positionLightSpace = (light.ViewProjection * vec4(FragmentPosition.xyz, 1.0));
-	float shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace));
+	float shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace, 1.0));
 	
     // Combine the light calculations
     vec3 ambient  = (spotLightFactor * attenuationFactor * light.Ambient.rgb  * materialColor.rgb);
@@ -369,6 +439,81 @@ vec4 GetSpotLight(int i, vec3 normal, vec3 cameraView, vec4 materialColor, vec4
     return vec4((ambient + (shadowFactor * (diffuse + specular))), materialColor.a);
 }
 
+uint GetClusterWord(int word)
+{
+	int   width = textureSize(Textures[CLUSTER_TEXTURE], 0).x;
+	uvec4 bytes = uvec4(round(texelFetch(Textures[CLUSTER_TEXTURE], ivec2((word % width), (word / width)), 0) * 255.0));
+
+	return (bytes.r | (bytes.g << 8) | (bytes.b << 16) | (bytes.a << 24));
+}
+
+vec4 GetClusterVector(int word)
+{
+	return uintBitsToFloat(uvec4(GetClusterWord(word), GetClusterWord(word + 1), GetClusterWord(word + 2), GetClusterWord(word + 3)));
+}
+
+// Clustered point/spot light - no shadows, faded out towards the range it was clustered with
+vec3 GetClusteredLight(int index, vec3 normal, vec3 cameraView, vec4 materialColor, vec4 materialSpec)
+{
+	int  word     = (index * CLUSTER_LIGHT_WORDS);
+	vec4 position = GetClusterVector(word);			// { x, y, z, Range }
+	vec4 ambient  = GetClusterVector(word + 4);		// { r, g, b, Type<IconType> }
+	vec4 diffuse  = GetClusterVector(word + 8);		// { r, g, b, cos(InnerAngle) }
+	vec4 specular = GetClusterVector(word + 12);	// { r, g, b, cos(OuterAngle) }
+
+	CBLight light;
+	light.Angles    = vec4(diffuse.w, specular.w, 0.0, 0.0);
+	light.Direction = GetClusterVector(word + 16);
+
+	// Direction of the light from the fragment surface
+	vec3  lightVector    = (position.xyz - FragmentPosition.xyz);
+	vec3  lightDirection = normalize(lightVector);
+	float rangeFactor    = clamp((1.0 - pow((length(lightVector) / max(position.w, 0.0001)), 4.0)), 0.0, 1.0);
+
+	float diffuseFactor     = GetDiffuseFactor(normal, lightDirection);
+	float specularFactor    = GetSpecularFactor(lightDirection, normal, cameraView, materialSpec.a);
+	float attenuationFactor = (GetAttenuationFactor(position.xyz, GetClusterVector(word + 20).xyz) * rangeFactor * rangeFactor);
+
+	// ID_ICON_LIGHT_SPOT = 17
+	if (ambient.w > 16.9)
+		attenuationFactor *= GetSpotLightFactor(light, lightDirection);
+
+    vec3 ambientFinal  = (ambient.rgb  * materialColor.rgb);
+    vec3 diffuseFinal  = (diffuse.rgb  * materialColor.rgb * diffuseFactor);
+    vec3 specularFinal = (specular.rgb * materialSpec.rgb  * specularFactor);
+
+	return (attenuationFactor * (ambientFinal + diffuseFinal + specularFinal));
+}
+
+// Only the lights of the cluster (froxel) the fragment is in
+vec3 GetClusteredLights(vec3 normal, vec3 cameraView, vec4 materialColor, vec4 materialSpec)
+{
+	vec4 clip = (db.ClusterViewProjection * vec4(FragmentPosition.xyz, 1.0));
+
+	// { Near, Far, Scale, Bias }
+	if ((clip.w < db.ClusterDepth.x) || (clip.w > db.ClusterDepth.y))
+		return vec3(0);
+
+	// { TilesX, TilesY, Slices, Lights }
+	ivec3 grid  = ivec3(db.ClusterGrid.xyz);
+	vec2  ndc   = clamp(((clip.xy / clip.w) * 0.5 + 0.5), 0.0, 1.0);
+	int   slice = int((log(clip.w) * db.ClusterDepth.z) + db.ClusterDepth.w);
+	ivec3 cell  = clamp(ivec3(int(ndc.x * grid.x), int(ndc.y * grid.y), slice), ivec3(0), (grid - 1));
+
+	// LIGHTS, GRID (OFFSET | COUNT << 24), LIGHT INDICES
+	int  gridOffset  = (int(db.ClusterGrid.w) * CLUSTER_LIGHT_WORDS);
+	int  indexOffset = (gridOffset + (grid.x * grid.y * grid.z));
+	uint froxel      = GetClusterWord(gridOffset + cell.x + (cell.y * grid.x) + (cell.z * grid.x * grid.y));
+	int  first       = (indexOffset + int(froxel & 0xFFFFFFu));
+	int  count       = int(froxel >> 24);
+	vec3 color       = vec3(0);
+
+	for (int i = 0; i < count; i++)
+		color += GetClusteredLight(int(GetClusterWord(first + i)), normal, cameraView, materialColor, materialSpec);
+
+	return color;
+}
+
 // HDR (HIGH DYNAMIC RANGE) - TONE MAPPING (REINHARD)
 vec3 GetFragColorHDR(vec3 colorRGB)
 {
@@ -378,7 +523,7 @@ vec3 GetFragColorHDR(vec3 colorRGB)
 // sRGB GAMMA CORRECTION
 vec3 GetFragColorSRGB(vec3 colorRGB)
 {
-	if (db.EnableSRGB.x > 0.1) {
+	if (HasFeature(FEATURE_SRGB) && (db.EnableSRGB.x > 0.1)) {
 		float sRGB = (1.0 / 2.2);
 		colorRGB.rgb = pow(colorRGB.rgb, vec3(sRGB, sRGB, sRGB));
 	}
@@ -391,22 +536,26 @@ vec4 GetFragColorLight(vec4 materialColor, vec4 materialSpecular, vec3 cameraVie
 	vec4 fragColor = vec4(0);
 
     // LIGHT SOURCES
-    for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+    for (int i = 0; i < LIGHT_COUNT; i++)
     {
         if (db.LightSources[i].Active.x > 0.1)
 		{
     		// ID_ICON_LIGHT_SPOT = 17
-			if (db.LightSources[i].Active.y > 16.9)
+			if (HasFeature(FEATURE_LIGHT_SPOT) && (db.LightSources[i].Active.y > 16.9))
 				fragColor += GetSpotLight(i, normal, cameraView, materialColor, materialSpecular);
     		// ID_ICON_LIGHT_POINT = 16
-			else if (db.LightSources[i].Active.y > 15.9)
+			else if (HasFeature(FEATURE_LIGHT_POINT) && (db.LightSources[i].Active.y > 15.9))
 				fragColor += GetPointLight(i, normal, cameraView, materialColor, materialSpecular);
 			// ID_ICON_LIGHT_DIRECTIONAL = 15
-			else
+			else if (HasFeature(FEATURE_LIGHT_DIRECTIONAL))
 				fragColor += GetDirectionalLight(i, normal, cameraView, materialColor, materialSpecular);
 		}
     }
 
+	// CLUSTERED LIGHTS - THE ALPHA IS LEFT TO THE LIGHT SLOTS
+	if (HasFeature(FEATURE_LIGHT_CLUSTERED) && (db.ClusterGrid.w > 0.5))
+		fragColor.rgb += GetClusteredLights(normal, cameraView, materialColor, materialSpecular);
+
     fragColor.rgb = GetFragColorHDR(fragColor.rgb);
 	fragColor.rgb = GetFragColorSRGB(fragColor.rgb);
 
@@ -424,11 +573,11 @@ void main()
 	vec4 specular   = vec4(0);
 
 	// COMPONENT_WATER = 6
-    if (db.ComponentType.x > 5.9) {
+    if (HasFeature(FEATURE_WATER) && (db.ComponentType.x > 5.9)) {
 		color    = GetMaterialColorWater(cameraView, normal);
 		specular = db.MeshSpecular;
 	// COMPONENT_TERRAIN = 5
-    } else if (db.ComponentType.x > 4.9) {
+    } else if (HasFeature(FEATURE_TERRAIN) && (db.ComponentType.x > 4.9)) {
 		color = GetMaterialColorTerrain();
 		specular = db.MeshSpecular;
 	// COMPONENT_MODEL = 3, COMPONENT_MESH = 2
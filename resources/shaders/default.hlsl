@@ -1,5 +1,10 @@
-static const int MAX_LIGHT_SOURCES = 13;
-static const int MAX_TEXTURES      = 6;
+static const int MAX_LIGHT_SOURCES   = 13;
+static const int MAX_SHADOW_CASCADES = 4;
+static const int MAX_TEXTURES        = 6;
+
+// CLUSTERED LIGHTS (LightCluster) - 32-BIT WORDS IN THE RGBA8 DATA TEXTURE OF THE LAST MESH TEXTURE SLOT
+static const int CLUSTER_LIGHT_WORDS = 24;
+static const int CLUSTER_TEXTURE     = 5;
 
 struct CBLight
 {
@@ -42,6 +47,16 @@ cbuffer DefaultBuffer : register(b0)
 	float4 ComponentType;
 	float4 EnableSRGB;
 	float4 WaterProps;
+
+	float4 ClusterDepth;
+	float4 ClusterGrid;
+	matrix ClusterViewProjection;
+
+	float4 ShadowCascadeLight;
+	float4 ShadowCascadeBias;
+	float4 ShadowCascadeDepth;
+	float4 ShadowCascadeSplits;
+	matrix ShadowCascadeViewProjections[MAX_SHADOW_CASCADES];
 };
 
 Texture2D    Textures[MAX_TEXTURES]        : register(t0);
@@ -181,7 +196,7 @@ float4 GetMaterialColorWater(float2 fragTexCoords, float4 clipSpace, float3 came
 }
 
 // Shadow - the impact of the light on the the fragment from the perspective of the directional/spot light
-float GetShadowFactor(int depthLayer, float3 lightDirection, float3 normal, float4 positionLightSpace)
+float GetShadowFactor(int depthLayer, float3 lightDirection, float3 normal, float4 positionLightSpace, float biasScale)
 {
 	// Convert shadow map UV and Depth coordinates
     float3 shadowMapCoordinates = float3(positionLightSpace.xyz / positionLightSpace.w);    // Perspective projection divide
@@ -204,7 +219,7 @@ float GetShadowFactor(int depthLayer, float3 lightDirection, float3 normal, floa
 	// SOLUTION: Offset depth.
 	const float MIN_OFFSET = 0.005;
 	const float MAX_OFFSET = 0.05;
-	float       offsetBias = max(MAX_OFFSET * (1.0 - dot(normal, lightDirection)), MIN_OFFSET);
+	float       offsetBias = (max(MAX_OFFSET * (1.0 - dot(normal, lightDirection)), MIN_OFFSET) * biasScale);
 	
 	// PCF - Percentage-Closer Filtering
 	// Produces softer shadows, making them appear less blocky or hard.
@@ -243,6 +258,21 @@ float GetShadowFactor(int depthLayer, float3 lightDirection, float3 normal, floa
 	return min(shadowFactor, MAX_INTENSITY);
 }
 
+// Cascaded shadow (ShadowCascades) - the first cascade that reaches the view depth of the fragment, -1 beyond the shadow distance
+int GetShadowCascade(float3 fragPos)
+{
+	float viewDepth = (dot(ShadowCascadeDepth.xyz, fragPos) + ShadowCascadeDepth.w);
+	int   cascades  = (int)ShadowCascadeLight.x;
+
+	for (int c = 0; c < cascades; c++)
+	{
+		if (viewDepth <= ShadowCascadeSplits[c])
+			return c;
+	}
+
+	return -1;
+}
+
 // Shadow - the impact of the light on the the fragment from the perspective of the point light
 float GetShadowFactorOmni(int depthLayer, float3 fragPos, float3 lightPosition)
 {
@@ -313,9 +343,23 @@ float4 GetDirectionalLight(int i, float3 fragPos, float3 normal, float3 viewDire
     // Specular - reflects/mirrors the light direction over the normal
     float specularFactor = GetSpecularFactor(lightDirection, normal, viewDirection, materialSpec.a);
 	
-	// Shadow
-    float4 positionLightSpace = mul(float4(fragPos, 1.0), light.ViewProjection);
-    float  shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace));
+	// Shadow - the first directional light is cascaded, cascade 0 uses the layer of the light and the others the layers after the lights
+    float shadowFactor = 1.0;
+
+	if ((ShadowCascadeLight.x > 0.5) && (i == (int)ShadowCascadeLight.y))
+	{
+		int cascade = GetShadowCascade(fragPos);
+
+		if (cascade >= 0) {
+			float4 positionLightSpace = mul(float4(fragPos, 1.0), ShadowCascadeViewProjections[cascade]);
+			int    depthLayer         = (cascade > 0 ? (MAX_LIGHT_SOURCES + cascade - 1) : i);
+
+			shadowFactor = (1.0 - GetShadowFactor(depthLayer, lightDirection, normal, positionLightSpace, ShadowCascadeBias[cascade]));
+		}
+	} else {
+		float4 positionLightSpace = mul(float4(fragPos, 1.0), light.ViewProjection);
+		shadowFactor              = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace, 1.0));
+	}
 	
     // Combine the light calculations
     float3 ambientFinal  = (light.Ambient.rgb  * materialColor.rgb);
@@ -375,7 +419,7 @@ float4 GetSpotLight(int i, float3 fragPos, float3 normal, float3 viewDirection,
 
 	// Shadow
     float4 positionLightSpace = mul(float4(fragPos, 1.0), light.ViewProjection);
-    float  shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace));
+    float  shadowFactor       = (1.0 - GetShadowFactor(i, lightDirection, normal, positionLightSpace, 1.0));
 
     // Combine the light calculations
     float3 ambient  = (spotLightFactor * attenuationFactor * light.Ambient.rgb  * materialColor.rgb);
@@ -386,6 +430,83 @@ float4 GetSpotLight(int i, float3 fragPos, float3 normal, float3 viewDirection,
 	return float4((ambient + (shadowFactor * (diffuse + specular))), materialColor.a);
 }
 
+uint GetClusterWord(int word)
+{
+	uint width, height;
+	Textures[CLUSTER_TEXTURE].GetDimensions(width, height);
+
+	uint4 bytes = uint4(round(Textures[CLUSTER_TEXTURE].Load(int3((word % (int)width), (word / (int)width), 0)) * 255.0));
+
+	return (bytes.r | (bytes.g << 8) | (bytes.b << 16) | (bytes.a << 24));
+}
+
+float4 GetClusterVector(int word)
+{
+	return asfloat(uint4(GetClusterWord(word), GetClusterWord(word + 1), GetClusterWord(word + 2), GetClusterWord(word + 3)));
+}
+
+// Clustered point/spot light - no shadows, faded out towards the range it was clustered with
+float3 GetClusteredLight(int index, float3 fragPos, float3 normal, float3 viewDirection, float4 materialColor, float4 materialSpec)
+{
+	int    word     = (index * CLUSTER_LIGHT_WORDS);
+	float4 position = GetClusterVector(word);		// { x, y, z, Range }
+	float4 ambient  = GetClusterVector(word + 4);	// { r, g, b, Type<IconType> }
+	float4 diffuse  = GetClusterVector(word + 8);	// { r, g, b, cos(InnerAngle) }
+	float4 specular = GetClusterVector(word + 12);	// { r, g, b, cos(OuterAngle) }
+
+	CBLight light   = (CBLight)0;
+	light.Angles    = float4(diffuse.w, specular.w, 0.0, 0.0);
+	light.Direction = GetClusterVector(word + 16);
+
+	// Direction of the light from the fragment surface
+	float3 lightVector    = (position.xyz - fragPos);
+	float3 lightDirection = normalize(lightVector);
+	float  rangeFactor    = saturate(1.0 - pow((length(lightVector) / max(position.w, 0.0001)), 4.0));
+
+	float diffuseFactor     = GetDiffuseFactor(normal, lightDirection);
+	float specularFactor    = GetSpecularFactor(lightDirection, normal, viewDirection, materialSpec.a);
+	float attenuationFactor = (GetAttenuationFactor(position.xyz, fragPos, GetClusterVector(word + 20).xyz) * rangeFactor * rangeFactor);
+
+	// ID_ICON_LIGHT_SPOT = 17
+	if (ambient.w > 16.9)
+		attenuationFactor *= GetSpotLightFactor(light, lightDirection);
+
+    float3 ambientFinal  = (ambient.rgb  * materialColor.rgb);
+    float3 diffuseFinal  = (diffuse.rgb  * materialColor.rgb * diffuseFactor);
+    float3 specularFinal = (specular.rgb * materialSpec.rgb  * specularFactor);
+
+	return (attenuationFactor * (ambientFinal + diffuseFinal + specularFinal));
+}
+
+// Only the lights of the cluster (froxel) the fragment is in
+float3 GetClusteredLights(float3 fragPos, float3 normal, float3 viewDirection, float4 materialColor, float4 materialSpec)
+{
+	float4 clip = mul(float4(fragPos, 1.0), ClusterViewProjection);
+
+	// { Near, Far, Scale, Bias }
+	if ((clip.w < ClusterDepth.x) || (clip.w > ClusterDepth.y))
+		return float3(0.0, 0.0, 0.0);
+
+	// { TilesX, TilesY, Slices, Lights }
+	int3   grid  = int3(ClusterGrid.xyz);
+	float2 ndc   = saturate(((clip.xy / clip.w) * 0.5 + 0.5));
+	int    slice = int((log(clip.w) * ClusterDepth.z) + ClusterDepth.w);
+	int3   cell  = clamp(int3(int(ndc.x * grid.x), int(ndc.y * grid.y), slice), int3(0, 0, 0), (grid - 1));
+
+	// LIGHTS, GRID (OFFSET | COUNT << 24), LIGHT INDICES
+	int    gridOffset  = (int(ClusterGrid.w) * CLUSTER_LIGHT_WORDS);
+	int    indexOffset = (gridOffset + (grid.x * grid.y * grid.z));
+	uint   froxel      = GetClusterWord(gridOffset + cell.x + (cell.y * grid.x) + (cell.z * grid.x * grid.y));
+	int    first       = (indexOffset + int(froxel & 0xFFFFFF));
+	int    count       = int(froxel >> 24);
+	float3 color       = float3(0.0, 0.0, 0.0);
+
+	for (int i = 0; i < count; i++)
+		color += GetClusteredLight(int(GetClusterWord(first + i)), fragPos, normal, viewDirection, materialColor, materialSpec);
+
+	return color;
+}
+
 // HDR (HIGH DYNAMIC RANGE) - TONE MAPPING (REINHARD)
 float3 GetFragColorHDR(float3 colorRGB)
 {
@@ -424,6 +545,10 @@ float4 GetFragColorLight(float3 fragPos, float4 materialColor, float4 materialSp
 		}
     }
 
+	// CLUSTERED LIGHTS - THE ALPHA IS LEFT TO THE LIGHT SLOTS
+	if (ClusterGrid.w > 0.5)
+		fragColor.rgb += GetClusteredLights(fragPos, normal, cameraView, materialColor, materialSpecular);
+
     fragColor.rgb = GetFragColorHDR(fragColor.rgb);
 	fragColor.rgb = GetFragColorSRGB(fragColor.rgb);
 
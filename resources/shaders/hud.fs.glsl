@@ -10,6 +10,7 @@
 const int MAX_TEXTURES = 6;
 
 layout(location = 0) in  vec2 FragmentTextureCoords;
+layout(location = 1) in  vec4 FragmentColor;
 layout(location = 0) out vec4 GL_FragColor;
 
 layout(binding = 1) uniform HUDBuffer
@@ -23,8 +24,12 @@ layout(binding = 2) uniform sampler2D Textures[MAX_TEXTURES];
 void main()
 {
 	vec4 sampledColor = texture(Textures[5], FragmentTextureCoords);
+	vec4 glyphColor   = texture(Textures[4], FragmentTextureCoords);
 
-	if (hb.IsTransparent.x > 0.1)
+	// THE GLYPH ATLAS IS WHITE WITH THE COVERAGE IN THE ALPHA
+	if (FragmentColor.a > 0.0)
+		GL_FragColor = vec4(FragmentColor.rgb, (FragmentColor.a * glyphColor.a));
+	else if (hb.IsTransparent.x > 0.1)
 		GL_FragColor = sampledColor;
 	else
 		GL_FragColor = vec4(sampledColor.rgb, hb.MaterialColor.a);
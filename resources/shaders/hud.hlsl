@@ -29,6 +29,7 @@ struct VS_INPUT
 struct FS_INPUT
 {
 	float2 FragmentTextureCoords : TEXCOORD0;
+	float4 FragmentColor         : COLOR0;
 	float4 GL_Position           : SV_POSITION;
 };
 
@@ -37,7 +38,9 @@ FS_INPUT VS(VS_INPUT input)
 {
     FS_INPUT output;
 
-	output.FragmentTextureCoords = float2(((input.VertexPosition.x + 1.0) * 0.5), ((input.VertexPosition.y + 1.0) * 0.5));
+	// GLYPH QUADS CARRY THE TEXT COLOR IN THE NORMAL AND THE TEXT ALPHA IN Z, BACKGROUND QUADS HAVE Z = 0
+	output.FragmentTextureCoords = input.VertexTextureCoords;
+	output.FragmentColor         = float4(input.VertexNormal, input.VertexPosition.z);
 	output.GL_Position   = mul(float4(input.VertexPosition.xy, 0.0, 1.0), MB.Model);
 
 	return output;
@@ -48,8 +51,12 @@ float4 PS(FS_INPUT input) : SV_Target
 {
 	float4 GL_FragColor;
 	float4 sampledColor = Textures[5].Sample(TextureSamplers[5], input.FragmentTextureCoords);
+	float4 glyphColor   = Textures[4].Sample(TextureSamplers[4], input.FragmentTextureCoords);
 
-	if (IsTransparent.x > 0.1)
+	// THE GLYPH ATLAS IS WHITE WITH THE COVERAGE IN THE ALPHA
+	if (input.FragmentColor.a > 0.0)
+		GL_FragColor = float4(input.FragmentColor.rgb, (input.FragmentColor.a * glyphColor.a));
+	else if (IsTransparent.x > 0.1)
 		GL_FragColor = sampledColor;
 	else
 		GL_FragColor = float4(sampledColor.rgb, MaterialColor.a);
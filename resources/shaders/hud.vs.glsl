@@ -8,6 +8,7 @@ layout(location = 1) in vec3 VertexPosition;
 layout(location = 2) in vec2 VertexTextureCoords;
 
 layout(location = 0) out vec2 FragmentTextureCoords;
+layout(location = 1) out vec4 FragmentColor;
 
 layout(binding = 0) uniform MatrixBuffer {
 	mat4 Normal;
@@ -16,8 +17,10 @@ layout(binding = 0) uniform MatrixBuffer {
 	mat4 MVP;
 } mb;
 
+// GLYPH QUADS CARRY THE TEXT COLOR IN THE NORMAL AND THE TEXT ALPHA IN Z, BACKGROUND QUADS HAVE Z = 0
 void main()
 {
-	FragmentTextureCoords = vec2(((VertexPosition.x + 1.0) * 0.5), ((VertexPosition.y + 1.0) * 0.5));
+	FragmentTextureCoords = VertexTextureCoords;
+	FragmentColor         = vec4(VertexNormal, VertexPosition.z);
     gl_Position           = (mb.Model * vec4(VertexPosition.xy, 0.0, 1.0));
 }
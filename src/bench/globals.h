@@ -0,0 +1,127 @@
+#ifndef S3DE_GLOBALS_H
+#define S3DE_GLOBALS_H
+
+// FORCE-INCLUDED BY THE CPU-ONLY BENCHMARK TARGET (CMakeLists.txt) INSTEAD OF src/globals.h,
+// IT ONLY PULLS IN THE MODULES THE MICROBENCHMARKS MEASURE - NO wxWidgets, GRAPHICS API OR ASSIMP.
+#if !defined S3DE_CPU_ONLY
+	#error "src/bench/globals.h IS ONLY FOR THE S3DE_CPU_ONLY TARGET, INCLUDE src/globals.h INSTEAD"
+#endif
+
+// C++
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// SIMD - SSSE3 AND LATER ARE CHECKED AT RUNTIME BEFORE USE
+#if defined _M_X64 || defined __x86_64__ || defined __SSE2__
+	#define S3DE_SSE2
+	#include <emmintrin.h>
+	#include <tmmintrin.h>
+
+	#if defined __GNUC__
+		#include <cpuid.h>
+		#define S3DE_TARGET_SSSE3 __attribute__((target("ssse3")))
+	#else
+		#include <intrin.h>
+		#define S3DE_TARGET_SSSE3
+	#endif
+#endif
+
+// GLM - ONLY glm::clamp IS USED BY THE ENCODERS
+#if __has_include(<glm/glm.hpp>)
+	#define GLM_FORCE_RADIANS
+	#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+	#include <glm/glm.hpp>
+#else
+	namespace glm
+	{
+		template <typename T>
+		T clamp(T x, T minVal, T maxVal) { return (x < minVal ? minVal : (x > maxVal ? maxVal : x)); }
+	}
+#endif
+
+// JSON
+#include <json11-1.0.0/json11.hpp>
+
+enum TextureCompression
+{
+	TEXTURE_COMPRESSION_NONE,
+	TEXTURE_COMPRESSION_BC1,
+	TEXTURE_COMPRESSION_BC3,
+	TEXTURE_COMPRESSION_BC5,
+	TEXTURE_COMPRESSION_BC7,
+	TEXTURE_COMPRESSION_ETC2_RGB,
+	TEXTURE_COMPRESSION_ETC2_RGBA,
+	NR_OF_TEXTURE_COMPRESSIONS
+};
+
+#ifndef _DELETEP
+	#define _DELETEP(x) if (x != nullptr) { delete x; x = nullptr; }
+#endif
+
+// THE MEMORY TRACKER REPORTS THROUGH wxWidgets, THE BENCHMARKS DON'T TRACK ANY MEMORY
+#define S3DE_MEMORYTRACKER_H
+
+enum MemoryTag
+{
+	MEMORY_TAG_MESHES, MEMORY_TAG_TEXTURES, MEMORY_TAG_FRAMEBUFFERS, MEMORY_TAG_UNIFORMS, MEMORY_TAG_SCENE, NR_OF_MEMORY_TAGS
+};
+
+enum MemoryDomain
+{
+	MEMORY_CPU, MEMORY_GPU, NR_OF_MEMORY_DOMAINS
+};
+
+class MemoryTracker
+{
+private:
+	MemoryTracker()  {}
+	~MemoryTracker() {}
+
+public:
+	static void Allocate(const void* owner, MemoryTag tag, MemoryDomain domain, uint64_t bytes) {}
+	static void Free(const void* owner) {}
+
+};
+
+#ifndef S3DE_PROFILER_H
+	#include "../system/Profiler.h"
+#endif
+
+#ifndef S3DE_JOBSYSTEM_H
+	#include "../system/JobSystem.h"
+#endif
+
+#ifndef S3DE_MICROBENCHMARK_H
+	#include "../system/MicroBenchmark.h"
+#endif
+
+#ifndef S3DE_IMAGEDECODER_H
+	#include "../system/ImageDecoder.h"
+#endif
+
+#ifndef S3DE_MIPGENERATOR_H
+	#include "../system/MipGenerator.h"
+#endif
+
+#ifndef S3DE_TEXTURECOMPRESSOR_H
+	#include "../system/TextureCompressor.h"
+#endif
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+// STANDALONE CONSOLE ENTRY POINT FOR THE CPU MICROBENCHMARKS - NO wxApp, WINDOW OR GRAPHICS DEVICE IS CREATED.
+// COMPARES AGAINST microbenchmarks-baseline.json WHEN IT EXISTS - RENAME A PREVIOUS RESULT TO USE IT AS THE BASELINE.
+int main(int argc, char** argv)
+{
+	double threshold = 10.0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+
+		if (argument.find("--benchmark-threshold=") == 0)
+			threshold = std::atof(argument.substr(argument.find('=') + 1).c_str());
+		else if (argument.find("--benchmark-min-time=") == 0)
+			MicroBenchmark::MinTimeMS = std::atof(argument.substr(argument.find('=') + 1).c_str());
+	}
+
+#if !defined S3DE_CPU_ONLY
+	RenderEngine::SelectedGraphicsAPI = GRAPHICS_API_NULL;
+#endif
+
+	JobSystem::Init();
+
+	std::vector<MicroBenchmarkResult> results     = MicroBenchmark::Run();
+	int                               regressions = MicroBenchmark::Compare(results, "microbenchmarks-baseline.json", threshold);
+	std::ofstream                     file("microbenchmarks.json");
+
+	file << MicroBenchmark::ToJSON(results, threshold).dump();
+
+	for (const auto &result : results)
+	{
+		if (result.BaselineNS > 0.0)
+			std::printf("%-32s %12.2f ns/op %+8.1f%%%s\n", result.Name.c_str(), result.NsPerOp, result.ChangePct, (result.Regression ? " REGRESSION" : ""));
+		else
+			std::printf("%-32s %12.2f ns/op\n", result.Name.c_str(), result.NsPerOp);
+	}
+
+	JobSystem::Close();
+
+	if (regressions > 0) {
+		std::printf("%d REGRESSION(S) OVER %.1f%%\n", regressions, threshold);
+		return 1;
+	}
+
+	return 0;
+}
@@ -6,9 +6,35 @@
 #define _UNICODE
 
 // C++
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <fstream>
 #include <map>
+#include <mutex>
+#include <random>
 #include <set>
+#include <thread>
+#include <unordered_map>
+
+// SIMD - SSSE3 AND LATER ARE CHECKED AT RUNTIME BEFORE USE
+#if defined _M_X64 || defined __x86_64__ || defined __SSE2__
+	#define S3DE_SSE2
+	#include <emmintrin.h>
+	#include <tmmintrin.h>
+
+	#if defined __GNUC__
+		#include <cpuid.h>
+		#define S3DE_TARGET_SSSE3 __attribute__((target("ssse3")))
+	#else
+		#include <intrin.h>
+		#define S3DE_TARGET_SSSE3
+	#endif
+#endif
 
 // DirectX
 #if defined _WINDOWS
@@ -28,6 +54,8 @@
 	#include <wglext.h>
 #else
 	#include <glxext.h>
+	#include <EGL/egl.h>
+	#include <EGL/eglext.h>
 #endif
 
 // Vulkan
@@ -70,8 +98,10 @@
 #include <wx/dataview.h>
 #include <wx/dcmemory.h>
 #include <wx/dcgraph.h>
+#include <wx/dir.h>
 #include <wx/event.h>
 #include <wx/filedlg.h>
+#include <wx/filename.h>
 #include <wx/frame.h>
 #include <wx/gbsizer.h>
 #include <wx/glcanvas.h>
@@ -93,6 +123,7 @@
 #endif
 
 struct CBMatrix;
+struct PrimitiveMesh;
 
 class BoundingVolume;
 class Buffer;
@@ -101,6 +132,7 @@ class FrameBuffer;
 class LightSource;
 class DXContext;
 class Mesh;
+class NullContext;
 class ShaderProgram;
 class Skybox;
 class Terrain;
@@ -118,6 +150,8 @@ static const uint32_t  LZMA_OFFSET_ID        = 8;
 static const uint32_t  LZMA_OFFSET_SIZE      = 8;
 static const uint32_t  MAX_CONCURRENT_FRAMES = 2;
 static const uint32_t  MAX_LIGHT_SOURCES     = 13;
+static const uint32_t  MAX_SHADOW_CASCADES   = 4;
+static const uint32_t  MAX_DEPTH_LAYERS      = (MAX_LIGHT_SOURCES + MAX_SHADOW_CASCADES - 1);	// 2D DEPTH MAP: ONE LAYER PER LIGHT SLOT, THEN THE EXTRA CASCADES
 static const uint32_t  MAX_TEXTURES          = 6;
 static const uint32_t  MAX_TEXTURE_SLOTS     = (MAX_TEXTURES + MAX_LIGHT_SOURCES + MAX_LIGHT_SOURCES);
 static const uint32_t  NR_OF_FRAMEBUFFERS    = 2;
@@ -167,6 +201,7 @@ enum GraphicsAPI
 	GRAPHICS_API_VULKAN,
 	GRAPHICS_API_DIRECTX11,
 	GRAPHICS_API_DIRECTX12,
+	GRAPHICS_API_NULL,
 	NR_OF_GRAPHICS_ENGINES
 };
 
@@ -198,6 +233,7 @@ enum IconType
 	ID_GRAPHICS_API,
 	ID_VSYNC,
 	ID_SRGB,
+	ID_GPU_TIMERS,
 	ID_COMPONENTS,
 	ID_CHILDREN,
 	ID_SCENE_DETAILS,
@@ -282,6 +318,37 @@ enum ShaderID
 	NR_OF_SHADERS
 };
 
+// MUST MATCH THE FEATURE_* CONSTANTS IN default.fs.glsl, THE ACTIVE LIGHT COUNT IS STORED IN THE UPPER BITS
+enum ShaderFeature
+{
+	SHADER_FEATURE_NONE              = 0x000,
+	SHADER_FEATURE_CLIPPING          = 0x001,
+	SHADER_FEATURE_DIFFUSE_MAP       = 0x002,
+	SHADER_FEATURE_SPECULAR_MAP      = 0x004,
+	SHADER_FEATURE_SRGB              = 0x008,
+	SHADER_FEATURE_TERRAIN           = 0x010,
+	SHADER_FEATURE_WATER             = 0x020,
+	SHADER_FEATURE_LIGHT_DIRECTIONAL = 0x040,
+	SHADER_FEATURE_LIGHT_POINT       = 0x080,
+	SHADER_FEATURE_LIGHT_SPOT        = 0x100,
+	SHADER_FEATURE_LIGHT_CLUSTERED   = 0x200,
+	SHADER_FEATURE_FLAGS             = 0x3FF,
+	SHADER_FEATURE_LIGHTS_SHIFT      = 16,
+	SHADER_FEATURES_ALL              = (SHADER_FEATURE_FLAGS | (MAX_LIGHT_SOURCES << SHADER_FEATURE_LIGHTS_SHIFT))
+};
+
+enum TextureCompression
+{
+	TEXTURE_COMPRESSION_NONE,
+	TEXTURE_COMPRESSION_BC1,
+	TEXTURE_COMPRESSION_BC3,
+	TEXTURE_COMPRESSION_BC5,
+	TEXTURE_COMPRESSION_BC7,
+	TEXTURE_COMPRESSION_ETC2_RGB,
+	TEXTURE_COMPRESSION_ETC2_RGBA,
+	NR_OF_TEXTURE_COMPRESSIONS
+};
+
 enum TextureType
 {
 	TEXTURE_UNKNOWN = -1,
@@ -327,6 +394,7 @@ enum UniformBufferTypeVK
 
 struct DrawProperties
 {
+	int             Cascade            = -1;
 	glm::vec3       ClipMax            = {};
 	glm::vec3       ClipMin            = {};
 	int             DepthLayer         = 0;
@@ -384,6 +452,9 @@ struct VKPipeline
 	VkPipelineLayout Layout;
 	VkPipeline       Pipelines[NR_OF_SHADERS];
 	VkPipeline       PipelinesFBO[NR_OF_SHADERS];
+
+	std::unordered_map<uint32_t, VkPipeline> Variants;
+	std::unordered_map<uint32_t, VkPipeline> VariantsFBO;
 };
 
 struct VKUniform
@@ -401,6 +472,7 @@ struct GLCanvas
 	wxGLCanvas*    Canvas      = nullptr;
 	DXContext*     DX          = nullptr;
 	wxGLContext*   GL          = nullptr;
+	NullContext*   Null        = nullptr;
 	wxPoint        Position    = wxPoint(0, 0);
 	wxSize         Size        = wxSize(0, 0);
 	VKContext*     VK          = nullptr;
@@ -427,9 +499,33 @@ struct GLCanvas
 #ifndef S3DE_NOISE_H
 	#include "system/Noise.h"
 #endif
+#ifndef S3DE_PROFILER_H
+	#include "system/Profiler.h"
+#endif
+#ifndef S3DE_JOBSYSTEM_H
+	#include "system/JobSystem.h"
+#endif
+#ifndef S3DE_MEMORYTRACKER_H
+	#include "system/MemoryTracker.h"
+#endif
+#ifndef S3DE_MICROBENCHMARK_H
+	#include "system/MicroBenchmark.h"
+#endif
+#ifndef S3DE_IMAGEDECODER_H
+	#include "system/ImageDecoder.h"
+#endif
+#ifndef S3DE_MIPGENERATOR_H
+	#include "system/MipGenerator.h"
+#endif
+#ifndef S3DE_TEXTURECOMPRESSOR_H
+	#include "system/TextureCompressor.h"
+#endif
 #ifndef S3DE_INPUTMANAGER_H
 	#include "input/InputManager.h"
 #endif
+#ifndef S3DE_INPUTRECORDER_H
+	#include "input/InputRecorder.h"
+#endif
 #ifndef S3DE_RAYCAST_H
 	#include "physics/RayCast.h"
 #endif
@@ -452,6 +548,9 @@ struct GLCanvas
 #ifndef S3DE_VKCONTEXT_H
 	#include "render/VKContext.h"
 #endif
+#ifndef S3DE_NULLCONTEXT_H
+	#include "render/NullContext.h"
+#endif
 #ifndef S3DE_COMPONENT_H
 	#include "scene/Component.h"
 #endif
@@ -479,9 +578,15 @@ struct GLCanvas
 #ifndef S3DE_BOUNDINGVOLUME_H
 	#include "scene/BoundingVolume.h"
 #endif
+#ifndef S3DE_PRIMITIVES_H
+	#include "scene/Primitives.h"
+#endif
 //#ifndef S3DE_CAMERA_H
 //	#include "scene/Camera.h"
 //#endif
+#ifndef S3DE_GLYPHATLAS_H
+	#include "scene/GlyphAtlas.h"
+#endif
 #ifndef S3DE_HUD_H
 	#include "scene/HUD.h"
 #endif
@@ -497,18 +602,51 @@ struct GLCanvas
 #ifndef S3DE_SKYBOX_H
 	#include "scene/Skybox.h"
 #endif
+#ifndef S3DE_STRESSSCENE_H
+	#include "scene/StressScene.h"
+#endif
 #ifndef S3DE_TERRAIN_H
 	#include "scene/Terrain.h"
 #endif
+#ifndef S3DE_TERRAINSTREAMER_H
+	#include "scene/TerrainStreamer.h"
+#endif
 #ifndef S3DE_TEXTURE_H
 	#include "scene/Texture.h"
 #endif
+#ifndef S3DE_TEXTURECACHE_H
+	#include "scene/TextureCache.h"
+#endif
+#ifndef S3DE_TEXTURESTREAMER_H
+	#include "scene/TextureStreamer.h"
+#endif
 #ifndef S3DE_WATERFBO_H
 	#include "scene/WaterFBO.h"
 #endif
 #ifndef S3DE_WATER_H
 	#include "scene/Water.h"
 #endif
+#ifndef S3DE_RENDERTHREAD_H
+	#include "render/RenderThread.h"
+#endif
+#ifndef S3DE_GPUTIMER_H
+	#include "render/GPUTimer.h"
+#endif
+#ifndef S3DE_HUDBATCH_H
+	#include "render/HUDBatch.h"
+#endif
+#ifndef S3DE_LIGHTCLUSTER_H
+	#include "render/LightCluster.h"
+#endif
+#ifndef S3DE_SHADOWCASCADES_H
+	#include "render/ShadowCascades.h"
+#endif
+#ifndef S3DE_HEADLESS_H
+	#include "render/Headless.h"
+#endif
+#ifndef S3DE_RENDERSTATS_H
+	#include "render/RenderStats.h"
+#endif
 #ifndef S3DE_TIMEMANAGER_H
 	#include "time/TimeManager.h"
 #endif
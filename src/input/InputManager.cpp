@@ -44,6 +44,8 @@ bool InputManager::isValidEventTime(const wxMouseEvent &event)
 
 void InputManager::OnGraphicsMenu(const wxCommandEvent &event)
 {
+	RenderThreadLock lock;
+
 	switch (event.GetId()) {
 		case ID_ASPECT_RATIO:  RenderEngine::SetAspectRatio(event.GetString());      break;
 		case ID_FOV:           RenderEngine::CameraMain->SetFOV(event.GetString());  break;
@@ -52,11 +54,14 @@ void InputManager::OnGraphicsMenu(const wxCommandEvent &event)
 		case ID_GRAPHICS_API:  RenderEngine::SetGraphicsAPI(event.GetString());      break;
 		case ID_SRGB:          RenderEngine::EnableSRGB = event.IsChecked();         break;
 		case ID_VSYNC:         RenderEngine::SetVSync(event.IsChecked());            break;
+		case ID_GPU_TIMERS:    GPUTimer::ShowOverlay(event.IsChecked());             break;
 	}
 }
 
 void InputManager::OnIcon(const wxCommandEvent &event)
 {
+	RenderThreadLock lock;
+
 	IconType iconType = (IconType)event.GetId();
 
 	switch (iconType) {
@@ -89,24 +94,33 @@ void InputManager::OnIcon(const wxCommandEvent &event)
 
 void InputManager::OnKeyboard(wxKeyEvent &event)
 {
+	if (InputRecorder::IgnoreLiveInput())
+		return;
+
 	bool result = false;
 
-	if ((RenderEngine::CameraMain != nullptr) && !RenderEngine::Canvas.Window->IsPropertiesActive())
+	if ((RenderEngine::CameraMain != nullptr) && (InputRecorder::IsDispatching() || !RenderEngine::Canvas.Window->IsPropertiesActive()))
 		result = RenderEngine::CameraMain->InputKeyboard(event.GetKeyCode());
 
-	if (result)
+	if (result) {
+		InputRecorder::Record(event);
 		RenderEngine::Canvas.Window->UpdateProperties();
-	else
+	} else {
 		event.Skip();
+	}
 }
 
 void InputManager::OnList(const wxCommandEvent &event)
 {
+	RenderThreadLock lock;
+
 	switch (event.GetId()) {
 		case ID_COMPONENTS:
+			InputRecorder::Record(INPUT_EVENT_SELECT_COMPONENT, event.GetSelection());
 			SceneManager::SelectComponent(event.GetSelection());
 			break;
 		case ID_CHILDREN:
+			InputRecorder::Record(INPUT_EVENT_SELECT_CHILD, event.GetSelection());
 			SceneManager::SelectChild(event.GetSelection());
 			break;
 		case ID_SCENE_CLEAR:
@@ -145,16 +159,28 @@ void InputManager::OnList(const wxCommandEvent &event)
 
 void InputManager::OnMouseDown(const wxMouseEvent &event)
 {
+	if (InputRecorder::IgnoreLiveInput())
+		return;
+
+	InputRecorder::Record(event);
+
 	InputManager::mouseState.Position = event.GetPosition();
 
-	wxSetCursor(wxCursor(wxCURSOR_BLANK));
-	RenderEngine::Canvas.Canvas->CaptureMouse();
+	if (!InputRecorder::IsDispatching()) {
+		wxSetCursor(wxCursor(wxCURSOR_BLANK));
+		RenderEngine::Canvas.Canvas->CaptureMouse();
+	}
 }
 
 void InputManager::OnMouseMove(const wxMouseEvent &event)
 {
+	if (InputRecorder::IgnoreLiveInput())
+		return;
+
 	if (event.Dragging() && (event.MiddleIsDown() || event.RightIsDown()) && (RenderEngine::CameraMain != nullptr))
 	{
+		InputRecorder::Record(event);
+
 		RenderEngine::CameraMain->InputMouseMove(event, InputManager::mouseState);
 
 		wxPoint center = wxPoint(
@@ -162,7 +188,9 @@ void InputManager::OnMouseMove(const wxMouseEvent &event)
 			((RenderEngine::Canvas.Position.y + RenderEngine::Canvas.Size.GetHeight()) / 2)
 		);
 
-		RenderEngine::Canvas.Canvas->WarpPointer(center.x, center.y);
+		if (!InputRecorder::IsDispatching())
+			RenderEngine::Canvas.Canvas->WarpPointer(center.x, center.y);
+
 		InputManager::mouseState.Position = center;
 
 		RenderEngine::Canvas.Window->UpdateProperties();
@@ -171,7 +199,11 @@ void InputManager::OnMouseMove(const wxMouseEvent &event)
 
 void InputManager::OnMouseScroll(wxMouseEvent &event)
 {
+	if (InputRecorder::IgnoreLiveInput())
+		return;
+
 	if (RenderEngine::CameraMain != nullptr) {
+		InputRecorder::Record(event);
 		RenderEngine::CameraMain->InputMouseScroll(event);
 		RenderEngine::Canvas.Window->UpdateProperties();
 	} else {
@@ -181,25 +213,35 @@ void InputManager::OnMouseScroll(wxMouseEvent &event)
 
 void InputManager::OnMouseUp(const wxMouseEvent &event)
 {
+	if (InputRecorder::IgnoreLiveInput())
+		return;
+
 	if (RenderEngine::Canvas.Canvas->HasCapture()) {
 		RenderEngine::Canvas.Canvas->ReleaseMouse();
 		wxSetCursor(wxNullCursor);
 	}
 
-	if ((event.GetButton() == wxMOUSE_BTN_LEFT) && InputManager::isValidEventTime(event))
+	// THE LOAD TIME CHECK ALREADY FILTERED THE RECORDED EVENTS
+	if ((event.GetButton() == wxMOUSE_BTN_LEFT) && (InputRecorder::IsDispatching() || InputManager::isValidEventTime(event))) {
+		InputRecorder::Record(event);
 		PhysicsEngine::CheckRayCasts(event);
+	}
 
 	RenderEngine::Canvas.Window->DeactivateProperties();
 }
 
 void InputManager::OnPropertyChanged(const wxPropertyGridEvent &event)
 {
+	RenderThreadLock lock;
+
 	if (event.GetId() == ID_SCENE_DETAILS)
 		RenderEngine::Canvas.Window->UpdateComponents(event.GetProperty());
 }
 
 void InputManager::OnWindowResize(const wxSizeEvent &event)
 {
+	RenderThreadLock lock;
+
 	RenderEngine::SetCanvasSize(RenderEngine::Canvas.Size.GetWidth(), RenderEngine::Canvas.Size.GetHeight());
 }
 
@@ -0,0 +1,384 @@
+#include "InputRecorder.h"
+
+bool                                  InputRecorder::dispatching  = false;
+std::vector<InputEvent>               InputRecorder::events;
+wxString                              InputRecorder::file         = "";
+uint32_t                              InputRecorder::frame        = 0;
+uint32_t                              InputRecorder::frames       = 0;
+std::vector<double>                   InputRecorder::frameTimes;
+std::chrono::steady_clock::time_point InputRecorder::frameTime;
+size_t                                InputRecorder::nextEvent    = 0;
+uint64_t                              InputRecorder::pathHash     = 0;
+uint64_t                              InputRecorder::recordedHash = 0;
+bool                                  InputRecorder::recording    = false;
+bool                                  InputRecorder::replaying    = false;
+std::chrono::steady_clock::time_point InputRecorder::startTime;
+
+// LOG LAYOUT (HOST BYTE ORDER, LZMA COMPRESSED LIKE THE SCENE FILES)
+//   HEADER: "S3DI", VERSION (4), FRAMES (4), EVENTS (4), PATH HASH (8), FIXED DELTA TIME (8)
+//   EVENT:  FRAME (4), TIME MS (4), TYPE (1), BUTTONS (1), MODIFIERS (1), RESERVED (1), X (2), Y (2), VALUE (4)
+static const char     LOG_ID[4]       = { 'S', '3', 'D', 'I' };
+static const uint32_t LOG_VERSION     = 1;
+static const size_t   LOG_HEADER_SIZE = 32;
+static const size_t   LOG_EVENT_SIZE  = 20;
+
+void InputRecorder::dispatch(const InputEvent &event)
+{
+	wxEventType mouseType = wxEVT_NULL;
+
+	switch (event.Type) {
+	case INPUT_EVENT_KEY:
+		{
+			wxKeyEvent keyEvent(wxEVT_KEY_DOWN);
+			keyEvent.m_keyCode = event.Value;
+
+			InputManager::OnKeyboard(keyEvent);
+		}
+		return;
+	case INPUT_EVENT_MOUSE_DOWN:
+		mouseType = (event.Value == wxMOUSE_BTN_MIDDLE ? wxEVT_MIDDLE_DOWN : wxEVT_RIGHT_DOWN);
+		break;
+	case INPUT_EVENT_MOUSE_MOVE:
+		mouseType = wxEVT_MOTION;
+		break;
+	case INPUT_EVENT_MOUSE_SCROLL:
+		mouseType = wxEVT_MOUSEWHEEL;
+		break;
+	case INPUT_EVENT_MOUSE_UP:
+		mouseType = wxEVT_LEFT_UP;
+		break;
+	case INPUT_EVENT_SELECT_COMPONENT:
+	case INPUT_EVENT_SELECT_CHILD:
+		{
+			wxCommandEvent listEvent(wxEVT_LISTBOX, (event.Type == INPUT_EVENT_SELECT_COMPONENT ? ID_COMPONENTS : ID_CHILDREN));
+			listEvent.SetInt(event.Value);
+
+			InputManager::OnList(listEvent);
+		}
+		return;
+	default:
+		throw;
+	}
+
+	wxMouseEvent mouseEvent(mouseType);
+
+	mouseEvent.SetX(event.X);
+	mouseEvent.SetY(event.Y);
+	mouseEvent.SetLeftDown((event.Buttons   & 0x1) != 0);
+	mouseEvent.SetMiddleDown((event.Buttons & 0x2) != 0);
+	mouseEvent.SetRightDown((event.Buttons  & 0x4) != 0);
+	mouseEvent.SetShiftDown((event.Modifiers   & wxMOD_SHIFT)   != 0);
+	mouseEvent.SetControlDown((event.Modifiers & wxMOD_CONTROL) != 0);
+	mouseEvent.SetAltDown((event.Modifiers     & wxMOD_ALT)     != 0);
+
+	mouseEvent.m_wheelRotation = (event.Type == INPUT_EVENT_MOUSE_SCROLL ? event.Value : 0);
+
+	switch (event.Type) {
+		case INPUT_EVENT_MOUSE_DOWN:   InputManager::OnMouseDown(mouseEvent);   break;
+		case INPUT_EVENT_MOUSE_MOVE:   InputManager::OnMouseMove(mouseEvent);   break;
+		case INPUT_EVENT_MOUSE_SCROLL: InputManager::OnMouseScroll(mouseEvent); break;
+		case INPUT_EVENT_MOUSE_UP:     InputManager::OnMouseUp(mouseEvent);     break;
+		default: throw;
+	}
+}
+
+// FNV-1a
+uint64_t InputRecorder::hash(uint64_t value, const void* data, size_t size)
+{
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	for (size_t i = 0; i < size; i++) {
+		value ^= bytes[i];
+		value *= 1099511628211ull;
+	}
+
+	return value;
+}
+
+// LIVE INPUT WOULD CHANGE THE WORKLOAD WHILE A LOG IS REPLAYED
+bool InputRecorder::IgnoreLiveInput()
+{
+	return (InputRecorder::replaying && !InputRecorder::dispatching);
+}
+
+bool InputRecorder::IsDispatching()
+{
+	return InputRecorder::dispatching;
+}
+
+bool InputRecorder::IsRecording()
+{
+	return InputRecorder::recording;
+}
+
+bool InputRecorder::IsReplaying()
+{
+	return InputRecorder::replaying;
+}
+
+void InputRecorder::record(InputEvent &event)
+{
+	event.Frame  = InputRecorder::frame;
+	event.TimeMS = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - InputRecorder::startTime).count();
+
+	InputRecorder::events.push_back(event);
+}
+
+void InputRecorder::Record(const wxKeyEvent &event)
+{
+	if (!InputRecorder::recording)
+		return;
+
+	InputEvent inputEvent = {};
+
+	inputEvent.Modifiers = (uint8_t)event.GetModifiers();
+	inputEvent.Type      = INPUT_EVENT_KEY;
+	inputEvent.Value     = event.GetKeyCode();
+
+	InputRecorder::record(inputEvent);
+}
+
+void InputRecorder::Record(const wxMouseEvent &event)
+{
+	if (!InputRecorder::recording)
+		return;
+
+	InputEvent  inputEvent = {};
+	wxEventType eventType  = event.GetEventType();
+
+	if ((eventType == wxEVT_LEFT_DOWN) || (eventType == wxEVT_MIDDLE_DOWN) || (eventType == wxEVT_RIGHT_DOWN))
+		inputEvent.Type = INPUT_EVENT_MOUSE_DOWN;
+	else if ((eventType == wxEVT_LEFT_UP) || (eventType == wxEVT_MIDDLE_UP) || (eventType == wxEVT_RIGHT_UP))
+		inputEvent.Type = INPUT_EVENT_MOUSE_UP;
+	else if (eventType == wxEVT_MOTION)
+		inputEvent.Type = INPUT_EVENT_MOUSE_MOVE;
+	else if (eventType == wxEVT_MOUSEWHEEL)
+		inputEvent.Type = INPUT_EVENT_MOUSE_SCROLL;
+	else
+		return;
+
+	inputEvent.Buttons   = (uint8_t)((event.LeftIsDown() ? 0x1 : 0) | (event.MiddleIsDown() ? 0x2 : 0) | (event.RightIsDown() ? 0x4 : 0));
+	inputEvent.Modifiers = (uint8_t)event.GetModifiers();
+	inputEvent.Value     = (inputEvent.Type == INPUT_EVENT_MOUSE_SCROLL ? event.GetWheelRotation() : event.GetButton());
+	inputEvent.X         = (int16_t)event.GetX();
+	inputEvent.Y         = (int16_t)event.GetY();
+
+	InputRecorder::record(inputEvent);
+}
+
+void InputRecorder::Record(InputEventType type, int value)
+{
+	if (!InputRecorder::recording)
+		return;
+
+	InputEvent inputEvent = {};
+
+	inputEvent.Type  = type;
+	inputEvent.Value = value;
+
+	InputRecorder::record(inputEvent);
+}
+
+int InputRecorder::Replay(const wxString &logFile)
+{
+	if (InputRecorder::recording || InputRecorder::replaying)
+		return -1;
+
+	if (!wxFileExists(logFile)) {
+		wxMessageBox(("ERROR: Failed to find the input log " + logFile), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+		return -2;
+	}
+
+	std::vector<uint8_t> data = Utils::Decompress(Utils::LoadDataFile(logFile));
+
+	if ((data.size() < LOG_HEADER_SIZE) || (std::memcmp(data.data(), LOG_ID, sizeof(LOG_ID)) != 0)) {
+		wxMessageBox(("ERROR: Invalid input log " + logFile), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+		return -3;
+	}
+
+	uint32_t version, nrOfEvents;
+
+	std::memcpy(&version,                      (data.data() + 4),  4);
+	std::memcpy(&InputRecorder::frames,        (data.data() + 8),  4);
+	std::memcpy(&nrOfEvents,                   (data.data() + 12), 4);
+	std::memcpy(&InputRecorder::recordedHash,  (data.data() + 16), 8);
+	std::memcpy(&TimeManager::FixedDeltaTime,  (data.data() + 24), 8);
+
+	if ((version != LOG_VERSION) || (data.size() < (LOG_HEADER_SIZE + (nrOfEvents * LOG_EVENT_SIZE)))) {
+		wxMessageBox(("ERROR: Unsupported input log " + logFile), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+		return -4;
+	}
+
+	InputRecorder::events.resize(nrOfEvents);
+
+	for (uint32_t i = 0; i < nrOfEvents; i++)
+	{
+		const uint8_t* eventData = (data.data() + LOG_HEADER_SIZE + (i * LOG_EVENT_SIZE));
+		InputEvent&    event     = InputRecorder::events[i];
+
+		std::memcpy(&event.Frame,  eventData,        4);
+		std::memcpy(&event.TimeMS, (eventData + 4),  4);
+		std::memcpy(&event.X,      (eventData + 12), 2);
+		std::memcpy(&event.Y,      (eventData + 14), 2);
+		std::memcpy(&event.Value,  (eventData + 16), 4);
+
+		event.Type      = (InputEventType)std::min((int)eventData[8], (int)(NR_OF_INPUT_EVENTS - 1));
+		event.Buttons   = eventData[9];
+		event.Modifiers = eventData[10];
+	}
+
+	InputRecorder::file      = logFile;
+	InputRecorder::frame     = 0;
+	InputRecorder::nextEvent = 0;
+	InputRecorder::pathHash  = 14695981039346656037ull;
+	InputRecorder::replaying = true;
+	InputRecorder::startTime = std::chrono::steady_clock::now();
+	InputRecorder::frameTime = InputRecorder::startTime;
+
+	InputRecorder::frameTimes.clear();
+
+	TimeManager::LockStep = true;
+
+	RenderEngine::Canvas.Window->SetStatusText("Replaying the input log '" + logFile + "' ...");
+
+	return 0;
+}
+
+int InputRecorder::Start(const wxString &logFile)
+{
+	if (logFile.empty() || InputRecorder::recording || InputRecorder::replaying)
+		return -1;
+
+	InputRecorder::file      = logFile;
+	InputRecorder::frame     = 0;
+	InputRecorder::pathHash  = 14695981039346656037ull;
+	InputRecorder::recording = true;
+	InputRecorder::startTime = std::chrono::steady_clock::now();
+
+	InputRecorder::events.clear();
+
+	TimeManager::LockStep = true;
+
+	return 0;
+}
+
+int InputRecorder::Stop()
+{
+	if (!InputRecorder::recording)
+		return -1;
+
+	InputRecorder::recording = false;
+	InputRecorder::frames    = InputRecorder::frame;
+
+	TimeManager::LockStep = false;
+
+	uint32_t             nrOfEvents = (uint32_t)InputRecorder::events.size();
+	std::vector<uint8_t> data(LOG_HEADER_SIZE + (nrOfEvents * LOG_EVENT_SIZE), 0);
+
+	std::memcpy(data.data(),          LOG_ID,                       sizeof(LOG_ID));
+	std::memcpy((data.data() + 4),    &LOG_VERSION,                 4);
+	std::memcpy((data.data() + 8),    &InputRecorder::frames,       4);
+	std::memcpy((data.data() + 12),   &nrOfEvents,                  4);
+	std::memcpy((data.data() + 16),   &InputRecorder::pathHash,     8);
+	std::memcpy((data.data() + 24),   &TimeManager::FixedDeltaTime, 8);
+
+	for (uint32_t i = 0; i < nrOfEvents; i++)
+	{
+		uint8_t*          eventData = (data.data() + LOG_HEADER_SIZE + (i * LOG_EVENT_SIZE));
+		const InputEvent& event     = InputRecorder::events[i];
+
+		std::memcpy(eventData,        &event.Frame,  4);
+		std::memcpy((eventData + 4),  &event.TimeMS, 4);
+		std::memcpy((eventData + 12), &event.X,      2);
+		std::memcpy((eventData + 14), &event.Y,      2);
+		std::memcpy((eventData + 16), &event.Value,  4);
+
+		eventData[8]  = (uint8_t)event.Type;
+		eventData[9]  = event.Buttons;
+		eventData[10] = event.Modifiers;
+	}
+
+	return Utils::SaveDataToFile(Utils::Compress(data), InputRecorder::file, data.size());
+}
+
+json11::Json InputRecorder::ToJSON()
+{
+	std::vector<double> times = InputRecorder::frameTimes;
+	double              total = 0.0;
+
+	std::sort(times.begin(), times.end());
+
+	for (auto time : times)
+		total += time;
+
+	return json11::Json::object {
+		{ "log",               static_cast<std::string>(InputRecorder::file) },
+		{ "frames",            (double)InputRecorder::frame },
+		{ "events",            (double)InputRecorder::nextEvent },
+		{ "frame_time_avg_ms", (!times.empty() ? (total / (double)times.size()) : 0.0) },
+		{ "frame_time_p50_ms", (!times.empty() ? times[(size_t)((times.size() - 1) * 0.50)] : 0.0) },
+		{ "frame_time_p95_ms", (!times.empty() ? times[(size_t)((times.size() - 1) * 0.95)] : 0.0) },
+		{ "frame_time_p99_ms", (!times.empty() ? times[(size_t)((times.size() - 1) * 0.99)] : 0.0) },
+		{ "path_hash",         static_cast<std::string>(wxString::Format("%016llx", (unsigned long long)InputRecorder::pathHash)) },
+		{ "recorded_hash",     static_cast<std::string>(wxString::Format("%016llx", (unsigned long long)InputRecorder::recordedHash)) },
+		{ "matches_recording", (InputRecorder::pathHash == InputRecorder::recordedHash) }
+	};
+}
+
+// CALLED ONCE PER FRAME BEFORE THE SIMULATION STEPS
+void InputRecorder::Update()
+{
+	if (!InputRecorder::recording && !InputRecorder::replaying)
+		return;
+
+	auto now = std::chrono::steady_clock::now();
+
+	if (InputRecorder::replaying)
+	{
+		if (InputRecorder::frame > 0)
+			InputRecorder::frameTimes.push_back(std::chrono::duration<double, std::milli>(now - InputRecorder::frameTime).count());
+
+		InputRecorder::dispatching = true;
+
+		while ((InputRecorder::nextEvent < InputRecorder::events.size()) && (InputRecorder::events[InputRecorder::nextEvent].Frame <= InputRecorder::frame))
+			InputRecorder::dispatch(InputRecorder::events[InputRecorder::nextEvent++]);
+
+		InputRecorder::dispatching = false;
+	}
+
+	InputRecorder::frameTime = now;
+
+	InputRecorder::updateHash();
+	InputRecorder::frame++;
+
+	if (InputRecorder::replaying && (InputRecorder::frame >= InputRecorder::frames))
+	{
+		InputRecorder::replaying = false;
+		TimeManager::LockStep    = false;
+
+		RenderEngine::Canvas.Window->SetStatusText("Replaying the input log '" + InputRecorder::file + "' ... OK");
+	}
+}
+
+// CAMERA PATH AND SELECTIONS - COMPARED BETWEEN THE RECORDING AND THE REPLAY
+void InputRecorder::updateHash()
+{
+	if (RenderEngine::CameraMain != nullptr)
+	{
+		glm::vec3 position = RenderEngine::CameraMain->Position();
+		glm::vec3 rotation = RenderEngine::CameraMain->Rotation();
+
+		InputRecorder::pathHash = InputRecorder::hash(InputRecorder::pathHash, glm::value_ptr(position), sizeof(position));
+		InputRecorder::pathHash = InputRecorder::hash(InputRecorder::pathHash, glm::value_ptr(rotation), sizeof(rotation));
+	}
+
+	int selected = (SceneManager::SelectedComponent != nullptr ? SceneManager::GetComponentIndex(SceneManager::SelectedComponent) : -1);
+
+	InputRecorder::pathHash = InputRecorder::hash(InputRecorder::pathHash, &selected, sizeof(selected));
+
+	for (auto mesh : RenderEngine::Renderables)
+	{
+		bool meshSelected = ((mesh != nullptr) && dynamic_cast<Mesh*>(mesh)->IsSelected());
+		InputRecorder::pathHash = InputRecorder::hash(InputRecorder::pathHash, &meshSelected, sizeof(meshSelected));
+	}
+}
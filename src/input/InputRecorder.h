@@ -0,0 +1,76 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_INPUTRECORDER_H
+#define S3DE_INPUTRECORDER_H
+
+enum InputEventType
+{
+	INPUT_EVENT_KEY,
+	INPUT_EVENT_MOUSE_DOWN,
+	INPUT_EVENT_MOUSE_MOVE,
+	INPUT_EVENT_MOUSE_SCROLL,
+	INPUT_EVENT_MOUSE_UP,
+	INPUT_EVENT_SELECT_COMPONENT,
+	INPUT_EVENT_SELECT_CHILD,
+	NR_OF_INPUT_EVENTS
+};
+
+struct InputEvent
+{
+	uint8_t        Buttons   = 0;
+	uint32_t       Frame     = 0;
+	uint8_t        Modifiers = 0;
+	uint32_t       TimeMS    = 0;
+	InputEventType Type      = INPUT_EVENT_KEY;
+	int32_t        Value     = 0;
+	int16_t        X         = 0;
+	int16_t        Y         = 0;
+};
+
+// RECORDING AND REPLAY BOTH RUN LOCK-STEP (ONE FIXED SIMULATION STEP PER FRAME) SO THE SAME LOG GIVES THE SAME SESSION
+class InputRecorder
+{
+private:
+	InputRecorder()  {}
+	~InputRecorder() {}
+
+private:
+	static bool                                  dispatching;
+	static std::vector<InputEvent>               events;
+	static wxString                              file;
+	static uint32_t                              frame;
+	static uint32_t                              frames;
+	static std::vector<double>                   frameTimes;
+	static std::chrono::steady_clock::time_point frameTime;
+	static size_t                                nextEvent;
+	static uint64_t                              pathHash;
+	static uint64_t                              recordedHash;
+	static bool                                  recording;
+	static bool                                  replaying;
+	static std::chrono::steady_clock::time_point startTime;
+
+public:
+	static bool         IgnoreLiveInput();
+	static bool         IsDispatching();
+	static bool         IsRecording();
+	static bool         IsReplaying();
+	static void         Record(const wxKeyEvent   &event);
+	static void         Record(const wxMouseEvent &event);
+	static void         Record(InputEventType type, int value);
+	static int          Replay(const wxString &logFile);
+	static int          Start(const wxString &logFile);
+	static int          Stop();
+	static json11::Json ToJSON();
+	static void         Update();
+
+private:
+	static void     dispatch(const InputEvent &event);
+	static uint64_t hash(uint64_t value, const void* data, size_t size);
+	static void     record(InputEvent &event);
+	static void     updateHash();
+
+};
+
+#endif
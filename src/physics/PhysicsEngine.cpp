@@ -35,11 +35,16 @@ void PhysicsEngine::CheckRayCasts(const wxMouseEvent &event)
 
 void PhysicsEngine::Update()
 {
+	PROFILE_SCOPE("PhysicsEngine::Update");
+
+	float deltaTime = (float)TimeManager::FixedDeltaTime;
+
 	for (auto component : SceneManager::Components)
 	{
 		for (auto child : component->Children) {
 			if ((child != nullptr) && child->AutoRotate) {
-				child->RotateBy(child->AutoRotation);
+				child->SaveState();
+				child->RotateBy(child->AutoRotation * deltaTime);
 
 				if (TimeManager::TimeElapsedMS() % 100 < 20)
 					RenderEngine::Canvas.Window->UpdateProperties(true);
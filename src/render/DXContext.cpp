@@ -154,6 +154,9 @@ int DXContext::commandsInit()
 	if (FAILED(this->commandList->Reset(this->commandAllocator, nullptr)))
 		return -2;
 
+	// A RESET COMMAND LIST HAS NO PIPELINE STATE BOUND
+	this->boundPipeline12 = nullptr;
+
 	return 0;
 }
 
@@ -243,6 +246,8 @@ int DXContext::CreateConstantBuffers11(Buffer* buffer)
 
 		if (FAILED(this->renderDevice11->CreateBuffer(&bufferDesc, nullptr, &buffer->ConstantBuffersDX11[i])))
 			return -2;
+
+		MemoryTracker::Allocate(buffer, MEMORY_TAG_UNIFORMS, MEMORY_GPU, bufferSizes[i]);
 	}
 
 	return 0;
@@ -318,6 +323,8 @@ int DXContext::CreateConstantBuffers12(Buffer* buffer)
 		if (FAILED(result))
 			return -4;
 
+		MemoryTracker::Allocate(buffer, MEMORY_TAG_UNIFORMS, MEMORY_GPU, BYTE_ALIGN_BUFFER_DATA);
+
 		UINT bufferSizes[NR_OF_SHADERS];
 
 		bufferSizes[SHADER_ID_COLOR]      = sizeof(CBColorDX);
@@ -641,11 +648,11 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 	switch (textureType) {
 	case TEXTURE_2D:
 		arraySize = 1;
-		flags     = (fboType == FBO_UNKNOWN ? D3D11_RESOURCE_MISC_GENERATE_MIPS : 0);
+		flags     = 0;
 		mipLevels = (fboType == FBO_UNKNOWN ? texture->MipLevels() : 1);
 		break;
 	case TEXTURE_2D_ARRAY:
-		arraySize = MAX_LIGHT_SOURCES;
+		arraySize = MAX_DEPTH_LAYERS;
 		flags     = 0;
 		break;
 	case TEXTURE_CUBEMAP:
@@ -684,16 +691,20 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 
 	if (fboType == FBO_UNKNOWN)
 	{
-		std::vector<D3D11_SUBRESOURCE_DATA> textureData(pixels.size() * textureDesc.MipLevels);
+		// ONE PIXEL POINTER PER SUBRESOURCE (LAYER MAJOR), THE MIP CHAIN IS GENERATED ON THE CPU
+		std::vector<D3D11_SUBRESOURCE_DATA> textureData(textureDesc.ArraySize * textureDesc.MipLevels);
+
+		if (pixels.size() != textureData.size())
+			return -2;
 
-		for (size_t i = 0; i < pixels.size(); i++)
+		for (size_t i = 0; i < textureData.size(); i++)
 		{
-			for (uint32_t j = 0; j < textureDesc.MipLevels; j++)
-			{
-				textureData[i + j].pSysMem          = pixels[i];
-				textureData[i + j].SysMemPitch      = (textureDesc.Width * 4);
-				textureData[i + j].SysMemSlicePitch = (textureDesc.Width * textureDesc.Height * 4);
-			}
+			UINT mipWidth  = std::max((textureDesc.Width  >> (i % textureDesc.MipLevels)), 1u);
+			UINT mipHeight = std::max((textureDesc.Height >> (i % textureDesc.MipLevels)), 1u);
+
+			textureData[i].pSysMem          = pixels[i];
+			textureData[i].SysMemPitch      = (mipWidth * 4);
+			textureData[i].SysMemSlicePitch = (mipWidth * mipHeight * 4);
 		}
 
 		result = this->renderDevice11->CreateTexture2D(
@@ -704,7 +715,7 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 	}
 
 	if (FAILED(result))
-		return -2;
+		return -3;
 
 	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 
@@ -717,7 +728,7 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 		break;
 	case TEXTURE_2D_ARRAY:
 		srvDesc.ViewDimension            = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
-		srvDesc.Texture2DArray.ArraySize = MAX_LIGHT_SOURCES;
+		srvDesc.Texture2DArray.ArraySize = MAX_DEPTH_LAYERS;
 		srvDesc.Texture2DArray.MipLevels = 1;
 		break;
 	case TEXTURE_CUBEMAP:
@@ -739,10 +750,7 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 	);
 
 	if (FAILED(result))
-		return -3;
-
-	if ((textureType == TEXTURE_2D) && (fboType == FBO_UNKNOWN))
-		this->deviceContext->GenerateMips(texture->SRV11);
+		return -4;
 
 	samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
 	samplerDesc.MaxAnisotropy  = 16;
@@ -751,7 +759,7 @@ int DXContext::CreateTexture11(FBOType fboType, const std::vector<BYTE*> &pixels
 	result = this->renderDevice11->CreateSamplerState(&samplerDesc, &texture->SamplerState11);
 
 	if (FAILED(result))
-		return -4;
+		return -5;
 
 	return 0;
 }
@@ -788,7 +796,7 @@ int DXContext::CreateTextureBuffer11(FBOType fboType, DXGI_FORMAT format, D3D11_
 		depthBufferDesc.Format = DXGI_FORMAT_D16_UNORM;
 
 		// DEPTH BUFFER LAYERED VIEWS
-		for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (uint32_t i = 0; i < (texture->Type() == TEXTURE_2D_ARRAY ? MAX_DEPTH_LAYERS : MAX_LIGHT_SOURCES); i++)
 		{
 			switch (texture->Type()) {
 			case TEXTURE_2D_ARRAY:
@@ -822,7 +830,6 @@ int DXContext::CreateTextureBuffer11(FBOType fboType, DXGI_FORMAT format, D3D11_
 	return 0;
 }
 
-// TODO: Generate MipMaps
 int DXContext::CreateTexture12(FBOType fboType, const std::vector<BYTE*> &pixels, DXGI_FORMAT format, Texture* texture)
 {
 	if (texture == nullptr)
@@ -843,12 +850,15 @@ int DXContext::CreateTexture12(FBOType fboType, const std::vector<BYTE*> &pixels
 
 	switch (textureType) {
 		case TEXTURE_2D:            arraySize = 1; break;
-		case TEXTURE_2D_ARRAY:      arraySize = MAX_LIGHT_SOURCES; break;
+		case TEXTURE_2D_ARRAY:      arraySize = MAX_DEPTH_LAYERS; break;
 		case TEXTURE_CUBEMAP:       arraySize = MAX_TEXTURES; break;
 		case TEXTURE_CUBEMAP_ARRAY: arraySize = (MAX_LIGHT_SOURCES * MAX_TEXTURES); break;
 		default: throw;
 	}
 
+	if ((textureType == TEXTURE_2D) && (fboType == FBO_UNKNOWN))
+		mipLevels = texture->MipLevels();
+
 	D3D12_RESOURCE_DESC textureResourceDesc = {};
 	wxSize              textureSize         = texture->Size();
 
@@ -887,9 +897,13 @@ int DXContext::CreateTexture12(FBOType fboType, const std::vector<BYTE*> &pixels
 
 	if (fboType == FBO_UNKNOWN)
 	{
-		std::vector<D3D12_SUBRESOURCE_DATA> textureData(textureResourceDesc.DepthOrArraySize);
+		// ONE PIXEL POINTER PER SUBRESOURCE (LAYER MAJOR), THE MIP CHAIN IS GENERATED ON THE CPU
+		std::vector<D3D12_SUBRESOURCE_DATA> textureData(textureResourceDesc.DepthOrArraySize * mipLevels);
 		ID3D12Resource*                     textureResource = nullptr;
 
+		if (pixels.size() != textureData.size())
+			return -3;
+
 		result = this->renderDevice12->CreateCommittedResource(
 			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD), D3D12_HEAP_FLAG_NONE,
 			&CD3DX12_RESOURCE_DESC::Buffer(GetRequiredIntermediateSize(texture->Resource12, 0, textureData.size())),
@@ -897,13 +911,16 @@ int DXContext::CreateTexture12(FBOType fboType, const std::vector<BYTE*> &pixels
 		);
 
 		if (FAILED(result))
-			return -3;
+			return -4;
 
-		for (size_t i = 0; i < pixels.size(); i++)
+		for (size_t i = 0; i < textureData.size(); i++)
 		{
+			UINT64 mipWidth  = std::max((UINT64)(textureResourceDesc.Width  >> (i % mipLevels)), (UINT64)1);
+			UINT64 mipHeight = std::max((UINT64)(textureResourceDesc.Height >> (i % mipLevels)), (UINT64)1);
+
 			textureData[i].pData      = pixels[i];
-			textureData[i].RowPitch   = (textureResourceDesc.Width * 4);
-			textureData[i].SlicePitch = (textureResourceDesc.Width * textureResourceDesc.Height * 4);
+			textureData[i].RowPitch   = (LONG_PTR)(mipWidth * 4);
+			textureData[i].SlicePitch = (LONG_PTR)(mipWidth * mipHeight * 4);
 		}
 
 		this->commandsInit();
@@ -926,11 +943,11 @@ int DXContext::CreateTexture12(FBOType fboType, const std::vector<BYTE*> &pixels
 	switch (textureType) {
 	case TEXTURE_2D:
 		texture->SRVDesc12.ViewDimension       = D3D12_SRV_DIMENSION_TEXTURE2D;
-		texture->SRVDesc12.Texture2D.MipLevels = 1;
+		texture->SRVDesc12.Texture2D.MipLevels = mipLevels;
 		break;
 	case TEXTURE_2D_ARRAY:
 		texture->SRVDesc12.ViewDimension            = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
-		texture->SRVDesc12.Texture2DArray.ArraySize = MAX_LIGHT_SOURCES;
+		texture->SRVDesc12.Texture2DArray.ArraySize = MAX_DEPTH_LAYERS;
 		texture->SRVDesc12.Texture2DArray.MipLevels = 1;
 		break;
 	case TEXTURE_CUBEMAP:
@@ -992,7 +1009,7 @@ int DXContext::CreateTextureBuffer12(FBOType fboType, DXGI_FORMAT format, Textur
 		descHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
 
 		// DEPTH BUFFER LAYERED VIEWS
-		for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (uint32_t i = 0; i < (texture->Type() == TEXTURE_2D_ARRAY ? MAX_DEPTH_LAYERS : MAX_LIGHT_SOURCES); i++)
 		{
 			result = this->renderDevice12->CreateDescriptorHeap(
 				&descHeapDesc, IID_PPV_ARGS(&texture->DepthBuffers12[i])
@@ -1294,6 +1311,12 @@ int DXContext::Draw11(Component* mesh, ShaderProgram* shaderProgram, const DrawP
 
 	// VERTEX SHADER
 	this->deviceContext->VSSetShader(vertexShader, nullptr, 0);
+
+	if (vertexShader != this->boundShader11) {
+		this->boundShader11 = vertexShader;
+		RenderStats::AddProgramSwitch();
+	}
+
 	this->deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
 
 	// GEOMETRY SHADER
@@ -1314,8 +1337,10 @@ int DXContext::Draw11(Component* mesh, ShaderProgram* shaderProgram, const DrawP
 	case SHADER_ID_HUD:
 	case SHADER_ID_SKYBOX:
 		for (int i = 0; i < MAX_TEXTURES; i++) {
-			meshTextureSRVs[i]     = mesh->Textures[i]->SRV11;
-			meshTextureSamplers[i] = mesh->Textures[i]->SamplerState11;
+			Texture* texture = LightCluster::GetTexture(shaderID, mesh, i);
+
+			meshTextureSRVs[i]     = texture->SRV11;
+			meshTextureSamplers[i] = texture->SamplerState11;
 		}
 
 		this->deviceContext->PSSetShaderResources(0, MAX_TEXTURES, meshTextureSRVs);
@@ -1380,17 +1405,28 @@ int DXContext::Draw12(Component* mesh, ShaderProgram* shaderProgram, const DrawP
 		return -3;
 
 	// PIPELINE STATES AND SHADER ROOT SIGNATURES
+	ID3D12PipelineState* pipeline      = nullptr;
+	ID3D12RootSignature* rootSignature = nullptr;
+
 	if (properties.FBO != nullptr) {
 		if (properties.FBO->Type() == FBO_COLOR) {
-			this->commandList->SetPipelineState(vertexBuffer->PipelineStatesColorDX12[shaderID]);
-			this->commandList->SetGraphicsRootSignature(vertexBuffer->RootSignaturesColorDX12[shaderID]);
+			pipeline      = vertexBuffer->PipelineStatesColorDX12[shaderID];
+			rootSignature = vertexBuffer->RootSignaturesColorDX12[shaderID];
 		} else {
-			this->commandList->SetPipelineState(vertexBuffer->PipelineStatesDepthDX12[shaderID]);
-			this->commandList->SetGraphicsRootSignature(vertexBuffer->RootSignaturesDepthDX12[shaderID]);
+			pipeline      = vertexBuffer->PipelineStatesDepthDX12[shaderID];
+			rootSignature = vertexBuffer->RootSignaturesDepthDX12[shaderID];
 		}
 	} else {
-		this->commandList->SetPipelineState(vertexBuffer->PipelineStatesDX12[shaderID]);
-		this->commandList->SetGraphicsRootSignature(vertexBuffer->RootSignaturesDX12[shaderID]);
+		pipeline      = vertexBuffer->PipelineStatesDX12[shaderID];
+		rootSignature = vertexBuffer->RootSignaturesDX12[shaderID];
+	}
+
+	this->commandList->SetPipelineState(pipeline);
+	this->commandList->SetGraphicsRootSignature(rootSignature);
+
+	if (pipeline != this->boundPipeline12) {
+		this->boundPipeline12 = pipeline;
+		RenderStats::AddProgramSwitch();
 	}
 
 	// INDEX BUFFERS
@@ -1426,12 +1462,14 @@ int DXContext::Draw12(Component* mesh, ShaderProgram* shaderProgram, const DrawP
 		case SHADER_ID_SKYBOX:
 			for (int i = 0; i < MAX_TEXTURES; i++)
 			{
+				Texture* texture = LightCluster::GetTexture(shaderID, mesh, i);
+
 				this->renderDevice12->CreateShaderResourceView(
-					mesh->Textures[i]->Resource12, &mesh->Textures[i]->SRVDesc12, srvHandleCPU
+					texture->Resource12, &texture->SRVDesc12, srvHandleCPU
 				);
 				srvHandleCPU.Offset(1, cbvSrvDescSize);
 
-				this->renderDevice12->CreateSampler(&mesh->Textures[i]->SamplerDesc12, samplerHandleCPU);
+				this->renderDevice12->CreateSampler(&texture->SamplerDesc12, samplerHandleCPU);
 				samplerHandleCPU.Offset(1, samplerDescSize);
 			}
 			break;
@@ -1551,6 +1589,7 @@ D3D12_CLEAR_VALUE DXContext::getClearValueDX12(FBOType fboType, DXGI_FORMAT form
 
 bool DXContext::init11(bool vsync)
 {
+	this->boundShader11    = nullptr;
 	this->multiSampleCount = 16;
 	this->vSync            = vsync;
 
@@ -1689,6 +1728,7 @@ bool DXContext::init11(bool vsync)
 
 bool DXContext::init12(bool vsync)
 {
+	this->boundPipeline12  = nullptr;
 	this->multiSampleCount = 16;
 	this->vSync            = vsync;
 
@@ -2164,6 +2204,82 @@ void DXContext::SetVSync(bool enable)
 	this->vSync = enable;
 }
 
+// THE PIXELS HOLD THE WHOLE LEVEL 0 (RGBA8), ONLY THE REGION IS COPIED
+int DXContext::UpdateTexture11(Texture* texture, const uint8_t* pixels, const wxRect &region)
+{
+	if ((texture == nullptr) || (texture->Resource11 == nullptr) || (pixels == nullptr))
+		return -1;
+
+	D3D11_BOX box   = {};
+	UINT      pitch = (UINT)(texture->Size().GetWidth() * 4);
+
+	box.left   = (UINT)region.GetLeft();
+	box.top    = (UINT)region.GetTop();
+	box.right  = (UINT)(region.GetLeft() + region.GetWidth());
+	box.bottom = (UINT)(region.GetTop()  + region.GetHeight());
+	box.front  = 0;
+	box.back   = 1;
+
+	this->deviceContext->UpdateSubresource(
+		texture->Resource11, 0, &box, (pixels + ((size_t)box.top * pitch) + ((size_t)box.left * 4)), pitch, 0
+	);
+
+	return 0;
+}
+
+// THE VERTEX DATA KEEPS ITS SIZE, SO THE INPUT LAYOUTS AND STATES OF THE BUFFER ARE KEPT
+int DXContext::UpdateVertexBuffer11(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer)
+{
+	if ((buffer == nullptr) || (buffer->VertexBufferDX11 == nullptr))
+		return -1;
+
+	std::vector<float> vertexBufferData = Utils::ToVertexBufferData(vertices, normals, texCoords);
+
+	this->deviceContext->UpdateSubresource(buffer->VertexBufferDX11, 0, nullptr, &vertexBufferData[0], 0, 0);
+
+	return 0;
+}
+
+// THE VERTEX DATA KEEPS ITS SIZE, SO THE PIPELINES OF THE BUFFER ARE KEPT
+int DXContext::UpdateVertexBuffer12(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer)
+{
+	if ((buffer == nullptr) || (buffer->VertexBufferDX12 == nullptr))
+		return -1;
+
+	std::vector<float> vertexBufferData = Utils::ToVertexBufferData(vertices, normals, texCoords);
+	UINT               bufferSize       = (vertexBufferData.size() * sizeof(float));
+	ID3D12Resource*    bufferResource   = nullptr;
+
+	HRESULT result = this->renderDevice12->CreateCommittedResource(
+		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD), D3D12_HEAP_FLAG_NONE,
+		&CD3DX12_RESOURCE_DESC::Buffer(bufferSize), D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&bufferResource)
+	);
+
+	if (FAILED(result))
+		return -2;
+
+	D3D12_SUBRESOURCE_DATA bufferData = {};
+
+	bufferData.pData      = &vertexBufferData[0];
+	bufferData.RowPitch   = bufferSize;
+	bufferData.SlicePitch = bufferSize;
+
+	this->commandsInit();
+
+	this->transitionResource(buffer->VertexBufferDX12, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, D3D12_RESOURCE_STATE_COPY_DEST);
+
+	UpdateSubresources(this->commandList, buffer->VertexBufferDX12, bufferResource, 0, 0, 1, &bufferData);
+
+	this->transitionResource(buffer->VertexBufferDX12, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+
+	this->commandsExecute();
+	this->wait();
+
+	_RELEASEP(bufferResource);
+
+	return 0;
+}
+
 void DXContext::transitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES oldState, D3D12_RESOURCE_STATES newState)
 {
 	CD3DX12_RESOURCE_BARRIER resourceBarrier = CD3DX12_RESOURCE_BARRIER::Transition(resource, oldState, newState);
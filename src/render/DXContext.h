@@ -14,6 +14,8 @@ public:
 	~DXContext();
 
 private:
+	ID3D12PipelineState*       boundPipeline12;
+	ID3D11VertexShader*        boundShader11;
 	ID3D11RenderTargetView*    colorBuffer;
 	ID3D12Resource*            colorBuffers[NR_OF_FRAMEBUFFERS];
 	ID3D12DescriptorHeap*      colorBufferHeap;
@@ -68,6 +70,9 @@ public:
 	void Present11();
 	void Present12();
 	void SetVSync(bool enable);
+	int  UpdateTexture11(Texture* texture, const uint8_t* pixels, const wxRect &region);
+	int  UpdateVertexBuffer11(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer);
+	int  UpdateVertexBuffer12(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer);
 
 private:
 	int                      commandsExecute();
@@ -0,0 +1,367 @@
+#include "GPUTimer.h"
+
+bool               GPUTimer::Enabled        = false;
+uint64_t           GPUTimer::droppedFrames  = 0;
+GPUTimerFrame      GPUTimer::frames[GPU_TIMER_FRAMES];
+uint32_t           GPUTimer::frameIndex     = 0;
+std::mutex         GPUTimer::mutex;
+uint32_t           GPUTimer::openQueries[NR_OF_GPU_PASSES];
+HUD*               GPUTimer::overlay        = nullptr;
+long               GPUTimer::overlayUpdated = 0;
+bool               GPUTimer::overlayVisible = false;
+GLuint             GPUTimer::queriesGL[GPU_TIMER_FRAMES][GPU_TIMER_QUERIES];
+bool               GPUTimer::queriesResetVK[GPU_TIMER_FRAMES];
+VkQueryPool        GPUTimer::queryPoolVK    = nullptr;
+std::deque<double> GPUTimer::samples[NR_OF_GPU_PASSES];
+bool               GPUTimer::supported      = false;
+float              GPUTimer::timestampPeriod = 1.0f;
+
+void GPUTimer::Begin(GPUTimerPass pass, VkCommandBuffer cmdBuffer)
+{
+	if (!GPUTimer::Enabled || !GPUTimer::supported)
+		return;
+
+	GPUTimer::openQueries[pass] = GPUTimer::writeTimestamp(cmdBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+}
+
+void GPUTimer::BeginFrame()
+{
+	if (!GPUTimer::Enabled || !GPUTimer::supported)
+		return;
+
+	GPUTimer::frameIndex = ((GPUTimer::frameIndex + 1) % GPU_TIMER_FRAMES);
+
+	// READ BACK THE OLDEST FRAME IN THE RING ONE FRAME AHEAD, SO VULKAN CAN RESET ITS QUERIES IN THIS FRAME'S COMMAND BUFFER
+	uint32_t next = ((GPUTimer::frameIndex + 1) % GPU_TIMER_FRAMES);
+
+	GPUTimer::collect(next);
+
+	GPUTimer::frames[next].Intervals.clear();
+	GPUTimer::frames[next].NrOfQueries = 0;
+	GPUTimer::queriesResetVK[next]     = false;
+
+	for (uint32_t i = 0; i < NR_OF_GPU_PASSES; i++)
+		GPUTimer::openQueries[i] = GPU_TIMER_QUERIES;
+}
+
+void GPUTimer::Close()
+{
+	_DELETEP(GPUTimer::overlay);
+
+	// THE SELECTED API MAY ALREADY HAVE CHANGED - RELEASE WHATEVER WAS CREATED
+	if ((GPUTimer::queriesGL[0][0] > 0) && (RenderEngine::Canvas.GL != nullptr))
+		glDeleteQueries((GPU_TIMER_FRAMES * GPU_TIMER_QUERIES), &GPUTimer::queriesGL[0][0]);
+
+	if ((GPUTimer::queryPoolVK != nullptr) && (RenderEngine::Canvas.VK != nullptr))
+		RenderEngine::Canvas.VK->DestroyQueryPool(&GPUTimer::queryPoolVK);
+
+	std::memset(GPUTimer::queriesGL,      0, sizeof(GPUTimer::queriesGL));
+	std::memset(GPUTimer::queriesResetVK, 0, sizeof(GPUTimer::queriesResetVK));
+
+	GPUTimer::queryPoolVK = nullptr;
+	GPUTimer::supported   = false;
+
+	for (auto &frame : GPUTimer::frames) {
+		frame.Intervals.clear();
+		frame.NrOfQueries = 0;
+	}
+
+	std::lock_guard<std::mutex> lock(GPUTimer::mutex);
+
+	for (auto &passSamples : GPUTimer::samples)
+		passSamples.clear();
+}
+
+void GPUTimer::collect(uint32_t index)
+{
+	GPUTimerFrame &frame = GPUTimer::frames[index];
+
+	if (frame.Intervals.empty() || (frame.NrOfQueries == 0))
+		return;
+
+	std::vector<uint64_t> timestamps(frame.NrOfQueries);
+	double                nsPerTick = 1.0;
+
+	// NEVER STALL - DROP THE FRAME IF THE RESULTS ARE NOT AVAILABLE YET
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	case GRAPHICS_API_OPENGL:
+		{
+			GLint available = 0;
+			glGetQueryObjectiv(GPUTimer::queriesGL[index][frame.NrOfQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+			if (!available) {
+				GPUTimer::droppedFrames++;
+				return;
+			}
+
+			for (uint32_t i = 0; i < frame.NrOfQueries; i++)
+				glGetQueryObjectui64v(GPUTimer::queriesGL[index][i], GL_QUERY_RESULT, &timestamps[i]);
+		}
+		break;
+	case GRAPHICS_API_VULKAN:
+		if (RenderEngine::Canvas.VK->GetQueryResults(GPUTimer::queryPoolVK, (index * GPU_TIMER_QUERIES), frame.NrOfQueries, timestamps.data()) != 0) {
+			GPUTimer::droppedFrames++;
+			return;
+		}
+
+		nsPerTick = (double)GPUTimer::timestampPeriod;
+		break;
+	default:
+		return;
+	}
+
+	double passTimes[NR_OF_GPU_PASSES] = {};
+	bool   measured[NR_OF_GPU_PASSES]  = {};
+
+	for (const auto &interval : frame.Intervals)
+	{
+		if (timestamps[interval.End] < timestamps[interval.Begin])
+			continue;
+
+		double timeMS = ((double)(timestamps[interval.End] - timestamps[interval.Begin]) * nsPerTick / 1000000.0);
+
+		passTimes[interval.Pass]     += timeMS;
+		passTimes[GPU_PASS_TOTAL]    += timeMS;
+		measured[interval.Pass]       = true;
+		measured[GPU_PASS_TOTAL]      = true;
+	}
+
+	std::lock_guard<std::mutex> lock(GPUTimer::mutex);
+
+	for (uint32_t i = 0; i < NR_OF_GPU_PASSES; i++)
+	{
+		if (!measured[i])
+			continue;
+
+		GPUTimer::samples[i].push_back(passTimes[i]);
+
+		if (GPUTimer::samples[i].size() > GPU_TIMER_SAMPLES)
+			GPUTimer::samples[i].pop_front();
+	}
+}
+
+uint64_t GPUTimer::DroppedFrames()
+{
+	return GPUTimer::droppedFrames;
+}
+
+void GPUTimer::End(GPUTimerPass pass, VkCommandBuffer cmdBuffer)
+{
+	if (!GPUTimer::Enabled || !GPUTimer::supported || (GPUTimer::openQueries[pass] >= GPU_TIMER_QUERIES))
+		return;
+
+	uint32_t query = GPUTimer::writeTimestamp(cmdBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+	if (query < GPU_TIMER_QUERIES)
+	{
+		GPUTimerInterval interval = {};
+
+		interval.Begin = GPUTimer::openQueries[pass];
+		interval.End   = query;
+		interval.Pass  = pass;
+
+		GPUTimer::frames[GPUTimer::frameIndex].Intervals.push_back(interval);
+	}
+
+	GPUTimer::openQueries[pass] = GPU_TIMER_QUERIES;
+}
+
+int GPUTimer::Init()
+{
+	GPUTimer::Close();
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	case GRAPHICS_API_OPENGL:
+		GPUTimer::supported = (GLEW_VERSION_3_3 || GLEW_ARB_timer_query);
+
+		if (GPUTimer::supported)
+			glGenQueries((GPU_TIMER_FRAMES * GPU_TIMER_QUERIES), &GPUTimer::queriesGL[0][0]);
+
+		break;
+	case GRAPHICS_API_VULKAN:
+		GPUTimer::timestampPeriod = RenderEngine::Canvas.VK->TimestampPeriod();
+
+		if (GPUTimer::timestampPeriod > 0.0f)
+			GPUTimer::queryPoolVK = RenderEngine::Canvas.VK->CreateQueryPool(GPU_TIMER_FRAMES * GPU_TIMER_QUERIES);
+
+		// THE INITIAL RESET IS SUBMITTED ON ITS OWN, LATER RESETS ARE RECORDED INTO THE FRAME COMMAND BUFFERS
+		if (GPUTimer::queryPoolVK != nullptr)
+		{
+			RenderEngine::Canvas.VK->ResetQueryPool(GPUTimer::queryPoolVK, 0, (GPU_TIMER_FRAMES * GPU_TIMER_QUERIES));
+
+			for (uint32_t i = 0; i < GPU_TIMER_FRAMES; i++)
+				GPUTimer::queriesResetVK[i] = true;
+		}
+
+		GPUTimer::supported = (GPUTimer::queryPoolVK != nullptr);
+
+		break;
+	default:
+		GPUTimer::supported = false;
+		break;
+	}
+
+	GPUTimer::frameIndex = 0;
+
+	for (uint32_t i = 0; i < NR_OF_GPU_PASSES; i++)
+		GPUTimer::openQueries[i] = GPU_TIMER_QUERIES;
+
+	return (GPUTimer::supported ? 0 : -1);
+}
+
+bool GPUTimer::IsSupported()
+{
+	return GPUTimer::supported;
+}
+
+Component* GPUTimer::Overlay()
+{
+	return ((GPUTimer::overlay != nullptr) && !GPUTimer::overlay->Children.empty() ? GPUTimer::overlay->Children[0] : nullptr);
+}
+
+wxString GPUTimer::PassName(GPUTimerPass pass)
+{
+	switch (pass) {
+		case GPU_PASS_SHADOWS: return "Shadows";
+		case GPU_PASS_WATER:   return "Water";
+		case GPU_PASS_SCENE:   return "Scene";
+		case GPU_PASS_HUDS:    return "HUDs";
+		case GPU_PASS_TOTAL:   return "Total";
+		default: throw;
+	}
+
+	return "";
+}
+
+// CALLED BY VKContext::Clear BEFORE THE RENDER PASS OF THE FRAME BEGINS - QUERIES HAVE TO BE RESET OUTSIDE OF A RENDER PASS
+void GPUTimer::ResetQueries(VkCommandBuffer cmdBuffer)
+{
+	if (!GPUTimer::Enabled || !GPUTimer::supported || (GPUTimer::queryPoolVK == nullptr) || (cmdBuffer == nullptr))
+		return;
+
+	uint32_t next = ((GPUTimer::frameIndex + 1) % GPU_TIMER_FRAMES);
+
+	if (GPUTimer::queriesResetVK[next])
+		return;
+
+	RenderEngine::Canvas.VK->ResetQueryPool(GPUTimer::queryPoolVK, (next * GPU_TIMER_QUERIES), GPU_TIMER_QUERIES, cmdBuffer);
+
+	GPUTimer::queriesResetVK[next] = true;
+}
+
+void GPUTimer::ShowOverlay(bool show)
+{
+	GPUTimer::Enabled        = show;
+	GPUTimer::overlayVisible = show;
+
+	if (!show) {
+		RenderThreadLock lock;
+		_DELETEP(GPUTimer::overlay);
+	}
+}
+
+GPUTimerStats GPUTimer::Stats(GPUTimerPass pass)
+{
+	GPUTimerStats       stats = {};
+	std::vector<double> sorted;
+
+	{
+		std::lock_guard<std::mutex> lock(GPUTimer::mutex);
+		sorted = std::vector<double>(GPUTimer::samples[pass].begin(), GPUTimer::samples[pass].end());
+	}
+
+	if (sorted.empty())
+		return stats;
+
+	stats.LastMS  = sorted.back();
+	stats.Samples = (int)sorted.size();
+
+	std::sort(sorted.begin(), sorted.end());
+
+	for (auto sample : sorted)
+		stats.AvgMS += sample;
+
+	stats.AvgMS /= (double)sorted.size();
+	stats.MaxMS  = sorted.back();
+	stats.P50MS  = sorted[(size_t)(0.50 * (double)(sorted.size() - 1))];
+	stats.P95MS  = sorted[(size_t)(0.95 * (double)(sorted.size() - 1))];
+	stats.P99MS  = sorted[(size_t)(0.99 * (double)(sorted.size() - 1))];
+
+	return stats;
+}
+
+void GPUTimer::UpdateOverlay()
+{
+	if (!GPUTimer::overlayVisible || !GPUTimer::supported)
+		return;
+
+	// THE CHANGED TEXT REGION IS UPLOADED ON EVERY UPDATE - LIMIT IT TO TWICE PER SECOND SO THE NUMBERS STAY READABLE
+	long now = TimeManager::TimeElapsedMS();
+
+	if ((GPUTimer::overlay != nullptr) && ((now - GPUTimer::overlayUpdated) < 500))
+		return;
+
+	RenderThreadLock lock;
+
+	if (GPUTimer::overlay == nullptr)
+	{
+		GPUTimer::overlay = new HUD(Utils::RESOURCE_MODELS[ID_ICON_QUAD]);
+
+		if (!GPUTimer::overlay->IsValid()) {
+			_DELETEP(GPUTimer::overlay);
+			GPUTimer::overlayVisible = false;
+			return;
+		}
+
+		GPUTimer::overlay->Transparent = true;
+		GPUTimer::overlay->TextAlign   = Utils::ALIGNMENTS[0];
+		GPUTimer::overlay->TextColor   = *wxWHITE;
+		GPUTimer::overlay->TextSize    = 10;
+
+		// TOP-LEFT CORNER
+		glm::vec3 position = GPUTimer::overlay->Children[0]->Position();
+		GPUTimer::overlay->Children[0]->MoveTo(glm::vec3(-position.x, position.y, position.z));
+	}
+
+	wxString text = "GPU (avg / p95 ms)\n";
+
+	for (int i = 0; i < NR_OF_GPU_PASSES; i++) {
+		GPUTimerStats stats = GPUTimer::Stats((GPUTimerPass)i);
+		text.append(wxString::Format("%s: %.3f / %.3f\n", GPUTimer::PassName((GPUTimerPass)i), stats.AvgMS, stats.P95MS));
+	}
+
+	GPUTimer::overlay->Update(text);
+	GPUTimer::overlayUpdated = now;
+}
+
+uint32_t GPUTimer::writeTimestamp(VkCommandBuffer cmdBuffer, VkPipelineStageFlagBits stage)
+{
+	GPUTimerFrame &frame = GPUTimer::frames[GPUTimer::frameIndex];
+
+	if (frame.NrOfQueries >= GPU_TIMER_QUERIES)
+		return GPU_TIMER_QUERIES;
+
+	uint32_t query = frame.NrOfQueries;
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	case GRAPHICS_API_OPENGL:
+		glQueryCounter(GPUTimer::queriesGL[GPUTimer::frameIndex][query], GL_TIMESTAMP);
+		break;
+	case GRAPHICS_API_VULKAN:
+		// SKIP THE FRAME IF THE PREVIOUS FRAME DIDN'T GET TO RESET ITS QUERIES
+		if (!GPUTimer::queriesResetVK[GPUTimer::frameIndex])
+			return GPU_TIMER_QUERIES;
+
+		if (cmdBuffer == nullptr)
+			cmdBuffer = RenderEngine::Canvas.VK->CommandBuffer();
+
+		vkCmdWriteTimestamp(cmdBuffer, stage, GPUTimer::queryPoolVK, ((GPUTimer::frameIndex * GPU_TIMER_QUERIES) + query));
+		break;
+	default:
+		return GPU_TIMER_QUERIES;
+	}
+
+	frame.NrOfQueries++;
+
+	return query;
+}
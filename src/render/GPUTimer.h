@@ -0,0 +1,87 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_GPUTIMER_H
+#define S3DE_GPUTIMER_H
+
+enum GPUTimerPass
+{
+	GPU_PASS_SHADOWS, GPU_PASS_WATER, GPU_PASS_SCENE, GPU_PASS_HUDS, GPU_PASS_TOTAL, NR_OF_GPU_PASSES
+};
+
+const uint32_t GPU_TIMER_FRAMES  = 4;
+const uint32_t GPU_TIMER_QUERIES = 64;
+const uint32_t GPU_TIMER_SAMPLES = 240;
+
+struct GPUTimerInterval
+{
+	uint32_t     Begin = 0;
+	uint32_t     End   = 0;
+	GPUTimerPass Pass  = GPU_PASS_TOTAL;
+};
+
+struct GPUTimerFrame
+{
+	std::vector<GPUTimerInterval> Intervals;
+	uint32_t                      NrOfQueries = 0;
+};
+
+struct GPUTimerStats
+{
+	double AvgMS   = 0.0;
+	double LastMS  = 0.0;
+	double MaxMS   = 0.0;
+	double P50MS   = 0.0;
+	double P95MS   = 0.0;
+	double P99MS   = 0.0;
+	int    Samples = 0;
+};
+
+class GPUTimer
+{
+private:
+	GPUTimer()  {}
+	~GPUTimer() {}
+
+public:
+	static bool Enabled;
+
+private:
+	static uint64_t           droppedFrames;
+	static GPUTimerFrame      frames[GPU_TIMER_FRAMES];
+	static uint32_t           frameIndex;
+	static std::mutex         mutex;
+	static uint32_t           openQueries[NR_OF_GPU_PASSES];
+	static HUD*               overlay;
+	static long               overlayUpdated;
+	static bool               overlayVisible;
+	static GLuint             queriesGL[GPU_TIMER_FRAMES][GPU_TIMER_QUERIES];
+	static bool               queriesResetVK[GPU_TIMER_FRAMES];
+	static VkQueryPool        queryPoolVK;
+	static std::deque<double> samples[NR_OF_GPU_PASSES];
+	static bool               supported;
+	static float              timestampPeriod;
+
+public:
+	static void          Begin(GPUTimerPass pass, VkCommandBuffer cmdBuffer = nullptr);
+	static void          BeginFrame();
+	static void          Close();
+	static uint64_t      DroppedFrames();
+	static void          End(GPUTimerPass pass, VkCommandBuffer cmdBuffer = nullptr);
+	static int           Init();
+	static bool          IsSupported();
+	static Component*    Overlay();
+	static wxString      PassName(GPUTimerPass pass);
+	static void          ResetQueries(VkCommandBuffer cmdBuffer);
+	static void          ShowOverlay(bool show);
+	static GPUTimerStats Stats(GPUTimerPass pass);
+	static void          UpdateOverlay();
+
+private:
+	static void     collect(uint32_t index);
+	static uint32_t writeTimestamp(VkCommandBuffer cmdBuffer, VkPipelineStageFlagBits stage);
+
+};
+
+#endif
@@ -0,0 +1,376 @@
+#include "HUDBatch.h"
+
+int                       HUDBatch::GlyphSlot   = 4;
+int                       HUDBatch::MinCapacity = 64;
+int                       HUDBatch::PageSize    = 2048;
+HUD*                      HUDBatch::batch       = nullptr;
+std::vector<HUDBatchItem> HUDBatch::items;
+std::vector<HUDBatchPage> HUDBatch::pages;
+HUDBatchStats             HUDBatch::stats;
+
+void HUDBatch::Close()
+{
+	HUDBatch::setGlyphTexture(nullptr);
+
+	_DELETEP(HUDBatch::batch);
+
+	HUDBatch::items.clear();
+	HUDBatch::pages.clear();
+
+	HUDBatch::stats = {};
+}
+
+// THE SHADER USED TO REPLACE THE ALPHA OF OPAQUE HUDS WITH THE MATERIAL ALPHA PER DRAW - NOW IT'S DONE WHEN COPYING
+void HUDBatch::copyPixels(const HUDBatchItem &item, const wxRect &region)
+{
+	HUDBatchPage   &page   = HUDBatch::pages[item.Page];
+	const uint8_t*  pixels = item.Item->Pixels();
+	wxRect          rect   = wxRect(item.Rect.GetSize()).Intersect(region);
+	bool            opaque = !item.Item->Transparent;
+	float           alpha  = glm::clamp(item.Item->Children[0]->ComponentMaterial.diffuse.a, 0.0f, 1.0f);
+
+	if ((pixels == nullptr) || rect.IsEmpty())
+		return;
+
+	for (int y = rect.GetTop(); y <= rect.GetBottom(); y++)
+	{
+		const uint8_t* source = (pixels + ((((size_t)y * item.Rect.GetWidth()) + rect.GetX()) * 4));
+		uint8_t*       target = (page.Pixels.data() + ((((size_t)(item.Rect.GetY() + y) * page.Size.GetWidth()) + item.Rect.GetX() + rect.GetX()) * 4));
+
+		memcpy(target, source, ((size_t)rect.GetWidth() * 4));
+
+		for (int x = 0; opaque && (x < rect.GetWidth()); x++)
+			target[(x * 4) + 3] = (uint8_t)((alpha * 255.0f) + 0.5f);
+	}
+}
+
+std::vector<HUD*> HUDBatch::getHUDs()
+{
+	std::vector<Component*> planes  = RenderThread::GetHUDs();
+	Component*              overlay = GPUTimer::Overlay();
+	std::vector<HUD*>       huds;
+
+	// THE OVERLAY IS THE TOP LAYER
+	if (overlay != nullptr)
+		planes.push_back(overlay);
+
+	for (auto plane : planes)
+	{
+		HUD* hud = dynamic_cast<HUD*>(plane->Parent);
+
+		if ((hud != nullptr) && (hud->Pixels() != nullptr))
+			huds.push_back(hud);
+	}
+
+	return huds;
+}
+
+// ONE QUAD PER HUD AND ONE PER GLYPH OF ITS TEXT, TRANSFORMED BY THE MODEL MATRIX OF THE HUD, SO THE BATCH IS DRAWN WITH
+// AN IDENTITY MODEL MATRIX. THE UNUSED QUADS UP TO THE CAPACITY ARE EMPTY. RETURNS THE NUMBER OF QUADS USED.
+int HUDBatch::getQuads(int page, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices)
+{
+	const float   corners[4][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+	const wxSize &pageSize      = HUDBatch::pages[page].Size;
+	Texture*      glyphTexture  = GlyphAtlas::GetTexture();
+	int           quads         = 0;
+
+	for (const auto &item : HUDBatch::items)
+	{
+		if (item.Page != page)
+			continue;
+
+		// SELECTED HUDS ARE NOT DRAWN - THE QUADS ARE COLLAPSED SO THE BUFFER KEEPS ITS SIZE
+		Component* plane   = item.Item->Children[0];
+		bool       visible = !RenderThread::IsSelected(plane);
+		glm::mat4  matrix  = RenderThread::GetMatrix(plane);
+
+		for (const auto &corner : corners)
+		{
+			glm::vec4 position = (visible ? (matrix * glm::vec4(corner[0], corner[1], 0.0f, 1.0f)) : glm::vec4(0.0f));
+			float     u        = ((corner[0] + 1.0f) * 0.5f);
+			float     v        = ((corner[1] + 1.0f) * 0.5f);
+
+			normals.insert(normals.end(), { 0.0f, 0.0f, 1.0f });
+
+			textureCoords.push_back(((float)item.Rect.GetX() + (u * (float)item.Rect.GetWidth()))  / (float)pageSize.GetWidth());
+			textureCoords.push_back(((float)item.Rect.GetY() + (v * (float)item.Rect.GetHeight())) / (float)pageSize.GetHeight());
+
+			vertices.insert(vertices.end(), { position.x, position.y, 0.0f });
+		}
+
+		quads++;
+
+		// THE TEXT OF OPAQUE HUDS FADES WITH THE MATERIAL ALPHA, LIKE THE BACKGROUND
+		const std::vector<GlyphInstance> &glyphs = item.Item->Glyphs();
+		const wxColour                   &color  = item.Item->TextColor;
+		float                             alpha  = ((float)color.Alpha() / 255.0f);
+
+		if (!item.Item->Transparent)
+			alpha *= glm::clamp(plane->ComponentMaterial.diffuse.a, 0.0f, 1.0f);
+
+		if ((glyphTexture == nullptr) || (alpha <= 0.0f))
+			continue;
+
+		glm::vec3 rgb       = (glm::vec3((float)color.Red(), (float)color.Green(), (float)color.Blue()) / 255.0f);
+		wxSize    glyphSize = glyphTexture->Size();
+		wxSize    hudSize   = item.Rect.GetSize();
+
+		for (const auto &glyph : glyphs)
+		{
+			// THE TARGET IS TOP-DOWN IN HUD PIXELS, THE PLANE IS -1 TO 1 WITH Y UP
+			float left   = ((((float)glyph.Target.GetX() / (float)hudSize.GetWidth()) * 2.0f) - 1.0f);
+			float right  = ((((float)(glyph.Target.GetX() + glyph.Target.GetWidth()) / (float)hudSize.GetWidth()) * 2.0f) - 1.0f);
+			float top    = (1.0f - (((float)glyph.Target.GetY() / (float)hudSize.GetHeight()) * 2.0f));
+			float bottom = (1.0f - (((float)(glyph.Target.GetY() + glyph.Target.GetHeight()) / (float)hudSize.GetHeight()) * 2.0f));
+
+			float u0 = ((float)glyph.Source.GetX() / (float)glyphSize.GetWidth());
+			float u1 = ((float)(glyph.Source.GetX() + glyph.Source.GetWidth()) / (float)glyphSize.GetWidth());
+			float v0 = ((float)glyph.Source.GetY() / (float)glyphSize.GetHeight());
+			float v1 = ((float)(glyph.Source.GetY() + glyph.Source.GetHeight()) / (float)glyphSize.GetHeight());
+
+			const float glyphCorners[4][4] = { { left, bottom, u0, v1 }, { right, bottom, u1, v1 }, { right, top, u1, v0 }, { left, top, u0, v0 } };
+
+			for (const auto &corner : glyphCorners)
+			{
+				glm::vec4 position = (visible ? (matrix * glm::vec4(corner[0], corner[1], 0.0f, 1.0f)) : glm::vec4(0.0f));
+
+				normals.insert(normals.end(),             { rgb.r, rgb.g, rgb.b });
+				textureCoords.insert(textureCoords.end(), { corner[2], corner[3] });
+				vertices.insert(vertices.end(),           { position.x, position.y, alpha });
+			}
+
+			quads++;
+		}
+	}
+
+	int capacity = std::max(quads, HUDBatch::pages[page].Capacity);
+
+	normals.resize(((size_t)capacity * 12), 0.0f);
+	textureCoords.resize(((size_t)capacity * 8), 0.0f);
+	vertices.resize(((size_t)capacity * 12), 0.0f);
+
+	return quads;
+}
+
+std::vector<Component*> HUDBatch::Meshes()
+{
+	return (HUDBatch::batch != nullptr ? HUDBatch::batch->Children : std::vector<Component*>());
+}
+
+// SHELF PACKING IN LAYER ORDER - A HUD THAT DOESN'T FIT STARTS A NEW PAGE
+void HUDBatch::pack(const std::vector<HUD*> &huds)
+{
+	const int padding = 2;
+
+	HUDBatch::setGlyphTexture(nullptr);
+
+	_DELETEP(HUDBatch::batch);
+
+	HUDBatch::items.clear();
+	HUDBatch::pages.clear();
+
+	HUDBatch::stats.Pages = 0;
+	HUDBatch::stats.Quads = 0;
+
+	if (huds.empty())
+		return;
+
+	int shelfHeight = 0;
+	int shelfX      = 0;
+	int shelfY      = 0;
+
+	HUDBatch::pages.resize(1);
+
+	for (auto hud : huds)
+	{
+		wxSize size = hud->PixelSize();
+
+		if ((shelfX > 0) && ((shelfX + size.GetWidth()) > HUDBatch::PageSize)) {
+			shelfX       = 0;
+			shelfY      += (shelfHeight + padding);
+			shelfHeight  = 0;
+		}
+
+		if ((shelfY > 0) && ((shelfY + size.GetHeight()) > HUDBatch::PageSize)) {
+			HUDBatch::pages.push_back({});
+
+			shelfHeight = 0;
+			shelfX      = 0;
+			shelfY      = 0;
+		}
+
+		HUDBatchItem  item;
+		HUDBatchPage &page = HUDBatch::pages.back();
+
+		item.Item = hud;
+		item.Page = (int)(HUDBatch::pages.size() - 1);
+		item.Rect = wxRect(wxPoint(shelfX, shelfY), size);
+
+		page.Capacity += (1 + (int)hud->Glyphs().size());
+		page.Size      = wxSize(std::max(page.Size.GetWidth(), (item.Rect.GetRight() + 1)), std::max(page.Size.GetHeight(), (item.Rect.GetBottom() + 1)));
+
+		HUDBatch::items.push_back(item);
+
+		shelfHeight  = std::max(shelfHeight, size.GetHeight());
+		shelfX      += (size.GetWidth() + padding);
+	}
+
+	// THE ALPHA OF THE OPAQUE HUDS IS IN THE ATLAS, SO THE BATCH IS DRAWN AS TRANSPARENT
+	HUDBatch::batch              = new HUD();
+	HUDBatch::batch->Transparent = true;
+
+	for (int i = 0; i < (int)HUDBatch::pages.size(); i++)
+	{
+		HUDBatchPage &page     = HUDBatch::pages[i];
+		int           capacity = HUDBatch::MinCapacity;
+
+		// ROOM FOR LONGER TEXT BEFORE THE BUFFER HAS TO GROW (POWER OF TWO QUADS)
+		while (capacity < page.Capacity)
+			capacity *= 2;
+
+		page.Capacity = capacity;
+
+		page.Pixels.assign(((size_t)page.Size.GetWidth() * (size_t)page.Size.GetHeight() * 4), 0);
+
+		for (const auto &item : HUDBatch::items)
+		{
+			if (item.Page != i)
+				continue;
+
+			item.Item->TakeDirtyRegion();
+			HUDBatch::copyPixels(item, wxRect(item.Rect.GetSize()));
+		}
+
+		CompressedImage image;
+
+		image.Height = page.Size.GetHeight();
+		image.Layers = 1;
+		image.Width  = page.Size.GetWidth();
+
+		image.Levels.resize(1);
+		image.Levels[0].Data   = page.Pixels;
+		image.Levels[0].Height = image.Height;
+		image.Levels[0].Width  = image.Width;
+
+		std::vector<unsigned int> indices;
+		int                       quads = HUDBatch::getQuads(i, page.Normals, page.TextureCoords, page.Vertices);
+
+		for (unsigned int quad = 0; quad < (unsigned int)page.Capacity; quad++) {
+			unsigned int first = (quad * 4);
+			indices.insert(indices.end(), { first, (first + 1), (first + 2), first, (first + 2), (first + 3) });
+		}
+
+		page.Atlas = new Texture(image);
+		page.Quads = new Mesh(HUDBatch::batch, "HUD Batch");
+
+		page.Quads->LoadArrays(indices, page.Normals, page.TextureCoords, page.Vertices, BOUNDING_VOLUME_NONE);
+		page.Quads->LoadTexture(page.Atlas, 5);
+
+		HUDBatch::batch->Children.push_back(page.Quads);
+
+		HUDBatch::stats.Quads += quads;
+	}
+
+	HUDBatch::setGlyphTexture(GlyphAtlas::GetTexture());
+
+	HUDBatch::stats.Pages = (int)HUDBatch::pages.size();
+	HUDBatch::stats.Repacks++;
+}
+
+// THE GLYPH ATLAS OWNS ITS TEXTURE, SO IT'S SET DIRECTLY AND DETACHED BEFORE THE BATCH IS DELETED
+void HUDBatch::setGlyphTexture(Texture* texture)
+{
+	for (auto &page : HUDBatch::pages) {
+		if (page.Quads != nullptr)
+			page.Quads->Textures[HUDBatch::GlyphSlot] = (texture != nullptr ? texture : SceneManager::EmptyTexture);
+	}
+}
+
+HUDBatchStats HUDBatch::Stats()
+{
+	return HUDBatch::stats;
+}
+
+// CALLED BEFORE THE FRAME IS RECORDED, SO THE ATLAS, GLYPH AND VERTEX UPLOADS DON'T TOUCH RESOURCES THE FRAME USES
+void HUDBatch::Update()
+{
+	PROFILE_SCOPE("HUDBatch::Update");
+
+	// THE NEW GLYPHS OF THE TEXT ARE UPLOADED FIRST
+	GlyphAtlas::Update();
+
+	std::vector<HUD*> huds = HUDBatch::getHUDs();
+
+	// A NEW ATLAS WHEN A HUD WAS ADDED, REMOVED OR RESIZED
+	bool repack = (huds.size() != HUDBatch::items.size());
+
+	for (size_t i = 0; !repack && (i < huds.size()); i++)
+		repack = ((huds[i] != HUDBatch::items[i].Item) || (huds[i]->PixelSize() != HUDBatch::items[i].Rect.GetSize()));
+
+	if (repack) {
+		HUDBatch::pack(huds);
+		return;
+	}
+
+	// THE GLYPH TEXTURE IS RECREATED WHEN THE GLYPH ATLAS GROWS
+	HUDBatch::setGlyphTexture(GlyphAtlas::GetTexture());
+
+	// ONLY THE CHANGED REGIONS ARE COPIED AND UPLOADED
+	std::vector<wxRect> dirty(HUDBatch::pages.size());
+
+	for (const auto &item : HUDBatch::items)
+	{
+		wxRect region = wxRect(item.Rect.GetSize()).Intersect(item.Item->TakeDirtyRegion());
+
+		if (region.IsEmpty())
+			continue;
+
+		HUDBatch::copyPixels(item, region);
+
+		region.Offset(item.Rect.GetPosition());
+
+		dirty[item.Page] = (dirty[item.Page].IsEmpty() ? region : dirty[item.Page].Union(region));
+	}
+
+	HUDBatch::stats.Quads = 0;
+
+	for (int i = 0; i < (int)HUDBatch::pages.size(); i++)
+	{
+		HUDBatchPage &page = HUDBatch::pages[i];
+
+		// START OVER ON THE NEXT FRAME IF THE ATLAS CAN'T BE UPDATED IN PLACE
+		if (!dirty[i].IsEmpty() && (page.Atlas->UpdatePixels(page.Pixels.data(), dirty[i]) < 0)) {
+			HUDBatch::items.clear();
+			return;
+		}
+
+		std::vector<float> normals;
+		std::vector<float> textureCoords;
+		std::vector<float> vertices;
+
+		int quads = HUDBatch::getQuads(i, normals, textureCoords, vertices);
+
+		// A BIGGER BUFFER WHEN THE TEXT OUTGREW IT
+		if (quads > page.Capacity) {
+			HUDBatch::pack(huds);
+			return;
+		}
+
+		HUDBatch::stats.Quads += quads;
+
+		// THE QUADS ARE ONLY UPLOADED WHEN A HUD MOVED, WAS SELECTED OR DESELECTED, OR ITS TEXT CHANGED
+		if ((vertices == page.Vertices) && (normals == page.Normals) && (textureCoords == page.TextureCoords))
+			continue;
+
+		if (page.Quads->UpdateArrays(normals, textureCoords, vertices) < 0) {
+			HUDBatch::items.clear();
+			return;
+		}
+
+		page.Normals       = normals;
+		page.TextureCoords = textureCoords;
+		page.Vertices      = vertices;
+
+		HUDBatch::stats.Uploads++;
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_HUDBATCH_H
+#define S3DE_HUDBATCH_H
+
+struct HUDBatchItem
+{
+	HUD*   Item = nullptr;
+	int    Page = 0;
+	wxRect Rect;	// IN THE ATLAS PAGE, ROWS BOTTOM-UP
+};
+
+struct HUDBatchPage
+{
+	Texture*             Atlas    = nullptr;	// OWNED BY THE MESH
+	int                  Capacity = 0;	// QUADS IN THE VERTEX BUFFER
+	std::vector<float>   Normals;	// LAST UPLOADED
+	Mesh*                Quads    = nullptr;
+	std::vector<uint8_t> Pixels;	// RGBA8, ROWS BOTTOM-UP
+	wxSize               Size;
+	std::vector<float>   TextureCoords;	// LAST UPLOADED
+	std::vector<float>   Vertices;	// LAST UPLOADED
+};
+
+struct HUDBatchStats
+{
+	int      Pages   = 0;
+	int      Quads   = 0;
+	uint64_t Repacks = 0;
+	uint64_t Uploads = 0;
+};
+
+// THE BACKGROUND PIXELS OF ALL THE HUDS ARE PACKED INTO SHARED ATLAS PAGES, AND THE QUADS OF EACH PAGE ARE TRANSFORMED ON
+// THE CPU INTO ONE DYNAMIC VERTEX BUFFER, SO EACH PAGE IS ONE DRAW. THE TEXT OF EACH HUD IS ONE QUAD PER GLYPH AFTER ITS
+// BACKGROUND QUAD, SAMPLED FROM THE GLYPH ATLAS PAGE IN TEXTURE SLOT 4 - THE NORMAL IS THE TEXT COLOR AND Z THE TEXT ALPHA.
+// THE PAGES ARE FILLED IN LAYER ORDER - THE SCENE HUDS IN SCENE ORDER, THE GPU TIMER OVERLAY LAST - SO DRAWING THE PAGES
+// IN ORDER KEEPS THE HUDS IN ORDER.
+class HUDBatch
+{
+private:
+	HUDBatch()  {}
+	~HUDBatch() {}
+
+public:
+	static int GlyphSlot;
+	static int MinCapacity;
+	static int PageSize;
+
+private:
+	static HUD*                      batch;
+	static std::vector<HUDBatchItem> items;
+	static std::vector<HUDBatchPage> pages;
+	static HUDBatchStats             stats;
+
+public:
+	static void                    Close();
+	static std::vector<Component*> Meshes();
+	static HUDBatchStats           Stats();
+	static void                    Update();
+
+private:
+	static void              copyPixels(const HUDBatchItem &item, const wxRect &region);
+	static std::vector<HUD*> getHUDs();
+	static int               getQuads(int page, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices);
+	static void              pack(const std::vector<HUD*> &huds);
+	static void              setGlyphTexture(Texture* texture);
+
+};
+
+#endif
@@ -0,0 +1,156 @@
+#include "Headless.h"
+
+bool         Headless::Enabled = false;
+FrameBuffer* Headless::target  = nullptr;
+
+#if !defined _WINDOWS
+	EGLContext Headless::eglContext = EGL_NO_CONTEXT;
+	EGLDisplay Headless::eglDisplay = EGL_NO_DISPLAY;
+	EGLSurface Headless::eglSurface = EGL_NO_SURFACE;
+#endif
+
+void Headless::Bind()
+{
+	if (Headless::target != nullptr)
+		Headless::target->Bind();
+}
+
+void Headless::Close()
+{
+	_DELETEP(Headless::target);
+
+	#if !defined _WINDOWS
+	if (Headless::eglDisplay != EGL_NO_DISPLAY)
+	{
+		eglMakeCurrent(Headless::eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+		if (Headless::eglSurface != EGL_NO_SURFACE)
+			eglDestroySurface(Headless::eglDisplay, Headless::eglSurface);
+
+		if (Headless::eglContext != EGL_NO_CONTEXT)
+			eglDestroyContext(Headless::eglDisplay, Headless::eglContext);
+
+		eglTerminate(Headless::eglDisplay);
+
+		Headless::eglContext = EGL_NO_CONTEXT;
+		Headless::eglDisplay = EGL_NO_DISPLAY;
+		Headless::eglSurface = EGL_NO_SURFACE;
+	}
+	#endif
+}
+
+// LINUX USES EGL WITHOUT A WINDOW SYSTEM (MESA SURFACELESS PLATFORM) SO IT RUNS ON LLVMPIPE WITHOUT A GPU OR GLX
+int Headless::CreateContext()
+{
+	#if defined _WINDOWS
+		RenderEngine::Canvas.GL = new wxGLContext(RenderEngine::Canvas.Canvas);
+
+		if (!RenderEngine::Canvas.GL->IsOK())
+			return -1;
+
+		RenderEngine::Canvas.Canvas->SetCurrent(*RenderEngine::Canvas.GL);
+	#else
+		PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+		if (eglGetPlatformDisplayEXT != nullptr)
+			Headless::eglDisplay = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+		if (Headless::eglDisplay == EGL_NO_DISPLAY)
+			Headless::eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+		if ((Headless::eglDisplay == EGL_NO_DISPLAY) || !eglInitialize(Headless::eglDisplay, nullptr, nullptr))
+			return -1;
+
+		if (!eglBindAPI(EGL_OPENGL_API))
+			return -2;
+
+		EGLint configAttribs[] = {
+			EGL_SURFACE_TYPE,    EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE,        8,
+			EGL_GREEN_SIZE,      8,
+			EGL_BLUE_SIZE,       8,
+			EGL_ALPHA_SIZE,      8,
+			EGL_DEPTH_SIZE,      24,
+			EGL_NONE
+		};
+
+		EGLConfig config      = nullptr;
+		EGLint    nrOfConfigs = 0;
+
+		if (!eglChooseConfig(Headless::eglDisplay, configAttribs, &config, 1, &nrOfConfigs) || (nrOfConfigs < 1))
+			return -3;
+
+		// THE SHADERS AND FRAME BUFFERS NEED 4.5 - COMPATIBILITY PROFILE LIKE THE wxGLCanvas CONTEXT
+		EGLint contextAttribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION,       4,
+			EGL_CONTEXT_MINOR_VERSION,       5,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+			EGL_NONE
+		};
+
+		Headless::eglContext = eglCreateContext(Headless::eglDisplay, config, EGL_NO_CONTEXT, contextAttribs);
+
+		if (Headless::eglContext == EGL_NO_CONTEXT)
+			return -4;
+
+		// NOTHING IS DRAWN TO THE SURFACE - A 1x1 PBUFFER IS ONLY NEEDED WITHOUT EGL_KHR_surfaceless_context
+		if (!eglMakeCurrent(Headless::eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, Headless::eglContext))
+		{
+			EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+
+			Headless::eglSurface = eglCreatePbufferSurface(Headless::eglDisplay, config, pbufferAttribs);
+
+			if ((Headless::eglSurface == EGL_NO_SURFACE) || !eglMakeCurrent(Headless::eglDisplay, Headless::eglSurface, Headless::eglSurface, Headless::eglContext))
+				return -5;
+		}
+	#endif
+
+	return 0;
+}
+
+int Headless::Init(const wxSize &size)
+{
+	_DELETEP(Headless::target);
+
+	Headless::target = new FrameBuffer(size, FBO_COLOR, TEXTURE_2D, true);
+
+	if (Headless::target->GetTexture() == nullptr)
+		return -1;
+
+	return 0;
+}
+
+int Headless::SaveImage(const wxString &file)
+{
+	if (Headless::target == nullptr)
+		return -1;
+
+	int                  width  = Headless::target->Size().GetWidth();
+	int                  height = Headless::target->Size().GetHeight();
+	size_t               stride = (size_t)(width * 3);
+	std::vector<uint8_t> pixels(stride * height);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, Headless::target->FBO());
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+	wxImage  image(width, height, false);
+	uint8_t* imageData = image.GetData();
+
+	// OPENGL ROWS START AT THE BOTTOM
+	for (int y = 0; y < height; y++)
+		std::memcpy((imageData + (y * stride)), (pixels.data() + ((height - 1 - y) * stride)), stride);
+
+	if (!image.SaveFile(file, wxBITMAP_TYPE_PNG))
+		return -2;
+
+	return 0;
+}
+
+void Headless::Unbind()
+{
+	if (Headless::target != nullptr)
+		Headless::target->Unbind();
+}
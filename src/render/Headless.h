@@ -0,0 +1,37 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_HEADLESS_H
+#define S3DE_HEADLESS_H
+
+// OPENGL ONLY - THE WINDOW IS NEVER SHOWN AND EVERY FRAME IS DRAWN INTO AN OFFSCREEN FRAME BUFFER
+class Headless
+{
+private:
+	Headless()  {}
+	~Headless() {}
+
+public:
+	static bool Enabled;
+
+private:
+	static FrameBuffer* target;
+
+	#if !defined _WINDOWS
+		static EGLContext eglContext;
+		static EGLDisplay eglDisplay;
+		static EGLSurface eglSurface;
+	#endif
+
+public:
+	static void Bind();
+	static void Close();
+	static int  CreateContext();
+	static int  Init(const wxSize &size);
+	static int  SaveImage(const wxString &file);
+	static void Unbind();
+
+};
+
+#endif
@@ -0,0 +1,385 @@
+#include "LightCluster.h"
+
+static const int    CLUSTER_LIGHT_WORDS     = 24;	// MUST MATCH default.fs.glsl AND default.hlsl
+static const int    CLUSTER_MAX_COUNT       = 255;
+static const size_t CLUSTER_SLICES_PER_JOB  = 2;
+
+int                   LightCluster::Slices         = 24;
+int                   LightCluster::TextureSlot    = 5;
+int                   LightCluster::TextureWidth   = 1024;
+float                 LightCluster::Threshold      = (1.0f / 256.0f);
+int                   LightCluster::TilesX         = 16;
+int                   LightCluster::TilesY         = 9;
+glm::vec4             LightCluster::depth          = {};
+glm::vec4             LightCluster::grid           = {};
+std::vector<uint32_t> LightCluster::words;
+LightClusterStats     LightCluster::stats;
+Texture*              LightCluster::texture        = nullptr;
+glm::mat4             LightCluster::viewProjection = glm::mat4(1.0f);
+
+// SPHERE VS FROXEL AABB TESTS, ONE JOB PER RANGE OF DEPTH SLICES - EACH JOB ONLY WRITES THE FROXELS OF ITS OWN SLICES
+void LightCluster::assignSlices(const std::vector<ClusterLight> &lights, const glm::mat4 &projection, float near, int begin, int end, std::vector<std::vector<uint16_t>> &froxels)
+{
+	std::vector<float> maxX(LightCluster::TilesX);
+	std::vector<float> minX(LightCluster::TilesX);
+	int                tiles = (LightCluster::TilesX * LightCluster::TilesY);
+
+	for (int slice = begin; slice < end; slice++)
+	{
+		float zNear = std::max(near, std::exp(((float)(slice)     - LightCluster::depth.w) / LightCluster::depth.z));
+		float zFar  =                std::exp(((float)(slice + 1) - LightCluster::depth.w) / LightCluster::depth.z);
+
+		for (int i = (slice * tiles); i < ((slice + 1) * tiles); i++)
+			froxels[i].clear();
+
+		// NDC = (P * VIEW).xy / DEPTH, SO THE VIEW SPACE BOUNDS OF A TILE GROW LINEARLY WITH THE DEPTH
+		for (int x = 0; x < LightCluster::TilesX; x++)
+		{
+			float ndc0 = ((((float)(x)     / (float)LightCluster::TilesX) * 2.0f) - 1.0f) / projection[0][0];
+			float ndc1 = ((((float)(x + 1) / (float)LightCluster::TilesX) * 2.0f) - 1.0f) / projection[0][0];
+
+			minX[x] = std::min({ (ndc0 * zNear), (ndc0 * zFar), (ndc1 * zNear), (ndc1 * zFar) });
+			maxX[x] = std::max({ (ndc0 * zNear), (ndc0 * zFar), (ndc1 * zNear), (ndc1 * zFar) });
+		}
+
+		for (int light = 0; light < (int)lights.size(); light++)
+		{
+			const ClusterLight &bounds = lights[light];
+
+			if ((slice < bounds.SliceMin) || (slice > bounds.SliceMax))
+				continue;
+
+			float radius2 = (bounds.Radius * bounds.Radius);
+			float depth   = -bounds.Center.z;
+			float dz      = std::max({ (zNear - depth), (depth - zFar), 0.0f });
+
+			for (int y = bounds.TileMinY; y <= bounds.TileMaxY; y++)
+			{
+				float ndc0 = ((((float)(y)     / (float)LightCluster::TilesY) * 2.0f) - 1.0f) / projection[1][1];
+				float ndc1 = ((((float)(y + 1) / (float)LightCluster::TilesY) * 2.0f) - 1.0f) / projection[1][1];
+				float minY = std::min({ (ndc0 * zNear), (ndc0 * zFar), (ndc1 * zNear), (ndc1 * zFar) });
+				float maxY = std::max({ (ndc0 * zNear), (ndc0 * zFar), (ndc1 * zNear), (ndc1 * zFar) });
+				float dy   = std::max({ (minY - bounds.Center.y), (bounds.Center.y - maxY), 0.0f });
+				float dyz2 = ((dy * dy) + (dz * dz));
+
+				if (dyz2 > radius2)
+					continue;
+
+				int first = ((slice * tiles) + (y * LightCluster::TilesX));
+				int x     = bounds.TileMinX;
+
+				#if defined S3DE_SSE2
+				const __m128 centerX = _mm_set1_ps(bounds.Center.x);
+				const __m128 distYZ  = _mm_set1_ps(dyz2);
+				const __m128 radius  = _mm_set1_ps(radius2);
+				const __m128 zero    = _mm_setzero_ps();
+
+				// 4 TILES OF THE ROW PER TEST
+				for (; (x + 3) <= bounds.TileMaxX; x += 4)
+				{
+					__m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(&minX[x]), centerX), _mm_sub_ps(centerX, _mm_loadu_ps(&maxX[x]))), zero);
+					int    hit = _mm_movemask_ps(_mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), distYZ), radius));
+
+					for (int i = 0; hit != 0; i++, hit >>= 1) {
+						if (hit & 1)
+							froxels[first + x + i].push_back((uint16_t)light);
+					}
+				}
+				#endif
+
+				for (; x <= bounds.TileMaxX; x++)
+				{
+					float dx = std::max({ (minX[x] - bounds.Center.x), (bounds.Center.x - maxX[x]), 0.0f });
+
+					if (((dx * dx) + dyz2) <= radius2)
+						froxels[first + x].push_back((uint16_t)light);
+				}
+			}
+		}
+	}
+}
+
+void LightCluster::Close()
+{
+	_DELETEP(LightCluster::texture);
+
+	LightCluster::words.clear();
+
+	LightCluster::grid  = {};
+	LightCluster::stats = {};
+}
+
+glm::vec4 LightCluster::Depth()
+{
+	return LightCluster::depth;
+}
+
+// THE SLICES AND TILES THE SPHERE CAN TOUCH - THE CORNERS OF THE VIEW SPACE AABB OF THE SPHERE BOUND ITS PROJECTION
+bool LightCluster::getBounds(const CBLight &light, const glm::mat4 &view, const glm::mat4 &projection, float near, float far, ClusterLight &bounds)
+{
+	if (light.Active.x < 0.1f)
+		return false;
+
+	bounds.Center = glm::vec3(view * glm::vec4(glm::vec3(light.Position), 1.0f));
+	bounds.Radius = LightCluster::getRange(light);
+
+	float depth = -bounds.Center.z;
+
+	if (((depth + bounds.Radius) < near) || ((depth - bounds.Radius) > far))
+		return false;
+
+	float zMin = std::max((depth - bounds.Radius), near);
+	float zMax = std::min((depth + bounds.Radius), far);
+
+	bounds.SliceMin = LightCluster::getSlice(zMin);
+	bounds.SliceMax = LightCluster::getSlice(zMax);
+
+	bounds.TileMinX = 0;
+	bounds.TileMinY = 0;
+	bounds.TileMaxX = (LightCluster::TilesX - 1);
+	bounds.TileMaxY = (LightCluster::TilesY - 1);
+
+	// THE SPHERE CROSSES THE NEAR PLANE - ALL THE TILES
+	if ((depth - bounds.Radius) < near)
+		return true;
+
+	glm::vec2 ndcMin = glm::vec2(1.0f);
+	glm::vec2 ndcMax = glm::vec2(-1.0f);
+
+	for (int i = 0; i < 8; i++)
+	{
+		glm::vec4 corner = glm::vec4(
+			(bounds.Center.x + ((i & 1) ? bounds.Radius : -bounds.Radius)),
+			(bounds.Center.y + ((i & 2) ? bounds.Radius : -bounds.Radius)),
+			-((i & 4) ? zMax : zMin),
+			1.0f
+		);
+
+		glm::vec4 clip = (projection * corner);
+		glm::vec2 ndc  = (glm::vec2(clip) / clip.w);
+
+		ndcMin = glm::min(ndcMin, ndc);
+		ndcMax = glm::max(ndcMax, ndc);
+	}
+
+	ndcMin = ((glm::clamp(ndcMin, -1.0f, 1.0f) * 0.5f) + 0.5f);
+	ndcMax = ((glm::clamp(ndcMax, -1.0f, 1.0f) * 0.5f) + 0.5f);
+
+	bounds.TileMinX = glm::clamp((int)(ndcMin.x * (float)LightCluster::TilesX), 0, (LightCluster::TilesX - 1));
+	bounds.TileMinY = glm::clamp((int)(ndcMin.y * (float)LightCluster::TilesY), 0, (LightCluster::TilesY - 1));
+	bounds.TileMaxX = glm::clamp((int)(ndcMax.x * (float)LightCluster::TilesX), 0, (LightCluster::TilesX - 1));
+	bounds.TileMaxY = glm::clamp((int)(ndcMax.y * (float)LightCluster::TilesY), 0, (LightCluster::TilesY - 1));
+
+	return true;
+}
+
+// THE DISTANCE WHERE THE BRIGHTEST CHANNEL OF THE LIGHT IS ATTENUATED BELOW THE THRESHOLD, THE CAMERA FAR PLANE WITHOUT ATTENUATION
+float LightCluster::getRange(const CBLight &light)
+{
+	float brightness = std::max({
+		light.Ambient.r,  light.Ambient.g,  light.Ambient.b,
+		light.Diffuse.r,  light.Diffuse.g,  light.Diffuse.b,
+		light.Specular.r, light.Specular.g, light.Specular.b
+	});
+
+	float far       = RenderThread::GetCamera()->Far();
+	float constant  = light.Attenuation.x;
+	float linear    = light.Attenuation.y;
+	float quadratic = (RenderEngine::EnableSRGB ? light.Attenuation.z : 0.0f);
+	float limit     = (brightness / LightCluster::Threshold);
+
+	if (limit <= constant)
+		return 0.0f;
+
+	// (1 / (c + (l * d) + (q * d^2))) * brightness = threshold
+	if (quadratic > 0.0f)
+		return std::min(far, ((-linear + std::sqrt((linear * linear) - (4.0f * quadratic * (constant - limit)))) / (2.0f * quadratic)));
+	else if (linear > 0.0f)
+		return std::min(far, ((limit - constant) / linear));
+
+	return far;
+}
+
+int LightCluster::getSlice(float depth)
+{
+	return glm::clamp((int)((std::log(depth) * LightCluster::depth.z) + LightCluster::depth.w), 0, (LightCluster::Slices - 1));
+}
+
+// THE CLUSTER DATA REPLACES THE UNUSED MESH TEXTURE SLOT OF THE DEFAULT SHADER
+Texture* LightCluster::GetTexture(ShaderID shader, Component* mesh, int index)
+{
+	if ((shader == SHADER_ID_DEFAULT) && (index == LightCluster::TextureSlot) && (LightCluster::texture != nullptr) && (LightCluster::Lights() > 0))
+		return LightCluster::texture;
+
+	return RenderThread::GetTexture(mesh, index);
+}
+
+glm::vec4 LightCluster::Grid()
+{
+	return LightCluster::grid;
+}
+
+int LightCluster::Lights()
+{
+	return (int)LightCluster::grid.w;
+}
+
+LightClusterStats LightCluster::Stats()
+{
+	return LightCluster::stats;
+}
+
+// CALLED BEFORE THE FRAME IS RECORDED, SO THE UPLOAD DOESN'T TOUCH THE TEXTURE THE PREVIOUS FRAME USES
+void LightCluster::Update()
+{
+	PROFILE_SCOPE("LightCluster::Update");
+
+	std::vector<CBLight> clustered;
+	Camera*              camera = RenderThread::GetCamera();
+
+	RenderThread::GetClusteredLights(clustered);
+
+	LightCluster::grid         = glm::vec4((float)LightCluster::TilesX, (float)LightCluster::TilesY, (float)LightCluster::Slices, 0.0f);
+	LightCluster::stats.Lights = (int)clustered.size();
+
+	if (clustered.empty() || (camera == nullptr))
+		return;
+
+	clustered.resize(std::min(clustered.size(), (size_t)UINT16_MAX));
+
+	float     near       = camera->Near();
+	float     far        = camera->Far();
+	float     scale      = ((float)LightCluster::Slices / std::log(far / near));
+	glm::mat4 projection = camera->Projection();
+	glm::mat4 view       = camera->View();
+
+	LightCluster::depth          = glm::vec4(near, far, scale, (-std::log(near) * scale));
+	LightCluster::viewProjection = (projection * view);
+
+	std::vector<ClusterLight> lights(clustered.size());
+
+	for (size_t i = 0; i < clustered.size(); i++)
+		LightCluster::getBounds(clustered[i], view, projection, near, far, lights[i]);
+
+	int                                froxelCount = (LightCluster::TilesX * LightCluster::TilesY * LightCluster::Slices);
+	std::vector<std::vector<uint16_t>> froxels(froxelCount);
+
+	JobSystem::ParallelFor((size_t)LightCluster::Slices, CLUSTER_SLICES_PER_JOB, [&lights, &projection, near, &froxels](size_t begin, size_t end) {
+		LightCluster::assignSlices(lights, projection, near, (int)begin, (int)end, froxels);
+	});
+
+	// LIGHTS, THEN ONE WORD PER FROXEL (OFFSET << 0 | COUNT << 24), THEN THE LIGHT INDICES OF ALL THE FROXELS
+	size_t gridOffset  = (clustered.size() * CLUSTER_LIGHT_WORDS);
+	size_t indexOffset = (gridOffset + froxelCount);
+	size_t indices     = 0;
+
+	LightCluster::stats.MaxLights = 0;
+	LightCluster::stats.Overflows = 0;
+
+	for (const auto &froxel : froxels)
+	{
+		indices += std::min(froxel.size(), (size_t)CLUSTER_MAX_COUNT);
+
+		LightCluster::stats.MaxLights = std::max(LightCluster::stats.MaxLights, (int)froxel.size());
+
+		if (froxel.size() > CLUSTER_MAX_COUNT)
+			LightCluster::stats.Overflows++;
+	}
+
+	int rows   = (int)(((indexOffset + indices) + (LightCluster::TextureWidth - 1)) / LightCluster::TextureWidth);
+	int height = 1;
+
+	// THE TEXTURE ONLY GROWS (POWER OF TWO ROWS)
+	if ((LightCluster::texture != nullptr) && (LightCluster::texture->Size().GetHeight() >= rows))
+		height = LightCluster::texture->Size().GetHeight();
+
+	while (height < rows)
+		height *= 2;
+
+	LightCluster::words.assign(((size_t)LightCluster::TextureWidth * (size_t)height), 0);
+
+	for (size_t i = 0; i < clustered.size(); i++)
+	{
+		const CBLight &light  = clustered[i];
+		glm::vec4      data[] = {
+			glm::vec4(glm::vec3(light.Position),    lights[i].Radius),
+			glm::vec4(glm::vec3(light.Ambient),     light.Active.y),
+			glm::vec4(glm::vec3(light.Diffuse),     light.Angles.x),
+			glm::vec4(glm::vec3(light.Specular),    light.Angles.y),
+			glm::vec4(glm::vec3(light.Direction),   0.0f),
+			glm::vec4(glm::vec3(light.Attenuation), 0.0f)
+		};
+
+		memcpy(&LightCluster::words[i * CLUSTER_LIGHT_WORDS], data, sizeof(data));
+	}
+
+	uint32_t offset = 0;
+
+	for (int i = 0; i < froxelCount; i++)
+	{
+		uint32_t count = (uint32_t)std::min(froxels[i].size(), (size_t)CLUSTER_MAX_COUNT);
+
+		LightCluster::words[gridOffset + i] = (offset | (count << 24));
+
+		for (uint32_t j = 0; j < count; j++)
+			LightCluster::words[indexOffset + offset + j] = froxels[i][j];
+
+		offset += count;
+	}
+
+	LightCluster::stats.Indices = (int)indices;
+
+	// DISABLE THE CLUSTERED LIGHTS FOR THIS FRAME IF THE DATA CAN'T BE UPLOADED
+	if (LightCluster::upload(rows) < 0)
+		return;
+
+	LightCluster::grid.w = (float)clustered.size();
+}
+
+// THE WORDS ARE WRITTEN IN PLACE, A NEW TEXTURE WHEN THE WORDS DON'T FIT
+int LightCluster::upload(int rows)
+{
+	int            height = (int)(LightCluster::words.size() / LightCluster::TextureWidth);
+	const uint8_t* pixels = reinterpret_cast<const uint8_t*>(LightCluster::words.data());
+
+	if ((LightCluster::texture != nullptr) && (LightCluster::texture->Size().GetHeight() == height))
+	{
+		if (LightCluster::texture->UpdatePixels(pixels, wxRect(0, 0, LightCluster::TextureWidth, rows)) < 0) {
+			_DELETEP(LightCluster::texture);
+			return -1;
+		}
+
+		LightCluster::stats.Uploads++;
+
+		return 0;
+	}
+
+	_DELETEP(LightCluster::texture);
+
+	CompressedImage image;
+
+	image.Height = height;
+	image.Layers = 1;
+	image.Width  = LightCluster::TextureWidth;
+
+	image.Levels.resize(1);
+	image.Levels[0].Data.assign(pixels, (pixels + (LightCluster::words.size() * 4)));
+	image.Levels[0].Height = image.Height;
+	image.Levels[0].Width  = image.Width;
+
+	LightCluster::texture = new Texture(image);
+
+	if (!LightCluster::texture->IsOK()) {
+		_DELETEP(LightCluster::texture);
+		return -2;
+	}
+
+	LightCluster::stats.Uploads++;
+
+	return 0;
+}
+
+glm::mat4 LightCluster::ViewProjection()
+{
+	return LightCluster::viewProjection;
+}
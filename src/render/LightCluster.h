@@ -0,0 +1,73 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_LIGHTCLUSTER_H
+#define S3DE_LIGHTCLUSTER_H
+
+struct ClusterLight
+{
+	glm::vec3 Center    = {};	// VIEW SPACE
+	float     Radius    = 0.0f;
+	int       SliceMin  = 0;
+	int       SliceMax  = -1;
+	int       TileMaxX  = -1;
+	int       TileMaxY  = -1;
+	int       TileMinX  = 0;
+	int       TileMinY  = 0;
+};
+
+struct LightClusterStats
+{
+	int      Indices   = 0;
+	int      Lights    = 0;
+	int      MaxLights = 0;	// IN ONE FROXEL
+	int      Overflows = 0;	// FROXELS WITH MORE THAN 255 LIGHTS
+	uint64_t Uploads   = 0;
+};
+
+// THE POINT AND SPOT LIGHTS THAT DON'T FIT IN THE SHADOWED LIGHT SLOTS ARE ASSIGNED TO A GRID OF VIEW FRUSTUM CELLS
+// (FROXELS, EXPONENTIAL DEPTH SLICES) ON THE JOB SYSTEM, AND THE LIGHTS, THE GRID AND THE LIGHT INDICES OF EACH CELL ARE
+// UPLOADED AS 32-BIT WORDS IN AN RGBA8 DATA TEXTURE. THE DEFAULT SHADER ONLY EVALUATES THE LIGHTS OF THE FRAGMENT'S CELL.
+class LightCluster
+{
+private:
+	LightCluster()  {}
+	~LightCluster() {}
+
+public:
+	static int   Slices;
+	static int   TextureSlot;
+	static int   TextureWidth;
+	static float Threshold;
+	static int   TilesX;
+	static int   TilesY;
+
+private:
+	static glm::vec4             depth;
+	static glm::vec4             grid;
+	static std::vector<uint32_t> words;
+	static LightClusterStats     stats;
+	static Texture*              texture;
+	static glm::mat4             viewProjection;
+
+public:
+	static void              Close();
+	static glm::vec4         Depth();
+	static Texture*          GetTexture(ShaderID shader, Component* mesh, int index);
+	static glm::vec4         Grid();
+	static int               Lights();
+	static LightClusterStats Stats();
+	static void              Update();
+	static glm::mat4         ViewProjection();
+
+private:
+	static void  assignSlices(const std::vector<ClusterLight> &lights, const glm::mat4 &projection, float near, int begin, int end, std::vector<std::vector<uint16_t>> &froxels);
+	static bool  getBounds(const CBLight &light, const glm::mat4 &view, const glm::mat4 &projection, float near, float far, ClusterLight &bounds);
+	static float getRange(const CBLight &light);
+	static int   getSlice(float depth);
+	static int   upload(int rows);
+
+};
+
+#endif
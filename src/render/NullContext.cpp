@@ -0,0 +1,207 @@
+#include "NullContext.h"
+
+NullContext::NullContext()
+{
+	this->frames       = 0;
+	this->nextResource = 1;
+}
+
+NullContext::~NullContext()
+{
+	this->commands.clear();
+	this->lastCommands.clear();
+	this->lastPayload.clear();
+	this->payload.clear();
+	this->resources.clear();
+}
+
+void NullContext::Bind(FBOType fboType, Texture* texture, int depthLayer)
+{
+	this->record(NULL_COMMAND_BIND_FBO, (texture != nullptr ? texture->NullID : 0), (uint32_t)depthLayer, (uint32_t)fboType);
+}
+
+void NullContext::BindProgram(ShaderID shaderID)
+{
+	this->record(NULL_COMMAND_BIND_PROGRAM, (uint32_t)shaderID);
+}
+
+void NullContext::BindTexture(uint32_t slot, Texture* texture)
+{
+	if ((texture == nullptr) || (texture->NullID == 0))
+		return;
+
+	this->record(NULL_COMMAND_BIND_TEXTURE, slot, texture->NullID);
+
+	RenderStats::AddTextureBinds();
+}
+
+void NullContext::Clear(const glm::vec4 &colorRGBA, const DrawProperties &properties)
+{
+	Texture*     target  = (properties.FBO != nullptr ? properties.FBO->GetTexture() : nullptr);
+	NullCommand& command = this->record(NULL_COMMAND_CLEAR, (target != nullptr ? target->NullID : 0), (uint32_t)properties.DepthLayer);
+
+	this->recordPayload(command, glm::value_ptr(colorRGBA), sizeof(colorRGBA));
+}
+
+uint32_t NullContext::CreateResource(uint64_t bytes)
+{
+	uint32_t resource = this->nextResource++;
+
+	this->resources[resource] = bytes;
+
+	return resource;
+}
+
+void NullContext::DestroyResource(uint32_t resource)
+{
+	this->resources.erase(resource);
+}
+
+int NullContext::Draw(Component* mesh, ShaderProgram* shaderProgram, const DrawProperties &properties)
+{
+	if ((RenderThread::GetCamera() == nullptr) || (mesh == nullptr) || (shaderProgram == nullptr))
+		return -1;
+
+	Mesh*   mesh2        = dynamic_cast<Mesh*>(mesh);
+	Buffer* indexBuffer  = mesh2->IndexBuffer();
+	Buffer* vertexBuffer = mesh2->VertexBuffer();
+
+	if ((vertexBuffer == nullptr) || (shaderProgram->ID() == SHADER_ID_UNKNOWN))
+		return -2;
+
+	if (shaderProgram->UpdateUniformsNull(this, mesh, properties) < 0)
+		return -3;
+
+	if (indexBuffer != nullptr)
+		this->record(NULL_COMMAND_DRAW_INDEXED, indexBuffer->NullID, (uint32_t)mesh2->NrOfIndices(), RenderEngine::GetDrawMode());
+	else
+		this->record(NULL_COMMAND_DRAW, vertexBuffer->NullID, (uint32_t)mesh2->NrOfVertices(), RenderEngine::GetDrawMode());
+
+	return 0;
+}
+
+uint64_t NullContext::Frames()
+{
+	return this->frames;
+}
+
+// FNV-1a OVER THE COMMANDS AND PAYLOADS OF THE LAST FRAME - EQUAL HASHES MEAN EQUAL SUBMISSIONS
+uint64_t NullContext::Hash()
+{
+	uint64_t       hash  = 14695981039346656037ULL;
+	const uint8_t* bytes = (const uint8_t*)this->lastCommands.data();
+	size_t         size  = (this->lastCommands.size() * sizeof(NullCommand));
+
+	for (size_t i = 0; i < size; i++)
+		hash = ((hash ^ bytes[i]) * 1099511628211ULL);
+
+	for (auto byte : this->lastPayload)
+		hash = ((hash ^ byte) * 1099511628211ULL);
+
+	return hash;
+}
+
+bool NullContext::IsOK()
+{
+	return true;
+}
+
+const std::vector<NullCommand>& NullContext::LastFrame()
+{
+	return this->lastCommands;
+}
+
+const uint8_t* NullContext::Payload(const NullCommand &command)
+{
+	if ((command.PayloadSize == 0) || ((size_t)(command.PayloadOffset + command.PayloadSize) > this->lastPayload.size()))
+		return nullptr;
+
+	return (this->lastPayload.data() + command.PayloadOffset);
+}
+
+// THE STREAMS ARE SWAPPED INSTEAD OF COPIED SO A STEADY SCENE STOPS ALLOCATING AFTER A COUPLE OF FRAMES
+void NullContext::Present()
+{
+	this->record(NULL_COMMAND_PRESENT);
+
+	this->commands.swap(this->lastCommands);
+	this->payload.swap(this->lastPayload);
+
+	this->commands.clear();
+	this->payload.clear();
+
+	this->frames++;
+}
+
+NullCommand& NullContext::record(NullCommandType type, uint32_t arg0, uint32_t arg1, uint32_t arg2)
+{
+	NullCommand command = {};
+
+	command.Type    = type;
+	command.Args[0] = arg0;
+	command.Args[1] = arg1;
+	command.Args[2] = arg2;
+
+	this->commands.push_back(command);
+
+	return this->commands.back();
+}
+
+void NullContext::recordPayload(NullCommand &command, const void* data, size_t size)
+{
+	command.PayloadOffset = (uint32_t)this->payload.size();
+	command.PayloadSize   = (uint32_t)size;
+
+	this->payload.insert(this->payload.end(), (const uint8_t*)data, ((const uint8_t*)data + size));
+}
+
+void NullContext::SetUniforms(UniformBinding binding, ShaderID shaderID, const void* values, size_t size)
+{
+	if ((values == nullptr) || (size == 0))
+		return;
+
+	NullCommand& command = this->record(NULL_COMMAND_UNIFORMS, (uint32_t)binding, (uint32_t)shaderID);
+
+	this->recordPayload(command, values, size);
+
+	RenderStats::AddBytesUploaded(size);
+	RenderStats::AddDescriptorUpdates();
+}
+
+json11::Json NullContext::ToJSON()
+{
+	const char* names[NR_OF_NULL_COMMANDS] = {
+		"bind_fbo", "bind_program", "bind_texture", "clear", "draw", "draw_indexed", "present", "unbind_fbo", "uniforms"
+	};
+
+	uint64_t counts[NR_OF_NULL_COMMANDS] = {};
+	uint64_t resourceBytes               = 0;
+
+	for (const auto &command : this->lastCommands)
+		counts[command.Type]++;
+
+	for (const auto &resource : this->resources)
+		resourceBytes += resource.second;
+
+	json11::Json::object commandCounts;
+
+	for (int i = 0; i < NR_OF_NULL_COMMANDS; i++)
+		commandCounts[names[i]] = (double)counts[i];
+
+	char hash[BUFFER_SIZE] = {};
+	snprintf(hash, BUFFER_SIZE, "%016llx", (unsigned long long)this->Hash());
+
+	return json11::Json::object {
+		{ "commands",       commandCounts },
+		{ "frames",         (double)this->frames },
+		{ "hash",           hash },
+		{ "payload_bytes",  (double)this->lastPayload.size() },
+		{ "resource_bytes", (double)resourceBytes },
+		{ "resources",      (double)this->resources.size() }
+	};
+}
+
+void NullContext::Unbind()
+{
+	this->record(NULL_COMMAND_UNBIND_FBO);
+}
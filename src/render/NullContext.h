@@ -0,0 +1,77 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_NULLCONTEXT_H
+#define S3DE_NULLCONTEXT_H
+
+enum NullCommandType
+{
+	NULL_COMMAND_BIND_FBO,
+	NULL_COMMAND_BIND_PROGRAM,
+	NULL_COMMAND_BIND_TEXTURE,
+	NULL_COMMAND_CLEAR,
+	NULL_COMMAND_DRAW,
+	NULL_COMMAND_DRAW_INDEXED,
+	NULL_COMMAND_PRESENT,
+	NULL_COMMAND_UNBIND_FBO,
+	NULL_COMMAND_UNIFORMS,
+	NR_OF_NULL_COMMANDS
+};
+
+// BIND_FBO     { texture, depth layer, FBOType }
+// BIND_PROGRAM { ShaderID }
+// BIND_TEXTURE { slot, texture }
+// CLEAR        { texture, depth layer }          PAYLOAD: RGBA
+// DRAW         { vertex buffer, vertices, topology }
+// DRAW_INDEXED { index buffer, indices, topology }
+// UNIFORMS     { UniformBinding, ShaderID }     PAYLOAD: CONSTANT BUFFER
+struct NullCommand
+{
+	NullCommandType Type          = NR_OF_NULL_COMMANDS;
+	uint32_t        Args[3]       = {};
+	uint32_t        PayloadOffset = 0;
+	uint32_t        PayloadSize   = 0;
+};
+
+// RECORDS WHAT A FRAME SUBMITS WITHOUT A GPU - RESOURCES ARE ONLY HANDLES AND BYTE COUNTS
+class NullContext
+{
+public:
+	NullContext();
+	~NullContext();
+
+private:
+	std::vector<NullCommand>               commands;
+	uint64_t                               frames;
+	std::vector<NullCommand>               lastCommands;
+	std::vector<uint8_t>                   lastPayload;
+	uint32_t                               nextResource;
+	std::vector<uint8_t>                   payload;
+	std::unordered_map<uint32_t, uint64_t> resources;
+
+public:
+	void                            Bind(FBOType fboType, Texture* texture, int depthLayer);
+	void                            BindProgram(ShaderID shaderID);
+	void                            BindTexture(uint32_t slot, Texture* texture);
+	void                            Clear(const glm::vec4 &colorRGBA, const DrawProperties &properties);
+	uint32_t                        CreateResource(uint64_t bytes);
+	void                            DestroyResource(uint32_t resource);
+	int                             Draw(Component* mesh, ShaderProgram* shaderProgram, const DrawProperties &properties);
+	uint64_t                        Frames();
+	uint64_t                        Hash();
+	bool                            IsOK();
+	const std::vector<NullCommand>& LastFrame();
+	const uint8_t*                  Payload(const NullCommand &command);
+	void                            Present();
+	void                            SetUniforms(UniformBinding binding, ShaderID shaderID, const void* values, size_t size);
+	json11::Json                    ToJSON();
+	void                            Unbind();
+
+private:
+	NullCommand& record(NullCommandType type, uint32_t arg0 = 0, uint32_t arg1 = 0, uint32_t arg2 = 0);
+	void         recordPayload(NullCommand &command, const void* data, size_t size);
+
+};
+
+#endif
@@ -35,14 +35,26 @@ void RenderEngine::clear(const glm::vec4 &colorRGBA, const DrawProperties &prope
 		if (RenderEngine::Canvas.VK != nullptr)
 			RenderEngine::Canvas.VK->Clear(colorRGBA, properties);
 		break;
+	case GRAPHICS_API_NULL:
+		if (RenderEngine::Canvas.Null != nullptr)
+			RenderEngine::Canvas.Null->Clear(colorRGBA, properties);
+		break;
 	}
 }
 
 void RenderEngine::Close()
 {
+	RenderThread::Stop();
+	GPUTimer::Close();
+	HUDBatch::Close();
+	LightCluster::Close();
+	ShadowCascades::Close();
+
 	InputManager::Reset();
 	SceneManager::Clear();
+	TextureCache::Close();
 	ShaderManager::Close();
+	Primitives::Close();
 
 	_DELETEP(SceneManager::DepthMap2D);
 	_DELETEP(SceneManager::DepthMapCube);
@@ -50,9 +62,12 @@ void RenderEngine::Close()
 	_DELETEP(SceneManager::EmptyCubemap);
 	_DELETEP(SceneManager::EmptyTexture);
 
+	Headless::Close();
+
 	_DELETEP(RenderEngine::Canvas.DX);
 	_DELETEP(RenderEngine::Canvas.GL);
 	_DELETEP(RenderEngine::Canvas.VK);
+	_DELETEP(RenderEngine::Canvas.Null);
 
 	if (RenderEngine::Canvas.Canvas != nullptr) {
 		RenderEngine::Canvas.Canvas->DestroyChildren();
@@ -63,7 +78,9 @@ void RenderEngine::Close()
 
 void RenderEngine::createDepthFBO()
 {
-	if (RenderEngine::Renderables.empty())
+	PROFILE_SCOPE("RenderEngine::createDepthFBO");
+
+	if (RenderThread::GetRenderables().empty())
 		return;
 
 	bool cleared = false;
@@ -73,6 +90,8 @@ void RenderEngine::createDepthFBO()
 		if (SceneManager::LightSources[i] == nullptr)
 			continue;
 
+		PROFILE_SCOPE("RenderEngine::createDepthFBO::Light", (int)i);
+
 		FrameBuffer* fbo   = nullptr;
 		LightSource* light = SceneManager::LightSources[i];
 
@@ -86,53 +105,76 @@ void RenderEngine::createDepthFBO()
 		if (fbo == nullptr)
 			continue;
 
-		DrawProperties drawProperties = {};
+		// ONE PASS PER CASCADE OF THE CASCADED DIRECTIONAL LIGHT
+		int cascades = ((int)i == ShadowCascades::Light() ? ShadowCascades::Cascades() : 0);
 
-		drawProperties.DepthLayer = i;
-		drawProperties.FBO        = fbo;
-		drawProperties.Light      = light;
+		for (int cascade = (cascades > 0 ? 0 : -1); cascade < cascades; cascade++)
+		{
+			DrawProperties drawProperties = {};
 
-		if (light->SourceType() == ID_ICON_LIGHT_POINT)
-			drawProperties.Shader = SHADER_ID_DEPTH_OMNI;
-		else
-			drawProperties.Shader = SHADER_ID_DEPTH;
+			drawProperties.Cascade    = cascade;
+			drawProperties.DepthLayer = (cascade >= 0 ? ShadowCascades::Layer(cascade) : i);
+			drawProperties.FBO        = fbo;
+			drawProperties.Light      = light;
 
-		// BIND
-		VkCommandBuffer cmdBuffer = nullptr;
+			RenderEngine::createDepthLayer(drawProperties, cleared);
+		}
+	}
+}
 
-		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
-			cmdBuffer = RenderEngine::Canvas.VK->CommandBufferBegin();
-		else
-			fbo->Bind(drawProperties.DepthLayer);
+void RenderEngine::createDepthLayer(DrawProperties &drawProperties, bool &cleared)
+{
+	FrameBuffer* fbo   = drawProperties.FBO;
+	LightSource* light = drawProperties.Light;
 
-		drawProperties.VKCommandBuffer = cmdBuffer;
+	if (light->SourceType() == ID_ICON_LIGHT_POINT)
+		drawProperties.Shader = SHADER_ID_DEPTH_OMNI;
+	else
+		drawProperties.Shader = SHADER_ID_DEPTH;
 
-		// CLEAR
-		if ((RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL) &&
-			(light->SourceType() == ID_ICON_LIGHT_POINT))
-		{
-			if (!cleared) {
-				RenderEngine::clear(CLEAR_VALUE_DEPTH, drawProperties);
-				cleared = true;
-			}
-		} else {
+	// BIND
+	VkCommandBuffer cmdBuffer = nullptr;
+
+	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
+		cmdBuffer = RenderEngine::Canvas.VK->CommandBufferBegin();
+	else
+		fbo->Bind(drawProperties.DepthLayer);
+
+	drawProperties.VKCommandBuffer = cmdBuffer;
+
+	GPUTimer::Begin(GPU_PASS_SHADOWS, cmdBuffer);
+	RenderStats::BeginPass(RENDER_STATS_PASS_DEPTH);
+
+	// CLEAR
+	if ((RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL) &&
+		(light->SourceType() == ID_ICON_LIGHT_POINT))
+	{
+		if (!cleared) {
 			RenderEngine::clear(CLEAR_VALUE_DEPTH, drawProperties);
+			cleared = true;
 		}
+	} else {
+		RenderEngine::clear(CLEAR_VALUE_DEPTH, drawProperties);
+	}
 
-		// DRAW
-		RenderEngine::drawRenderables(drawProperties);
+	// DRAW
+	RenderEngine::drawRenderables(drawProperties);
 
-		// UNBIND
-		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
-			RenderEngine::Canvas.VK->Present(cmdBuffer);
-		else
-			fbo->Unbind();
-	}
+	RenderStats::EndPass();
+	GPUTimer::End(GPU_PASS_SHADOWS, cmdBuffer);
+
+	// UNBIND
+	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
+		RenderEngine::Canvas.VK->Present(cmdBuffer);
+	else
+		fbo->Unbind();
 }
 
 void RenderEngine::createWaterFBOs()
 {
-	for (auto component : RenderEngine::Renderables)
+	PROFILE_SCOPE("RenderEngine::createWaterFBOs");
+
+	for (auto component : RenderThread::GetRenderables())
 	{
 		if ((component == nullptr) || (component->Type() != COMPONENT_WATER))
 			continue;
@@ -142,14 +184,15 @@ void RenderEngine::createWaterFBOs()
 		if (water == nullptr)
 			continue;
 
+		Camera*         camera         = RenderThread::GetCamera();
 		glm::vec3       position       = component->Position();
 		glm::vec3       scale          = component->Scale();
-		float           cameraDistance = ((RenderEngine::CameraMain->Position().y - position.y) * 2.0f);
+		float           cameraDistance = ((camera->Position().y - position.y) * 2.0f);
 		VkCommandBuffer cmdBuffer      = nullptr;
 
 		// WATER REFLECTION PASS - ABOVE WATER
-		RenderEngine::CameraMain->MoveBy(glm::vec3(0.0f, -cameraDistance, 0.0f));
-		RenderEngine::CameraMain->InvertPitch();
+		camera->MoveBy(glm::vec3(0.0f, -cameraDistance, 0.0f));
+		camera->InvertPitch();
 
 		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
 			cmdBuffer = RenderEngine::Canvas.VK->CommandBufferBegin();
@@ -164,18 +207,24 @@ void RenderEngine::createWaterFBOs()
 		drawProperties.ClipMin         = glm::vec3(-scale.x, position.y, -scale.z);
 		drawProperties.VKCommandBuffer = cmdBuffer;
 
+		GPUTimer::Begin(GPU_PASS_WATER, cmdBuffer);
+		RenderStats::BeginPass(RENDER_STATS_PASS_WATER_REFLECTION);
+
 		RenderEngine::clear(CLEAR_VALUE_COLOR, drawProperties);
 
 		RenderEngine::drawSkybox(drawProperties);
 		RenderEngine::drawRenderables(drawProperties);
+
+		RenderStats::EndPass();
+		GPUTimer::End(GPU_PASS_WATER, cmdBuffer);
 		
 		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
 			RenderEngine::Canvas.VK->Present(cmdBuffer);
 		else
 			water->FBO()->UnbindReflection();
 
-		RenderEngine::CameraMain->InvertPitch();
-		RenderEngine::CameraMain->MoveBy(glm::vec3(0.0, cameraDistance, 0.0));
+		camera->InvertPitch();
+		camera->MoveBy(glm::vec3(0.0, cameraDistance, 0.0));
 
 		// WATER REFRACTION PASS - BELOW WATER
 		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
@@ -187,11 +236,17 @@ void RenderEngine::createWaterFBOs()
 		drawProperties.ClipMin = glm::vec3(-scale.x, -scale.y,   -scale.z);
 		drawProperties.FBO     = water->FBO()->RefractionFBO();
 
+		GPUTimer::Begin(GPU_PASS_WATER, cmdBuffer);
+		RenderStats::BeginPass(RENDER_STATS_PASS_WATER_REFRACTION);
+
 		RenderEngine::clear(CLEAR_VALUE_COLOR, drawProperties);
 
 		RenderEngine::drawSkybox(drawProperties);
 		RenderEngine::drawRenderables(drawProperties);
 
+		RenderStats::EndPass();
+		GPUTimer::End(GPU_PASS_WATER, cmdBuffer);
+
 		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_VULKAN)
 			RenderEngine::Canvas.VK->Present(cmdBuffer);
 		else
@@ -201,12 +256,25 @@ void RenderEngine::createWaterFBOs()
 
 void RenderEngine::Draw()
 {
+	PROFILE_SCOPE("RenderEngine::Draw");
+
+	GPUTimer::BeginFrame();
+
+	ShadowCascades::Update();
+
 	RenderEngine::createDepthFBO();
 	RenderEngine::createWaterFBOs();
 
+	HUDBatch::Update();
+	LightCluster::Update();
+
+	Headless::Bind();
+
 	RenderEngine::clear(CLEAR_VALUE_DEFAULT, {});
 	RenderEngine::drawScene();
 
+	Headless::Unbind();
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 		#if defined _WINDOWS
 		case GRAPHICS_API_DIRECTX11:
@@ -219,18 +287,26 @@ void RenderEngine::Draw()
 			break;
 		#endif
 		case GRAPHICS_API_OPENGL:
-			if (RenderEngine::Canvas.Canvas != nullptr)
+			if ((RenderEngine::Canvas.Canvas != nullptr) && !Headless::Enabled)
 				RenderEngine::Canvas.Canvas->SwapBuffers();
 			break;
 		case GRAPHICS_API_VULKAN:
 			if (RenderEngine::Canvas.VK != nullptr)
 				RenderEngine::Canvas.VK->Present();
 			break;
+		case GRAPHICS_API_NULL:
+			if (RenderEngine::Canvas.Null != nullptr)
+				RenderEngine::Canvas.Null->Present();
+			break;
 	}
+
+	RenderStats::EndFrame();
 }
 
 int RenderEngine::drawBoundingVolumes()
 {
+	PROFILE_SCOPE("RenderEngine::drawBoundingVolumes");
+
     if (!RenderEngine::DrawBoundingVolume)
 		return 1;
 
@@ -243,7 +319,7 @@ int RenderEngine::drawBoundingVolumes()
 	properties.DrawBoundingVolume = true;
 	properties.Shader             = SHADER_ID_WIREFRAME;
 
-	RenderEngine::drawMeshes(RenderEngine::Renderables, properties);
+	RenderEngine::drawMeshes(RenderThread::GetRenderables(), properties);
 
 	RenderEngine::drawMode = oldDrawMode;
 
@@ -252,7 +328,11 @@ int RenderEngine::drawBoundingVolumes()
 
 int RenderEngine::drawHUDs()
 {
-	if (RenderEngine::HUDs.empty())
+	PROFILE_SCOPE("RenderEngine::drawHUDs");
+
+	Component* overlay = GPUTimer::Overlay();
+
+	if (RenderThread::GetHUDs().empty() && (overlay == nullptr))
 		return 1;
 
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
@@ -261,14 +341,25 @@ int RenderEngine::drawHUDs()
 	DrawProperties properties = {};
 	properties.Shader         = (RenderEngine::drawMode == DRAW_MODE_FILLED ? SHADER_ID_HUD : SHADER_ID_WIREFRAME);
 
-	RenderEngine::drawMeshes(RenderEngine::HUDs, properties);
+	// ALL THE HUDS ARE DRAWN FROM THE BATCH - ONE DRAW PER ATLAS PAGE
+	if (properties.Shader == SHADER_ID_HUD) {
+		RenderEngine::drawMeshes(HUDBatch::Meshes(), properties);
+		return 0;
+	}
+
+	RenderEngine::drawMeshes(RenderThread::GetHUDs(), properties);
+
+	if (overlay != nullptr)
+		RenderEngine::drawMeshes({ overlay }, properties);
 
 	return 0;
 }
 
 int RenderEngine::drawLightSources()
 {
-	if (RenderEngine::LightSources.empty())
+	PROFILE_SCOPE("RenderEngine::drawLightSources");
+
+	if (RenderThread::GetLightSources().empty())
 		return 1;
 
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
@@ -277,14 +368,16 @@ int RenderEngine::drawLightSources()
 	DrawProperties properties = {};
 	properties.Shader         = (RenderEngine::drawMode == DRAW_MODE_FILLED ? SHADER_ID_COLOR : SHADER_ID_WIREFRAME);
 
-	RenderEngine::drawMeshes(RenderEngine::LightSources, properties);
+	RenderEngine::drawMeshes(RenderThread::GetLightSources(), properties);
 
 	return 0;
 }
 
 int RenderEngine::drawRenderables(DrawProperties &properties)
 {
-	if (RenderEngine::Renderables.empty())
+	PROFILE_SCOPE("RenderEngine::drawRenderables");
+
+	if (RenderThread::GetRenderables().empty())
 		return 1;
 
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
@@ -293,7 +386,7 @@ int RenderEngine::drawRenderables(DrawProperties &properties)
 	if (properties.Shader == SHADER_ID_UNKNOWN)
 		properties.Shader = (RenderEngine::drawMode == DRAW_MODE_FILLED ? SHADER_ID_DEFAULT : SHADER_ID_WIREFRAME);
 
-	RenderEngine::drawMeshes(RenderEngine::Renderables, properties);
+	RenderEngine::drawMeshes(RenderThread::GetRenderables(), properties);
 
 	properties.Shader = SHADER_ID_UNKNOWN;
 
@@ -302,6 +395,8 @@ int RenderEngine::drawRenderables(DrawProperties &properties)
 
 int RenderEngine::drawSelected()
 {
+	PROFILE_SCOPE("RenderEngine::drawSelected");
+
 	DrawModeType oldDrawMode = RenderEngine::drawMode;
 
 	RenderEngine::SetDrawMode(DRAW_MODE_WIREFRAME);
@@ -314,7 +409,7 @@ int RenderEngine::drawSelected()
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
 		RenderEngine::setDrawSettingsGL(SHADER_ID_WIREFRAME);
 
-	RenderEngine::drawMeshes(RenderEngine::Renderables, properties);
+	RenderEngine::drawMeshes(RenderThread::GetRenderables(), properties);
 
 	RenderEngine::drawMode = oldDrawMode;
 
@@ -323,7 +418,9 @@ int RenderEngine::drawSelected()
 
 int RenderEngine::drawSkybox(DrawProperties &properties)
 {
-	if (RenderEngine::Skybox == nullptr)
+	PROFILE_SCOPE("RenderEngine::drawSkybox");
+
+	if (RenderThread::GetSkybox() == nullptr)
 		return 1;
 
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
@@ -332,7 +429,7 @@ int RenderEngine::drawSkybox(DrawProperties &properties)
 	if (properties.Shader == SHADER_ID_UNKNOWN)
 		properties.Shader = (RenderEngine::drawMode == DRAW_MODE_FILLED ? SHADER_ID_SKYBOX : SHADER_ID_WIREFRAME);
 
-	RenderEngine::drawMeshes({ RenderEngine::Skybox }, properties);
+	RenderEngine::drawMeshes({ RenderThread::GetSkybox() }, properties);
 
 	properties.Shader = SHADER_ID_UNKNOWN;
 
@@ -341,24 +438,39 @@ int RenderEngine::drawSkybox(DrawProperties &properties)
 
 void RenderEngine::drawMesh(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties)
 {
+	int result = -1;
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 		#if defined _WINDOWS
 		case GRAPHICS_API_DIRECTX11:
-			RenderEngine::drawMeshDX11(mesh, shaderProgram, properties);
+			result = RenderEngine::drawMeshDX11(mesh, shaderProgram, properties);
 			break;
 		case GRAPHICS_API_DIRECTX12:
-			RenderEngine::drawMeshDX12(mesh, shaderProgram, properties);
+			result = RenderEngine::drawMeshDX12(mesh, shaderProgram, properties);
 			break;
 		#endif
 		case GRAPHICS_API_OPENGL:
-			RenderEngine::drawMeshGL(mesh, shaderProgram, properties);
+			result = RenderEngine::drawMeshGL(mesh, shaderProgram, properties);
 			break;
 		case GRAPHICS_API_VULKAN:
-			RenderEngine::drawMeshVK(mesh, shaderProgram, properties);
+			result = RenderEngine::drawMeshVK(mesh, shaderProgram, properties);
+			break;
+		case GRAPHICS_API_NULL:
+			result = RenderEngine::drawMeshNull(mesh, shaderProgram, properties);
 			break;
 		default:
 			throw;
 	}
+
+	if (result < 0)
+		return;
+
+	// WIREFRAME DRAWS (LINE STRIPS OR LINE POLYGON MODE) DON'T RASTERIZE ANY TRIANGLES
+	bool   lines    = ((RenderEngine::drawMode == DRAW_MODE_WIREFRAME) || (shaderProgram->ID() == SHADER_ID_WIREFRAME));
+	Mesh*  mesh2    = dynamic_cast<Mesh*>(mesh);
+	size_t elements = (mesh2->NrOfIndices() > 0 ? mesh2->NrOfIndices() : mesh2->NrOfVertices());
+
+	RenderStats::AddDrawCall(lines ? 0 : (uint64_t)(elements / 3));
 }
 
 int RenderEngine::drawMeshDX11(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties)
@@ -373,7 +485,7 @@ int RenderEngine::drawMeshDX12(Component* mesh, ShaderProgram* shaderProgram, Dr
 
 int RenderEngine::drawMeshGL(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties)
 {
-	if ((RenderEngine::CameraMain == nullptr) ||
+	if ((RenderThread::GetCamera() == nullptr) ||
 		(shaderProgram == nullptr) || (shaderProgram->Program() < 1) ||
 		(mesh == nullptr) || (dynamic_cast<Mesh*>(mesh)->IBO() < 1))
 	{
@@ -407,6 +519,11 @@ int RenderEngine::drawMeshGL(Component* mesh, ShaderProgram* shaderProgram, Draw
     return 0;
 }
 
+int RenderEngine::drawMeshNull(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties)
+{
+	return RenderEngine::Canvas.Null->Draw(mesh, shaderProgram, properties);
+}
+
 int RenderEngine::drawMeshVK(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties)
 {
 	return RenderEngine::Canvas.VK->Draw(mesh, shaderProgram, properties);
@@ -414,13 +531,16 @@ int RenderEngine::drawMeshVK(Component* mesh, ShaderProgram* shaderProgram, Draw
 
 void RenderEngine::drawMeshes(const std::vector<Component*> meshes, DrawProperties &properties)
 {
-	ShaderProgram* shaderProgram = RenderEngine::setShaderProgram(true, properties.Shader);
+	ShaderProgram* baseProgram   = RenderEngine::setShaderProgram(true, properties.Shader);
+	ShaderProgram* shaderProgram = baseProgram;
+	bool           useVariants   = (properties.Shader == SHADER_ID_DEFAULT);
+	uint32_t       lightFeatures = (useVariants ? ShaderProgram::GetLightFeatures() : SHADER_FEATURES_ALL);
 
 	for (auto mesh : meshes)
 	{
 		if (!properties.DrawBoundingVolume &&
-			((properties.DrawSelected && !dynamic_cast<Mesh*>(mesh)->IsSelected()) ||
-			(!properties.DrawSelected && dynamic_cast<Mesh*>(mesh)->IsSelected())))
+			((properties.DrawSelected && !RenderThread::IsSelected(mesh)) ||
+			(!properties.DrawSelected && RenderThread::IsSelected(mesh))))
 		{
 			continue;
 		}
@@ -429,17 +549,38 @@ void RenderEngine::drawMeshes(const std::vector<Component*> meshes, DrawProperti
 		if ((mesh->Type() == COMPONENT_WATER) && (properties.FBO != nullptr) && (properties.FBO->Type() != FBO_UNKNOWN))
 			continue;
 
-		glm::vec4 oldColor = mesh->ComponentMaterial.diffuse;
+		// SKIP THE MESHES THAT CAN'T CAST SHADOWS INTO THE CASCADE
+		if ((properties.Cascade >= 0) && !ShadowCascades::IsCaster(mesh, properties.Cascade))
+			continue;
+
+		Material* material = RenderThread::GetMaterial(mesh);
+		glm::vec4 oldColor = material->diffuse;
 
 		if (properties.DrawSelected)
-			mesh->ComponentMaterial.diffuse = SceneManager::SelectColor;
+			material->diffuse = SceneManager::SelectColor;
+
+		Component* drawable = (properties.DrawBoundingVolume ? dynamic_cast<Mesh*>(mesh)->GetBoundingVolume() : mesh);
+
+		// SHADER PERMUTATION
+		if (useVariants)
+		{
+			ShaderProgram* variant = baseProgram->Variant(ShaderProgram::GetFeatures(drawable, properties, lightFeatures));
 
-		RenderEngine::drawMesh(
-			(properties.DrawBoundingVolume ? dynamic_cast<Mesh*>(mesh)->GetBoundingVolume() : mesh), shaderProgram, properties
-		);
+			if (variant != shaderProgram)
+			{
+				shaderProgram = variant;
+
+				if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL) {
+					glUseProgram(shaderProgram->Program());
+					RenderStats::AddProgramSwitch();
+				}
+			}
+		}
+
+		RenderEngine::drawMesh(drawable, shaderProgram, properties);
 
 		if (properties.DrawSelected)
-			mesh->ComponentMaterial.diffuse = oldColor;
+			material->diffuse = oldColor;
 	}
 
 	RenderEngine::setShaderProgram(false);
@@ -447,12 +588,27 @@ void RenderEngine::drawMeshes(const std::vector<Component*> meshes, DrawProperti
 
 void RenderEngine::drawScene()
 {
+	PROFILE_SCOPE("RenderEngine::drawScene");
+
+	GPUTimer::Begin(GPU_PASS_SCENE);
+	RenderStats::BeginPass(RENDER_STATS_PASS_MAIN);
+
 	RenderEngine::drawRenderables();
 	RenderEngine::drawLightSources();
 	RenderEngine::drawSelected();
 	RenderEngine::drawBoundingVolumes();
 	RenderEngine::drawSkybox();
+
+	RenderStats::EndPass();
+	GPUTimer::End(GPU_PASS_SCENE);
+
+	GPUTimer::Begin(GPU_PASS_HUDS);
+	RenderStats::BeginPass(RENDER_STATS_PASS_HUD);
+
     RenderEngine::drawHUDs();
+
+	RenderStats::EndPass();
+	GPUTimer::End(GPU_PASS_HUDS);
 }
 
 uint16_t RenderEngine::GetDrawMode()
@@ -466,6 +622,7 @@ uint16_t RenderEngine::GetDrawMode()
 			return D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 		#endif
 		case GRAPHICS_API_OPENGL:
+		case GRAPHICS_API_NULL:
 			return GL_TRIANGLES;
 		case GRAPHICS_API_VULKAN:
 			return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
@@ -482,6 +639,7 @@ uint16_t RenderEngine::GetDrawMode()
 				return D3D_PRIMITIVE_TOPOLOGY_LINESTRIP;
 			#endif
 			case GRAPHICS_API_OPENGL:
+			case GRAPHICS_API_NULL:
 				return GL_LINE_STRIP;
 			case GRAPHICS_API_VULKAN:
 				return VK_PRIMITIVE_TOPOLOGY_LINE_STRIP;
@@ -493,6 +651,25 @@ uint16_t RenderEngine::GetDrawMode()
 	return DRAW_MODE_UNKNOWN;
 }
 
+// PROJECTED DIAMETER OF THE MESH BOUNDS IN PIXELS, 0 WHEN THE BOUNDS ARE BEHIND THE MAIN CAMERA
+float RenderEngine::GetScreenSize(Mesh* mesh)
+{
+	if ((mesh == nullptr) || (RenderEngine::CameraMain == nullptr))
+		return 0.0f;
+
+	float     radius = mesh->Radius();
+	glm::vec3 center = glm::vec3(RenderEngine::CameraMain->View() * glm::vec4(mesh->Position(), 1.0f));
+
+	// THE CAMERA LOOKS DOWN -Z IN VIEW SPACE
+	if (center.z > radius)
+		return 0.0f;
+
+	float distance = std::max(glm::length(center), RenderEngine::CameraMain->Near());
+	float focal    = std::abs(RenderEngine::CameraMain->Projection()[1][1]);
+
+	return ((radius / distance) * focal * (float)RenderEngine::Canvas.Size.GetHeight());
+}
+
 int RenderEngine::Init(WindowFrame* window, const wxSize &size)
 {
 	RenderEngine::Canvas.AspectRatio = (float)((float)size.GetHeight() / (float)size.GetWidth());
@@ -500,7 +677,9 @@ int RenderEngine::Init(WindowFrame* window, const wxSize &size)
 	RenderEngine::Canvas.Size        = size;
 	RenderEngine::Canvas.Window      = window;
 
-	int result = RenderEngine::setGraphicsAPI(GRAPHICS_API_OPENGL);
+	// THE NULL BACKEND CAN ONLY BE SELECTED BEFORE STARTUP (--null-renderer)
+	GraphicsAPI api    = (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_NULL ? GRAPHICS_API_NULL : GRAPHICS_API_OPENGL);
+	int         result = RenderEngine::setGraphicsAPI(api);
 
 	if (result < 0)
 		return result;
@@ -528,6 +707,34 @@ int RenderEngine::initResources()
 	return 0;
 }
 
+// BOUNDING SPHERE OF THE MESH AGAINST THE SIDE, NEAR AND FAR PLANES OF THE MAIN CAMERA IN VIEW SPACE
+bool RenderEngine::IsInFrustum(Mesh* mesh)
+{
+	if ((mesh == nullptr) || (RenderEngine::CameraMain == nullptr))
+		return false;
+
+	Camera*   camera     = RenderEngine::CameraMain;
+	glm::mat4 projection = camera->Projection();
+	float     radius     = mesh->Radius();
+	glm::vec3 center     = glm::vec3(camera->View() * glm::vec4(mesh->Position(), 1.0f));
+	float     depth      = -center.z;
+
+	if (((depth + radius) < camera->Near()) || ((depth - radius) > camera->Far()))
+		return false;
+
+	// THE SIDE PLANES GO THROUGH THE EYE: |P[0][0] * x| <= depth AND |P[1][1] * y| <= depth
+	float scaleX = std::abs(projection[0][0]);
+	float scaleY = std::abs(projection[1][1]);
+
+	if (((scaleX * std::abs(center.x)) - depth) > (radius * std::sqrt((scaleX * scaleX) + 1.0f)))
+		return false;
+
+	if (((scaleY * std::abs(center.y)) - depth) > (radius * std::sqrt((scaleY * scaleY) + 1.0f)))
+		return false;
+
+	return true;
+}
+
 int RenderEngine::RemoveMesh(Component* mesh)
 {
 	if (mesh->Parent == nullptr)
@@ -696,6 +903,9 @@ int RenderEngine::setGraphicsAPI(GraphicsAPI api)
 	case GRAPHICS_API_VULKAN:
 		result = RenderEngine::setGraphicsApiVK();
 		break;
+	case GRAPHICS_API_NULL:
+		result = RenderEngine::setGraphicsApiNull();
+		break;
 	default:
 		throw;
 	}
@@ -719,6 +929,13 @@ int RenderEngine::setGraphicsAPI(GraphicsAPI api)
 		return -5;
 	}
 
+	if (Headless::Enabled && (api == GRAPHICS_API_OPENGL) && (Headless::Init(RenderEngine::Canvas.Size) < 0)) {
+		RenderEngine::Close();
+		return -6;
+	}
+
+	GPUTimer::Init();
+
 	if (RenderEngine::CameraMain == nullptr) {
 		SceneManager::AddComponent(new Camera());
 		SceneManager::LoadLightSource(ID_ICON_LIGHT_DIRECTIONAL);
@@ -743,14 +960,29 @@ int RenderEngine::setGraphicsApiCanvas()
 	RenderEngine::Canvas.Window->SetCanvas(RenderEngine::Canvas.Canvas);
 	RenderEngine::SetDrawMode(RenderEngine::Canvas.Window->SelectedDrawMode());
 
-	RenderEngine::Canvas.GL = new wxGLContext(RenderEngine::Canvas.Canvas);
+	// NO GRAPHICS CONTEXT AT ALL - THE CANVAS IS ONLY KEPT FOR INPUT EVENTS AND THE PROJECTION SIZE
+	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_NULL)
+		return 0;
+
+	if (Headless::Enabled)
+	{
+		if (Headless::CreateContext() < 0)
+			return -1;
+	}
+	else
+	{
+		RenderEngine::Canvas.GL = new wxGLContext(RenderEngine::Canvas.Canvas);
+
+		if (!RenderEngine::Canvas.GL->IsOK())
+			return -1;
 
-	if (!RenderEngine::Canvas.GL->IsOK())
-		return -1;
+		RenderEngine::Canvas.Canvas->SetCurrent(*RenderEngine::Canvas.GL);
+	}
 
-	RenderEngine::Canvas.Canvas->SetCurrent(*RenderEngine::Canvas.GL);
+	GLenum glewResult = glewInit();
 
-	if (glewInit() != GLEW_OK)
+	// GLEW ALSO LOOKS FOR A GLX DISPLAY AFTER LOADING THE ENTRY POINTS - AN EGL CONTEXT HAS NONE
+	if ((glewResult != GLEW_OK) && !(Headless::Enabled && (glewResult == GLEW_ERROR_NO_GLX_DISPLAY)))
 		return -2;
 
 	return 0;
@@ -772,7 +1004,8 @@ int RenderEngine::setGraphicsApiGL()
 {
 	glViewport(0, 0, RenderEngine::Canvas.Size.GetWidth(), RenderEngine::Canvas.Size.GetHeight());
 		
-	RenderEngine::SetVSync(RenderEngine::Canvas.Window->VSyncEnable->GetValue());
+	if (!Headless::Enabled)
+		RenderEngine::SetVSync(RenderEngine::Canvas.Window->VSyncEnable->GetValue());
 
 	glEnable(GL_MULTISAMPLE);
 	glEnable(GL_TEXTURE_2D);
@@ -785,6 +1018,22 @@ int RenderEngine::setGraphicsApiGL()
 	return 0;
 }
 
+int RenderEngine::setGraphicsApiNull()
+{
+	RenderEngine::Canvas.Null = new NullContext();
+
+	if (!RenderEngine::Canvas.Null->IsOK()) {
+		RenderEngine::Close();
+		return -1;
+	}
+
+	RenderEngine::GPU.Renderer = "Null (command recorder)";
+	RenderEngine::GPU.Vendor   = "";
+	RenderEngine::GPU.Version  = "Null";
+
+	return 0;
+}
+
 int RenderEngine::setGraphicsApiVK()
 {
 	RenderEngine::Canvas.VK = new VKContext(RenderEngine::Canvas.Window->VSyncEnable->GetValue());
@@ -800,8 +1049,18 @@ int RenderEngine::setGraphicsApiVK()
 ShaderProgram* RenderEngine::setShaderProgram(bool enable, ShaderID program)
 {
 	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL)
+	{
 		glUseProgram(enable ? ShaderManager::Programs[program]->Program() : 0);
 
+		if (enable)
+			RenderStats::AddProgramSwitch();
+	}
+	else if ((RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_NULL) && enable)
+	{
+		RenderEngine::Canvas.Null->BindProgram(program);
+		RenderStats::AddProgramSwitch();
+	}
+
 	return (enable ? ShaderManager::Programs[program] : nullptr);
 }
 
@@ -837,6 +1096,8 @@ void RenderEngine::SetVSync(bool enable)
 		if (RenderEngine::Canvas.VK != nullptr)
 			RenderEngine::Canvas.VK->SetVSync(enable);
 		break;
+	case GRAPHICS_API_NULL:
+		break;
 	default:
 		throw;
 	}
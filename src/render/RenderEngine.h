@@ -31,7 +31,9 @@ public:
 	static void     Close();
 	static void     Draw();
 	static uint16_t GetDrawMode();
+	static float    GetScreenSize(Mesh* mesh);
 	static int      Init(WindowFrame* window, const wxSize &size);
+	static bool     IsInFrustum(Mesh* mesh);
 	static int      RemoveMesh(Component* mesh);
 	static void     SetAspectRatio(const wxString &ratio);
 	static void     SetCanvasSize(int width, int height);
@@ -43,6 +45,7 @@ public:
 private:
 	static void           clear(const glm::vec4 &colorRGBA, const DrawProperties &properties);
 	static void           createDepthFBO();
+	static void           createDepthLayer(DrawProperties &drawProperties, bool &cleared);
 	static void           createWaterFBOs();
 	static int            drawBoundingVolumes();
 	static int            drawSelected();
@@ -53,6 +56,7 @@ private:
 	static int            drawMeshDX11(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
 	static int            drawMeshDX12(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
 	static int            drawMeshGL(Component*   mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
+	static int            drawMeshNull(Component* mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
 	static int            drawMeshVK(Component*   mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
 	static void           drawMesh(Component*     mesh, ShaderProgram* shaderProgram, DrawProperties &properties);
 	static void           drawMeshes(const std::vector<Component*> meshes, DrawProperties &properties);
@@ -63,6 +67,7 @@ private:
 	static int            setGraphicsApiCanvas();
 	static int            setGraphicsApiDX(GraphicsAPI api);
 	static int            setGraphicsApiGL();
+	static int            setGraphicsApiNull();
 	static int            setGraphicsApiVK();
 	static ShaderProgram* setShaderProgram(bool enable, ShaderID program = SHADER_ID_UNKNOWN);
 
@@ -0,0 +1,176 @@
+#include "RenderStats.h"
+
+RenderFrameStats RenderStats::current;
+uint64_t         RenderStats::frames = 0;
+RenderFrameStats RenderStats::last;
+std::mutex       RenderStats::mutex;
+RenderStatsPass  RenderStats::pass   = RENDER_STATS_PASS_NONE;
+RenderFrameStats RenderStats::totals;
+
+void RenderCounters::Add(const RenderCounters &counters)
+{
+	this->BytesUploaded     += counters.BytesUploaded;
+	this->DescriptorUpdates += counters.DescriptorUpdates;
+	this->DrawCalls         += counters.DrawCalls;
+	this->ProgramSwitches   += counters.ProgramSwitches;
+	this->ShadowCasters     += counters.ShadowCasters;
+	this->ShadowCulled      += counters.ShadowCulled;
+	this->TextureBinds      += counters.TextureBinds;
+	this->Triangles         += counters.Triangles;
+}
+
+json11::Json RenderCounters::ToJSON() const
+{
+	return json11::Json::object {
+		{ "draw_calls",         (double)this->DrawCalls },
+		{ "triangles",          (double)this->Triangles },
+		{ "program_switches",   (double)this->ProgramSwitches },
+		{ "texture_binds",      (double)this->TextureBinds },
+		{ "descriptor_updates", (double)this->DescriptorUpdates },
+		{ "bytes_uploaded",     (double)this->BytesUploaded },
+		{ "shadow_casters",     (double)this->ShadowCasters },
+		{ "shadow_culled",      (double)this->ShadowCulled }
+	};
+}
+
+RenderCounters RenderFrameStats::Total() const
+{
+	RenderCounters total;
+
+	for (const auto &counters : this->Passes)
+		total.Add(counters);
+
+	return total;
+}
+
+json11::Json RenderFrameStats::ToJSON() const
+{
+	json11::Json::object passesJSON;
+
+	for (int i = 0; i < NR_OF_RENDER_STATS_PASSES; i++)
+		passesJSON[RenderStats::PassName((RenderStatsPass)i).ToStdString()] = this->Passes[i].ToJSON();
+
+	return json11::Json::object {
+		{ "total",  this->Total().ToJSON() },
+		{ "passes", passesJSON }
+	};
+}
+
+void RenderStats::AddBytesUploaded(uint64_t bytes)
+{
+	RenderStats::current.Passes[RenderStats::pass].BytesUploaded += bytes;
+}
+
+void RenderStats::AddDescriptorUpdates(uint64_t count)
+{
+	RenderStats::current.Passes[RenderStats::pass].DescriptorUpdates += count;
+}
+
+void RenderStats::AddDrawCall(uint64_t triangles)
+{
+	RenderStats::current.Passes[RenderStats::pass].DrawCalls++;
+	RenderStats::current.Passes[RenderStats::pass].Triangles += triangles;
+}
+
+void RenderStats::AddProgramSwitch()
+{
+	RenderStats::current.Passes[RenderStats::pass].ProgramSwitches++;
+}
+
+void RenderStats::AddShadowCaster()
+{
+	RenderStats::current.Passes[RenderStats::pass].ShadowCasters++;
+}
+
+void RenderStats::AddShadowCulled()
+{
+	RenderStats::current.Passes[RenderStats::pass].ShadowCulled++;
+}
+
+void RenderStats::AddTextureBinds(uint64_t count)
+{
+	RenderStats::current.Passes[RenderStats::pass].TextureBinds += count;
+}
+
+void RenderStats::BeginPass(RenderStatsPass newPass)
+{
+	RenderStats::pass = newPass;
+}
+
+// THE COUNTERS ARE ONLY WRITTEN BY THE THREAD OWNING THE GRAPHICS CONTEXT - THE LOCK GUARDS THE PUBLISHED COPIES
+void RenderStats::EndFrame()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	RenderStats::last = RenderStats::current;
+	RenderStats::frames++;
+
+	for (int i = 0; i < NR_OF_RENDER_STATS_PASSES; i++)
+		RenderStats::totals.Passes[i].Add(RenderStats::current.Passes[i]);
+
+	RenderStats::current = {};
+	RenderStats::pass    = RENDER_STATS_PASS_NONE;
+}
+
+void RenderStats::EndPass()
+{
+	RenderStats::pass = RENDER_STATS_PASS_NONE;
+}
+
+uint64_t RenderStats::Frames()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	return RenderStats::frames;
+}
+
+RenderFrameStats RenderStats::LastFrame()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	return RenderStats::last;
+}
+
+wxString RenderStats::PassName(RenderStatsPass statsPass)
+{
+	switch (statsPass) {
+		case RENDER_STATS_PASS_NONE:             return "none";
+		case RENDER_STATS_PASS_DEPTH:            return "depth";
+		case RENDER_STATS_PASS_WATER_REFLECTION: return "water_reflection";
+		case RENDER_STATS_PASS_WATER_REFRACTION: return "water_refraction";
+		case RENDER_STATS_PASS_MAIN:             return "main";
+		case RENDER_STATS_PASS_HUD:              return "hud";
+		default: throw;
+	}
+
+	return "";
+}
+
+void RenderStats::Reset()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	RenderStats::current = {};
+	RenderStats::frames  = 0;
+	RenderStats::last    = {};
+	RenderStats::pass    = RENDER_STATS_PASS_NONE;
+	RenderStats::totals  = {};
+}
+
+json11::Json RenderStats::ToJSON()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	return json11::Json::object {
+		{ "frames",     (double)RenderStats::frames },
+		{ "last_frame", RenderStats::last.ToJSON() },
+		{ "totals",     RenderStats::totals.ToJSON() }
+	};
+}
+
+RenderFrameStats RenderStats::Totals()
+{
+	std::lock_guard<std::mutex> lock(RenderStats::mutex);
+
+	return RenderStats::totals;
+}
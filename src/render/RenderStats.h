@@ -0,0 +1,77 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_RENDERSTATS_H
+#define S3DE_RENDERSTATS_H
+
+// RENDER_STATS_PASS_NONE COLLECTS WORK OUTSIDE OF THE DRAW PASSES - MOSTLY RESOURCE UPLOADS BETWEEN FRAMES
+enum RenderStatsPass
+{
+	RENDER_STATS_PASS_NONE,
+	RENDER_STATS_PASS_DEPTH,
+	RENDER_STATS_PASS_WATER_REFLECTION,
+	RENDER_STATS_PASS_WATER_REFRACTION,
+	RENDER_STATS_PASS_MAIN,
+	RENDER_STATS_PASS_HUD,
+	NR_OF_RENDER_STATS_PASSES
+};
+
+struct RenderCounters
+{
+	uint64_t BytesUploaded     = 0;
+	uint64_t DescriptorUpdates = 0;
+	uint64_t DrawCalls         = 0;
+	uint64_t ProgramSwitches   = 0;
+	uint64_t ShadowCasters     = 0;	// MESHES DRAWN INTO A SHADOW CASCADE
+	uint64_t ShadowCulled      = 0;	// MESHES SKIPPED BY THE CASCADE CASTER TEST
+	uint64_t TextureBinds      = 0;
+	uint64_t Triangles         = 0;
+
+	void         Add(const RenderCounters &counters);
+	json11::Json ToJSON() const;
+};
+
+struct RenderFrameStats
+{
+	RenderCounters Passes[NR_OF_RENDER_STATS_PASSES];
+
+	RenderCounters Total() const;
+	json11::Json   ToJSON() const;
+};
+
+class RenderStats
+{
+private:
+	RenderStats()  {}
+	~RenderStats() {}
+
+private:
+	static RenderFrameStats current;
+	static uint64_t         frames;
+	static RenderFrameStats last;
+	static std::mutex       mutex;
+	static RenderStatsPass  pass;
+	static RenderFrameStats totals;
+
+public:
+	static void             AddBytesUploaded(uint64_t bytes);
+	static void             AddDescriptorUpdates(uint64_t count = 1);
+	static void             AddDrawCall(uint64_t triangles);
+	static void             AddProgramSwitch();
+	static void             AddShadowCaster();
+	static void             AddShadowCulled();
+	static void             AddTextureBinds(uint64_t count = 1);
+	static void             BeginPass(RenderStatsPass newPass);
+	static void             EndFrame();
+	static void             EndPass();
+	static uint64_t         Frames();
+	static RenderFrameStats LastFrame();
+	static wxString         PassName(RenderStatsPass statsPass);
+	static void             Reset();
+	static json11::Json     ToJSON();
+	static RenderFrameStats Totals();
+
+};
+
+#endif
@@ -0,0 +1,422 @@
+#include "RenderThread.h"
+
+static const int SNAPSHOT_DIRTY = 0x4;
+static const int SNAPSHOT_INDEX = 0x3;
+
+int                          RenderThread::back           = 0;
+std::condition_variable      RenderThread::condition;
+int                          RenderThread::front          = 2;
+thread_local RenderSnapshot* RenderThread::frame          = nullptr;
+std::atomic<uint64_t>        RenderThread::generation(0);
+std::atomic<int>             RenderThread::middle(1);
+std::mutex                   RenderThread::mutex;
+bool                         RenderThread::paused         = false;
+int                          RenderThread::pauseCount     = 0;
+bool                         RenderThread::pauseRequested = false;
+bool                         RenderThread::running        = false;
+RenderSnapshot               RenderThread::snapshots[3];
+std::thread                  RenderThread::thread;
+
+RenderSnapshot* RenderThread::acquire()
+{
+	if ((RenderThread::middle & SNAPSHOT_DIRTY) == 0)
+		return nullptr;
+
+	RenderThread::front = (RenderThread::middle.exchange(RenderThread::front) & SNAPSHOT_INDEX);
+
+	return &RenderThread::snapshots[RenderThread::front];
+}
+
+void RenderThread::addItem(RenderSnapshot* snapshot, Component* component)
+{
+	if ((component == nullptr) || (snapshot->Items.find(component->ID()) != snapshot->Items.end()))
+		return;
+
+	Mesh*      mesh = dynamic_cast<Mesh*>(component);
+	HUD*       hud  = dynamic_cast<HUD*>(component->Parent);
+	RenderItem item = {};
+
+	item.ItemMaterial = component->ComponentMaterial;
+	item.Matrix       = component->InterpolatedMatrix();
+	item.Selected     = ((mesh != nullptr) && mesh->IsSelected());
+	item.Transparent  = ((hud != nullptr) && hud->Transparent);
+
+	for (int i = 0; i < MAX_TEXTURES; i++) {
+		item.IsTextured[i]    = component->IsTextured(i);
+		item.Textures[i]      = component->Textures[i];
+		item.TextureScales[i] = component->TextureScales[i];
+	}
+
+	snapshot->Items[component->ID()] = item;
+
+	if (mesh != nullptr)
+		RenderThread::addItem(snapshot, mesh->GetBoundingVolume());
+
+	RenderThread::addItem(snapshot, component->Parent);
+}
+
+Camera* RenderThread::GetCamera()
+{
+	return (RenderThread::frame != nullptr ? RenderThread::frame->FrameCamera : RenderEngine::CameraMain);
+}
+
+void RenderThread::GetClusteredLights(std::vector<CBLight> &lights)
+{
+	if (RenderThread::frame != nullptr) {
+		lights = RenderThread::frame->ClusteredLights;
+		return;
+	}
+
+	lights.clear();
+
+	for (auto light : SceneManager::ClusteredLights)
+		lights.push_back(CBLight(light));
+}
+
+const std::vector<Component*>& RenderThread::GetHUDs()
+{
+	return (RenderThread::frame != nullptr ? RenderThread::frame->HUDs : RenderEngine::HUDs);
+}
+
+bool RenderThread::GetLight(int index, CBLight &light)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		if (!RenderThread::frame->LightsValid[index])
+			return false;
+
+		light = RenderThread::frame->Lights[index];
+
+		return true;
+	}
+
+	if (SceneManager::LightSources[index] == nullptr)
+		return false;
+
+	light = CBLight(SceneManager::LightSources[index]);
+
+	return true;
+}
+
+const std::vector<Component*>& RenderThread::GetLightSources()
+{
+	return (RenderThread::frame != nullptr ? RenderThread::frame->LightSources : RenderEngine::LightSources);
+}
+
+Material* RenderThread::GetMaterial(Component* component)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return &item->second.ItemMaterial;
+	}
+
+	return &component->ComponentMaterial;
+}
+
+glm::mat4 RenderThread::GetMatrix(Component* component)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.Matrix;
+	}
+
+	return component->InterpolatedMatrix();
+}
+
+const std::vector<Component*>& RenderThread::GetRenderables()
+{
+	return (RenderThread::frame != nullptr ? RenderThread::frame->Renderables : RenderEngine::Renderables);
+}
+
+Mesh* RenderThread::GetSkybox()
+{
+	return (RenderThread::frame != nullptr ? RenderThread::frame->Skybox : RenderEngine::Skybox);
+}
+
+Texture* RenderThread::GetTexture(Component* component, int index)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.Textures[index];
+	}
+
+	return component->Textures[index];
+}
+
+glm::vec2 RenderThread::GetTextureScale(Component* component, int index)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.TextureScales[index];
+	}
+
+	return component->TextureScales[index];
+}
+
+bool RenderThread::IsRunning()
+{
+	return RenderThread::running;
+}
+
+bool RenderThread::IsSelected(Component* mesh)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(mesh->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.Selected;
+	}
+
+	return dynamic_cast<Mesh*>(mesh)->IsSelected();
+}
+
+bool RenderThread::IsTextured(Component* component, int index)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.IsTextured[index];
+	}
+
+	return component->IsTextured(index);
+}
+
+// THE TRANSPARENCY OF THE HUD THE PLANE BELONGS TO
+bool RenderThread::IsTransparent(Component* component)
+{
+	if (RenderThread::frame != nullptr)
+	{
+		auto item = RenderThread::frame->Items.find(component->ID());
+
+		if (item != RenderThread::frame->Items.end())
+			return item->second.Transparent;
+	}
+
+	HUD* hud = dynamic_cast<HUD*>(component->Parent);
+
+	return ((hud != nullptr) && hud->Transparent);
+}
+
+void RenderThread::makeCurrent()
+{
+	if ((RenderEngine::Canvas.GL != nullptr) && (RenderEngine::Canvas.Canvas != nullptr))
+		RenderEngine::Canvas.GL->SetCurrent(*RenderEngine::Canvas.Canvas);
+}
+
+void RenderThread::Pause()
+{
+	if (!RenderThread::running || (std::this_thread::get_id() == RenderThread::thread.get_id()))
+		return;
+
+	std::unique_lock<std::mutex> lock(RenderThread::mutex);
+
+	if (RenderThread::pauseCount++ > 0)
+		return;
+
+	// SNAPSHOTS PUBLISHED BEFORE THE PAUSE MAY REFERENCE DELETED COMPONENTS
+	RenderThread::generation++;
+	RenderThread::pauseRequested = true;
+
+	RenderThread::condition.notify_all();
+	RenderThread::condition.wait(lock, []() { return (RenderThread::paused || !RenderThread::running); });
+
+	RenderThread::makeCurrent();
+}
+
+void RenderThread::Publish()
+{
+	PROFILE_SCOPE("RenderThread::Publish");
+
+	if (!RenderThread::running || (RenderEngine::CameraMain == nullptr))
+		return;
+
+	RenderSnapshot* snapshot = &RenderThread::snapshots[RenderThread::back];
+
+	_DELETEP(snapshot->FrameCamera);
+
+	snapshot->FrameCamera  = new Camera(*RenderEngine::CameraMain);
+	snapshot->Generation   = RenderThread::generation;
+	snapshot->HUDs         = RenderEngine::HUDs;
+	snapshot->LightSources = RenderEngine::LightSources;
+	snapshot->Renderables  = RenderEngine::Renderables;
+	snapshot->Skybox       = RenderEngine::Skybox;
+
+	snapshot->Items.clear();
+
+	for (auto component : snapshot->HUDs)
+		RenderThread::addItem(snapshot, component);
+
+	for (auto component : snapshot->LightSources)
+		RenderThread::addItem(snapshot, component);
+
+	for (auto component : snapshot->Renderables)
+		RenderThread::addItem(snapshot, component);
+
+	RenderThread::addItem(snapshot, snapshot->Skybox);
+
+	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+	{
+		snapshot->LightsValid[i] = (SceneManager::LightSources[i] != nullptr);
+
+		if (snapshot->LightsValid[i])
+			snapshot->Lights[i] = CBLight(SceneManager::LightSources[i]);
+	}
+
+	snapshot->ClusteredLights.clear();
+
+	for (auto light : SceneManager::ClusteredLights)
+		snapshot->ClusteredLights.push_back(CBLight(light));
+
+	// SWAP THE BACK BUFFER WITH THE MIDDLE BUFFER - NEVER BLOCKS
+	RenderThread::back = (RenderThread::middle.exchange(RenderThread::back | SNAPSHOT_DIRTY) & SNAPSHOT_INDEX);
+
+	RenderThread::condition.notify_all();
+}
+
+void RenderThread::releaseCurrent()
+{
+	#if defined _WINDOWS
+		wglMakeCurrent(nullptr, nullptr);
+	#else
+		glXMakeCurrent(glXGetCurrentDisplay(), None, nullptr);
+	#endif
+}
+
+void RenderThread::Resume()
+{
+	if (!RenderThread::running || (std::this_thread::get_id() == RenderThread::thread.get_id()))
+		return;
+
+	std::lock_guard<std::mutex> lock(RenderThread::mutex);
+
+	if (--RenderThread::pauseCount > 0)
+		return;
+
+	RenderThread::releaseCurrent();
+
+	RenderThread::pauseRequested = false;
+	RenderThread::condition.notify_all();
+}
+
+void RenderThread::run()
+{
+	PROFILE_THREAD("Render");
+
+	RenderThread::makeCurrent();
+
+	while (true)
+	{
+		std::unique_lock<std::mutex> lock(RenderThread::mutex);
+
+		if (!RenderThread::running)
+			break;
+
+		// HAND THE GL CONTEXT OVER TO THE PAUSING THREAD
+		if (RenderThread::pauseRequested)
+		{
+			RenderThread::releaseCurrent();
+
+			RenderThread::paused = true;
+			RenderThread::condition.notify_all();
+			RenderThread::condition.wait(lock, []() { return (!RenderThread::pauseRequested || !RenderThread::running); });
+			RenderThread::paused = false;
+
+			if (!RenderThread::running)
+				return;
+
+			lock.unlock();
+			RenderThread::makeCurrent();
+
+			continue;
+		}
+
+		RenderSnapshot* snapshot = RenderThread::acquire();
+
+		if ((snapshot == nullptr) || (snapshot->Generation != RenderThread::generation)) {
+			RenderThread::condition.wait_for(lock, std::chrono::milliseconds(1));
+			continue;
+		}
+
+		lock.unlock();
+
+		RenderThread::frame = snapshot;
+		RenderEngine::Draw();
+		RenderThread::frame = nullptr;
+	}
+
+	RenderThread::releaseCurrent();
+}
+
+int RenderThread::Start()
+{
+	if (RenderThread::running)
+		return -1;
+
+	if ((RenderEngine::SelectedGraphicsAPI != GRAPHICS_API_OPENGL) || (RenderEngine::Canvas.GL == nullptr))
+		return -2;
+
+	RenderThread::back           = 0;
+	RenderThread::front          = 2;
+	RenderThread::middle         = 1;
+	RenderThread::paused         = false;
+	RenderThread::pauseCount     = 0;
+	RenderThread::pauseRequested = false;
+	RenderThread::running        = true;
+
+	// HAND THE GL CONTEXT OVER TO THE RENDER THREAD
+	RenderThread::releaseCurrent();
+
+	RenderThread::thread = std::thread(RenderThread::run);
+
+	return 0;
+}
+
+void RenderThread::Stop()
+{
+	if (!RenderThread::running)
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(RenderThread::mutex);
+		RenderThread::running = false;
+	}
+
+	RenderThread::condition.notify_all();
+
+	if (RenderThread::thread.joinable())
+		RenderThread::thread.join();
+
+	// TAKE BACK THE GL CONTEXT UNLESS A PAUSE ALREADY HANDED IT TO THIS THREAD
+	if (RenderThread::pauseCount == 0)
+		RenderThread::makeCurrent();
+
+	RenderThread::frame      = nullptr;
+	RenderThread::pauseCount = 0;
+
+	for (auto &snapshot : RenderThread::snapshots)
+	{
+		_DELETEP(snapshot.FrameCamera);
+
+		snapshot.ClusteredLights.clear();
+		snapshot.HUDs.clear();
+		snapshot.Items.clear();
+		snapshot.LightSources.clear();
+		snapshot.Renderables.clear();
+		snapshot.Skybox = nullptr;
+	}
+}
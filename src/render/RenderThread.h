@@ -0,0 +1,97 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_RENDERTHREAD_H
+#define S3DE_RENDERTHREAD_H
+
+struct RenderItem
+{
+	bool      IsTextured[MAX_TEXTURES]    = {};
+	Material  ItemMaterial                = {};
+	glm::mat4 Matrix                      = {};
+	bool      Selected                    = false;
+	Texture*  Textures[MAX_TEXTURES]      = {};
+	glm::vec2 TextureScales[MAX_TEXTURES] = {};
+	bool      Transparent                 = false;	// HUD
+};
+
+struct RenderSnapshot
+{
+	std::vector<CBLight>                     ClusteredLights;
+	Camera*                                  FrameCamera = nullptr;
+	uint64_t                                 Generation  = 0;
+	std::vector<Component*>                  HUDs;
+	std::unordered_map<uint32_t, RenderItem> Items;
+	std::vector<Component*>                  LightSources;
+	CBLight                                  Lights[MAX_LIGHT_SOURCES];
+	bool                                     LightsValid[MAX_LIGHT_SOURCES] = {};
+	std::vector<Component*>                  Renderables;
+	Mesh*                                    Skybox = nullptr;
+
+	~RenderSnapshot()
+	{
+		_DELETEP(this->FrameCamera);
+	}
+};
+
+class RenderThread
+{
+private:
+	RenderThread()  {}
+	~RenderThread() {}
+
+private:
+	static std::condition_variable      condition;
+	static int                          front;
+	static thread_local RenderSnapshot* frame;
+	static std::atomic<uint64_t>        generation;
+	static std::atomic<int>             middle;
+	static std::mutex                   mutex;
+	static int                          back;
+	static bool                         paused;
+	static int                          pauseCount;
+	static bool                         pauseRequested;
+	static bool                         running;
+	static RenderSnapshot               snapshots[3];
+	static std::thread                  thread;
+
+public:
+	static Camera*                        GetCamera();
+	static void                           GetClusteredLights(std::vector<CBLight> &lights);
+	static const std::vector<Component*>& GetHUDs();
+	static bool                           GetLight(int index, CBLight &light);
+	static const std::vector<Component*>& GetLightSources();
+	static Material*                      GetMaterial(Component* component);
+	static glm::mat4                      GetMatrix(Component* component);
+	static const std::vector<Component*>& GetRenderables();
+	static Mesh*                          GetSkybox();
+	static Texture*                       GetTexture(Component* component, int index);
+	static glm::vec2                      GetTextureScale(Component* component, int index);
+	static bool                           IsRunning();
+	static bool                           IsSelected(Component* mesh);
+	static bool                           IsTextured(Component* component, int index);
+	static bool                           IsTransparent(Component* component);
+	static void                           Pause();
+	static void                           Publish();
+	static void                           Resume();
+	static int                            Start();
+	static void                           Stop();
+
+private:
+	static RenderSnapshot* acquire();
+	static void            addItem(RenderSnapshot* snapshot, Component* component);
+	static void            makeCurrent();
+	static void            releaseCurrent();
+	static void            run();
+
+};
+
+// PAUSES THE RENDER THREAD AND HANDS THE GL CONTEXT TO THE CALLING THREAD FOR THE LIFETIME OF THE LOCK
+struct RenderThreadLock
+{
+	RenderThreadLock()  { RenderThread::Pause(); }
+	~RenderThreadLock() { RenderThread::Resume(); }
+};
+
+#endif
@@ -1,6 +1,67 @@
 #include "ShaderManager.h"
 
+bool           ShaderManager::EnableProgramCache = true;
 ShaderProgram* ShaderManager::Programs[NR_OF_SHADERS];
+int            ShaderManager::cacheHits          = 0;
+
+static const wxString PROGRAM_CACHE_DIR   = "shadercache";
+static const char     PROGRAM_CACHE_ID[8] = { 'S', '3', 'D', 'E', 'P', 'R', 'G', 0 };
+
+json11::Json ShaderStartupBenchmark::ToJSON() const
+{
+	return json11::Json::object {
+		{ "api",        this->API.ToStdString() },
+		{ "runs",       this->Runs },
+		{ "cold_ms",    this->ColdMS },
+		{ "warm_ms",    this->WarmMS },
+		{ "cache_hits", this->CacheHits }
+	};
+}
+
+// COLD: EMPTY PROGRAM BINARY CACHE, WARM: CACHE FILLED BY THE PREVIOUS COLD RUN
+ShaderStartupBenchmark ShaderManager::Benchmark(int runs)
+{
+	ShaderStartupBenchmark result = {};
+
+	// THE GL CONTEXT BELONGS TO THE RENDER THREAD WHILE IT IS RUNNING
+	if ((runs < 1) || RenderThread::IsRunning())
+		return result;
+
+	result.API  = Utils::GetGraphicsAPI(RenderEngine::SelectedGraphicsAPI);
+	result.Runs = runs;
+
+	for (int i = 0; i < runs; i++)
+	{
+		ShaderManager::ClearProgramCache();
+
+		wxStopWatch cold;
+		ShaderManager::Init();
+		result.ColdMS += (double)cold.TimeInMicro().GetValue() / 1000.0;
+
+		wxStopWatch warm;
+		ShaderManager::Init();
+		result.WarmMS += (double)warm.TimeInMicro().GetValue() / 1000.0;
+
+		result.CacheHits += ShaderManager::cacheHits;
+	}
+
+	result.ColdMS    /= (double)runs;
+	result.WarmMS    /= (double)runs;
+	result.CacheHits /= runs;
+
+	return result;
+}
+
+void ShaderManager::ClearProgramCache()
+{
+	wxArrayString files;
+
+	if (wxDirExists(PROGRAM_CACHE_DIR))
+		wxDir::GetAllFiles(PROGRAM_CACHE_DIR, &files, "*.bin", wxDIR_FILES);
+
+	for (const auto &file : files)
+		wxRemoveFile(file);
+}
 
 void ShaderManager::Close()
 {
@@ -8,10 +69,32 @@ void ShaderManager::Close()
 		_DELETEP(ShaderManager::Programs[i]);
 }
 
+wxString ShaderManager::getCacheFile(uint64_t key)
+{
+	return wxString::Format("%s/%016llx.bin", PROGRAM_CACHE_DIR, (unsigned long long)key);
+}
+
+// FNV-1a OVER THE DRIVER (VENDOR, RENDERER, VERSION) AND THE SHADER SOURCES - A DRIVER UPDATE OR SHADER EDIT MISSES THE CACHE
+uint64_t ShaderManager::getCacheKey(const wxString &vs, const wxString &fs, const wxString &gs)
+{
+	uint64_t    hash    = 14695981039346656037ULL;
+	std::string sources = (
+		std::string((const char*)glGetString(GL_VENDOR)) + (const char*)glGetString(GL_RENDERER) + (const char*)glGetString(GL_VERSION) +
+		vs.ToStdString() + gs.ToStdString() + fs.ToStdString()
+	);
+
+	for (auto byte : sources)
+		hash = ((hash ^ (uint8_t)byte) * 1099511628211ULL);
+
+	return hash;
+}
+
 int ShaderManager::Init()
 {
 	ShaderManager::Close();
 
+	ShaderManager::cacheHits = 0;
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 	#if defined _WINDOWS
 	case GRAPHICS_API_DIRECTX11:
@@ -66,6 +149,17 @@ int ShaderManager::Init()
 			}
 		}
 
+		break;
+	// NOTHING TO COMPILE - THE PROGRAMS ONLY IDENTIFY WHICH CONSTANT BUFFERS AND TEXTURES A DRAW RECORDS
+	case GRAPHICS_API_NULL:
+		for (int i = 0; i < NR_OF_SHADERS; i++)
+		{
+			ShaderManager::Programs[i] = new ShaderProgram(Utils::SHADER_RESOURCES_DX[i].Name);
+
+			if (!ShaderManager::Programs[i]->IsOK())
+				return -1;
+		}
+
 		break;
 	default:
 		throw;
@@ -73,3 +167,87 @@ int ShaderManager::Init()
 
 	return 0;
 }
+
+// HEADER: 8 BYTES ID, 8 BYTES KEY, 4 BYTES BINARY FORMAT, 4 BYTES BINARY SIZE
+int ShaderManager::LoadProgramBinary(GLuint program, const wxString &vs, const wxString &fs, const wxString &gs)
+{
+	if (!ShaderManager::EnableProgramCache || !(GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary))
+		return -1;
+
+	uint64_t      key  = ShaderManager::getCacheKey(vs, fs, gs);
+	wxString      file = ShaderManager::getCacheFile(key);
+	std::ifstream fileStream(file.wc_str(), std::ios::binary);
+
+	if (!fileStream.good())
+		return -2;
+
+	char     id[8]   = {};
+	uint64_t fileKey = 0;
+	GLenum   format  = 0;
+	uint32_t size    = 0;
+
+	fileStream.read(id, sizeof(id));
+	fileStream.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+	fileStream.read(reinterpret_cast<char*>(&format),  sizeof(format));
+	fileStream.read(reinterpret_cast<char*>(&size),    sizeof(size));
+
+	if (!fileStream.good() || (std::memcmp(id, PROGRAM_CACHE_ID, sizeof(id)) != 0) || (fileKey != key) || (size == 0))
+		return -3;
+
+	std::vector<uint8_t> binary(size);
+	fileStream.read(reinterpret_cast<char*>(binary.data()), size);
+
+	if (!fileStream.good())
+		return -4;
+
+	GLint resultLink;
+
+	glProgramBinary(program, format, binary.data(), (GLsizei)size);
+	glGetProgramiv(program, GL_LINK_STATUS, &resultLink);
+
+	// THE DRIVER CAN REJECT A BINARY EVEN IF THE KEY MATCHES
+	if (resultLink != GL_TRUE) {
+		wxRemoveFile(file);
+		return -5;
+	}
+
+	ShaderManager::cacheHits++;
+
+	return 0;
+}
+
+int ShaderManager::SaveProgramBinary(GLuint program, const wxString &vs, const wxString &fs, const wxString &gs)
+{
+	if (!ShaderManager::EnableProgramCache || !(GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary))
+		return -1;
+
+	GLint size = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+
+	if (size < 1)
+		return -2;
+
+	std::vector<uint8_t> binary(size);
+	GLenum               format = 0;
+
+	glGetProgramBinary(program, size, &size, &format, binary.data());
+
+	if (!wxDirExists(PROGRAM_CACHE_DIR) && !wxMkdir(PROGRAM_CACHE_DIR))
+		return -3;
+
+	uint64_t      key    = ShaderManager::getCacheKey(vs, fs, gs);
+	uint32_t      size32 = (uint32_t)size;
+	std::ofstream fileStream(ShaderManager::getCacheFile(key).wc_str(), std::ios::binary);
+
+	if (!fileStream.good())
+		return -4;
+
+	fileStream.write(PROGRAM_CACHE_ID, sizeof(PROGRAM_CACHE_ID));
+	fileStream.write(reinterpret_cast<const char*>(&key),    sizeof(key));
+	fileStream.write(reinterpret_cast<const char*>(&format), sizeof(format));
+	fileStream.write(reinterpret_cast<const char*>(&size32), sizeof(size32));
+	fileStream.write(reinterpret_cast<const char*>(binary.data()), size32);
+	fileStream.close();
+
+	return 0;
+}
@@ -5,6 +5,17 @@
 #ifndef S3DE_SHADERMANAGER_H
 #define S3DE_SHADERMANAGER_H
 
+struct ShaderStartupBenchmark
+{
+	wxString API       = "";
+	int      CacheHits = 0;
+	double   ColdMS    = 0.0;
+	int      Runs      = 0;
+	double   WarmMS    = 0.0;
+
+	json11::Json ToJSON() const;
+};
+
 class ShaderManager
 {
 private:
@@ -12,11 +23,23 @@ private:
 	~ShaderManager() {}
 
 public:
+	static bool           EnableProgramCache;
 	static ShaderProgram* Programs[NR_OF_SHADERS];
 
+private:
+	static int cacheHits;
+
 public:
-	static void Close();
-	static int  Init();
+	static ShaderStartupBenchmark Benchmark(int runs = 5);
+	static void                   ClearProgramCache();
+	static void                   Close();
+	static int                    Init();
+	static int                    LoadProgramBinary(GLuint program, const wxString &vs, const wxString &fs, const wxString &gs);
+	static int                    SaveProgramBinary(GLuint program, const wxString &vs, const wxString &fs, const wxString &gs);
+
+private:
+	static wxString getCacheFile(uint64_t key);
+	static uint64_t getCacheKey(const wxString &vs, const wxString &fs, const wxString &gs);
 
 };
 
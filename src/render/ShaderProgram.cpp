@@ -2,8 +2,13 @@
 
 ShaderProgram::ShaderProgram(const wxString &name)
 {
+	this->base          = nullptr;
+	this->features      = SHADER_FEATURES_ALL;
 	this->name          = name;
 	this->program       = 0;
+	this->sourceFS      = "";
+	this->sourceGS      = "";
+	this->sourceVS      = "";
 	this->vulkanFS      = nullptr;
 	this->vulkanGS      = nullptr;
 	this->vulkanVS      = nullptr;
@@ -32,12 +37,22 @@ ShaderProgram::~ShaderProgram()
 		_RELEASEP(this->fs);
 	#endif
 
+	for (auto &variant : this->variants)
+		_DELETEP(variant.second);
+
+	this->variants.clear();
+
 	if (this->program > 0)
 		glDeleteProgram(this->program);
 
-	RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanFS);
-	RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanGS);
-	RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanVS);
+	// VARIANTS SHARE THE SHADER MODULES OF THE BASE PROGRAM
+	if (this->base == nullptr) {
+		RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanFS);
+		RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanGS);
+		RenderEngine::Canvas.VK->DestroyShaderModule(&this->vulkanVS);
+	}
+
+	MemoryTracker::Free(this);
 }
 
 #if defined _WINDOWS
@@ -98,7 +113,7 @@ const void* ShaderProgram::getBufferValues(const CBMatrix &matrices, Component*
 		break;
 	case SHADER_ID_HUD:
 		vertexBuffer->ConstantBufferHUD = CBHUDDX(
-			matrices, mesh->ComponentMaterial.diffuse, dynamic_cast<HUD*>(mesh->Parent)->Transparent
+			matrices, mesh->ComponentMaterial.diffuse, RenderThread::IsTransparent(mesh)
 		);
 
 		bufferSize   = sizeof(vertexBuffer->ConstantBufferHUD);
@@ -118,6 +133,68 @@ const void* ShaderProgram::getBufferValues(const CBMatrix &matrices, Component*
 }
 #endif
 
+uint32_t ShaderProgram::Features()
+{
+	return this->features;
+}
+
+uint32_t ShaderProgram::GetFeatures(Component* mesh, const DrawProperties &properties, uint32_t lightFeatures)
+{
+	if (mesh == nullptr)
+		return SHADER_FEATURES_ALL;
+
+	uint32_t features = lightFeatures;
+
+	if (properties.EnableClipping)
+		features |= SHADER_FEATURE_CLIPPING;
+
+	if (RenderThread::IsTextured(mesh, 0))
+		features |= SHADER_FEATURE_DIFFUSE_MAP;
+
+	if (RenderThread::IsTextured(mesh, 1))
+		features |= SHADER_FEATURE_SPECULAR_MAP;
+
+	if (RenderEngine::EnableSRGB)
+		features |= SHADER_FEATURE_SRGB;
+
+	if (mesh->Type() == COMPONENT_TERRAIN)
+		features |= SHADER_FEATURE_TERRAIN;
+	else if (mesh->Type() == COMPONENT_WATER)
+		features |= SHADER_FEATURE_WATER;
+
+	return features;
+}
+
+// THE LIGHT SLOTS ARE NOT COMPACTED (THE DEPTH MAP LAYERS ARE INDEXED BY SLOT),
+// SO THE LIGHT COUNT IS THE HIGHEST ACTIVE SLOT + 1
+uint32_t ShaderProgram::GetLightFeatures()
+{
+	uint32_t features   = SHADER_FEATURE_NONE;
+	uint32_t lightCount = 0;
+
+	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+	{
+		CBLight light = {};
+
+		if (!RenderThread::GetLight(i, light) || (light.Active.x < 0.1f))
+			continue;
+
+		if (light.Active.y > 16.9f)
+			features |= SHADER_FEATURE_LIGHT_SPOT;
+		else if (light.Active.y > 15.9f)
+			features |= SHADER_FEATURE_LIGHT_POINT;
+		else
+			features |= SHADER_FEATURE_LIGHT_DIRECTIONAL;
+
+		lightCount = (i + 1);
+	}
+
+	if (LightCluster::Lights() > 0)
+		features |= SHADER_FEATURE_LIGHT_CLUSTERED;
+
+	return (features | (lightCount << SHADER_FEATURE_LIGHTS_SHIFT));
+}
+
 ShaderID ShaderProgram::ID()
 {
 	if (this->name == Utils::SHADER_RESOURCES_DX[SHADER_ID_COLOR].Name)
@@ -151,6 +228,8 @@ bool ShaderProgram::IsOK()
 			return (this->program > 0);
 		case GRAPHICS_API_VULKAN:
 			return ((this->vulkanVS != nullptr) && (this->vulkanFS != nullptr));
+		case GRAPHICS_API_NULL:
+			return (this->ID() != SHADER_ID_UNKNOWN);
 		default:
 			throw;
 	}
@@ -201,21 +280,51 @@ int ShaderProgram::Load(const wxString &shaderFile)
 	return result;
 }
 
+wxString ShaderProgram::injectFeaturesGL(const wxString &sourceText, uint32_t features)
+{
+	wxString defines = wxString::Format(
+		"#define FEATURES    %u\n#define LIGHT_COUNT %u\n",
+		(features & SHADER_FEATURE_FLAGS), (features >> SHADER_FEATURE_LIGHTS_SHIFT)
+	);
+
+	// THE DEFINES HAVE TO FOLLOW THE #version DIRECTIVE
+	size_t version = sourceText.find("#version");
+	size_t newLine = (version != wxString::npos ? sourceText.find("\n", version) : wxString::npos);
+
+	if (newLine == wxString::npos)
+		return (defines + sourceText);
+
+	return (sourceText.substr(0, newLine + 1) + defines + sourceText.substr(newLine + 1));
+}
+
 int ShaderProgram::LoadAndLink(const wxString &vs, const wxString &fs, const wxString& gs)
 {
+	this->sourceFS = fs;
+	this->sourceGS = gs;
+	this->sourceVS = vs;
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 	case GRAPHICS_API_OPENGL:
-		if (this->loadShaderGL(GL_VERTEX_SHADER, vs) < 0)
-			return -1;
+		// PROGRAM BINARY CACHE - SKIPS COMPILING AND LINKING ON A HIT
+		if (ShaderManager::LoadProgramBinary(this->program, vs, fs, gs) < 0)
+		{
+			if (this->loadShaderGL(GL_VERTEX_SHADER, vs) < 0)
+				return -1;
 
-		if (!gs.empty() && (this->loadShaderGL(GL_GEOMETRY_SHADER, gs) < 0))
-			return -2;
+			if (!gs.empty() && (this->loadShaderGL(GL_GEOMETRY_SHADER, gs) < 0))
+				return -2;
+
+			if (this->loadShaderGL(GL_FRAGMENT_SHADER, fs) < 0)
+				return -3;
 
-		if (this->loadShaderGL(GL_FRAGMENT_SHADER, fs) < 0)
-			return -3;
+			if (ShaderManager::EnableProgramCache && (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary))
+				glProgramParameteri(this->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
-		if (this->Link() < 0)
-			return -4;
+			if (this->Link() < 0)
+				return -4;
+
+			ShaderManager::SaveProgramBinary(this->program, vs, fs, gs);
+		}
 
 		this->setAttribsGL();
 		this->setUniformsGL();
@@ -353,6 +462,8 @@ void ShaderProgram::setUniformsGL()
 	this->Uniforms[UBO_GL_HUD] = glGetUniformBlockIndex(this->program, "HUDBuffer");
 	glGenBuffers(1, &this->UniformBuffers[UBO_GL_HUD]);
 
+	MemoryTracker::Allocate(this, MEMORY_TAG_UNIFORMS, MEMORY_GPU, (sizeof(CBMatrix) + sizeof(CBColor) + sizeof(CBDefault) + sizeof(CBDepth) + sizeof(CBHUD)));
+
 	// MESH TEXTURES
 	for (int i = 0; i < MAX_TEXTURES; i++)
 		this->Uniforms[UBO_GL_TEXTURES0 + i] = glGetUniformLocation(this->program, wxString("Textures[" + std::to_string(i) + "]").c_str());
@@ -401,7 +512,7 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 		CBMatrix mb;
 
 		if ((shaderID == SHADER_ID_DEPTH) || (shaderID == SHADER_ID_DEPTH_OMNI))
-			mb = CBMatrix(properties.Light, mesh);
+			mb = CBMatrix(properties.Light, mesh, properties.Cascade);
 		else
 			mb = CBMatrix(mesh, (shaderID == SHADER_ID_SKYBOX));
 
@@ -412,7 +523,7 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 	id = this->Uniforms[UBO_GL_COLOR];
 
 	if (id >= 0) {
-		CBColor cb = CBColor(dynamic_cast<Mesh*>(mesh)->GetBoundingVolume() != nullptr ? mesh->ComponentMaterial.diffuse : mesh->Parent->ComponentMaterial.diffuse);
+		CBColor cb = CBColor(RenderThread::GetMaterial(dynamic_cast<Mesh*>(mesh)->GetBoundingVolume() != nullptr ? mesh : mesh->Parent)->diffuse);
 		this->updateUniformGL(id, UBO_GL_COLOR, &cb, sizeof(cb));
 	}
 
@@ -436,7 +547,7 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 	id = this->Uniforms[UBO_GL_HUD];
 
 	if (id >= 0) {
-		CBHUD hb = CBHUD(mesh->ComponentMaterial.diffuse, dynamic_cast<HUD*>(mesh->Parent)->Transparent);
+		CBHUD hb = CBHUD(RenderThread::GetMaterial(mesh)->diffuse, RenderThread::IsTransparent(mesh));
 		this->updateUniformGL(id, UBO_GL_HUD, &hb, sizeof(hb));
 	}
 
@@ -448,7 +559,11 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 		if (id >= 0) {
 			glActiveTexture(GL_TEXTURE0 + i);
 			glUniform1i(id, i);
-			glBindTexture(mesh->Textures[i]->TypeGL(), mesh->Textures[i]->ID());
+			Texture* texture = LightCluster::GetTexture(shaderID, mesh, i);
+
+			glBindTexture(texture->TypeGL(), texture->ID());
+
+			RenderStats::AddTextureBinds();
 		} else {
 			glBindTexture(GL_TEXTURE0 + i, 0);
 		}
@@ -461,6 +576,8 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 		glActiveTexture(GL_TEXTURE6);
 		glUniform1i(this->Uniforms[UBO_GL_TEXTURES6], 6);
 		glBindTexture(GL_TEXTURE_2D_ARRAY, SceneManager::DepthMap2D->GetTexture()->ID());
+
+		RenderStats::AddTextureBinds();
 	} else {
 		glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 	}
@@ -472,6 +589,8 @@ int ShaderProgram::UpdateUniformsGL(Component* mesh, const DrawProperties &prope
 		glActiveTexture(GL_TEXTURE7);
 		glUniform1i(this->Uniforms[UBO_GL_TEXTURES7], 7);
 		glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, SceneManager::DepthMapCube->GetTexture()->ID());
+
+		RenderStats::AddTextureBinds();
 	} else {
 		glBindTexture(GL_TEXTURE_CUBE_MAP_ARRAY, 0);
 	}
@@ -494,6 +613,80 @@ void ShaderProgram::updateUniformGL(GLint id, UniformBufferTypeGL buffer, void*
 	glBindBufferBase(GL_UNIFORM_BUFFER, id, this->UniformBuffers[buffer]);
 	glBufferData(GL_UNIFORM_BUFFER, valuesSize, values, GL_STATIC_DRAW);
 	glUniformBlockBinding(this->program, id, id);
+
+	RenderStats::AddBytesUploaded(valuesSize);
+	RenderStats::AddDescriptorUpdates();
+}
+
+// SAME CONSTANT BUFFERS AND TEXTURE SLOTS AS OPENGL - PACKED ON THE CPU AND RECORDED INSTEAD OF UPLOADED
+int ShaderProgram::UpdateUniformsNull(NullContext* context, Component* mesh, const DrawProperties &properties)
+{
+	if ((context == nullptr) || (mesh == nullptr))
+		return -1;
+
+	ShaderID shaderID = this->ID();
+
+	// MATRIX BUFFER
+	CBMatrix cbMatrices;
+
+	if ((shaderID == SHADER_ID_DEPTH) || (shaderID == SHADER_ID_DEPTH_OMNI))
+		cbMatrices = CBMatrix(properties.Light, mesh, properties.Cascade);
+	else
+		cbMatrices = CBMatrix(mesh, (shaderID == SHADER_ID_SKYBOX));
+
+	context->SetUniforms(UBO_BINDING_MATRIX, shaderID, &cbMatrices, sizeof(cbMatrices));
+
+	// UNIFORM BUFFERS
+	CBColor   cbColor;
+	CBDefault cbDefault;
+	CBDepth   cbDepth;
+	CBHUD     cbHUD;
+
+	switch (shaderID) {
+	case SHADER_ID_COLOR:
+	case SHADER_ID_WIREFRAME:
+		cbColor = CBColor(RenderThread::GetMaterial(dynamic_cast<Mesh*>(mesh)->GetBoundingVolume() != nullptr ? mesh : mesh->Parent)->diffuse);
+		context->SetUniforms(UBO_BINDING_DEFAULT, shaderID, &cbColor, sizeof(cbColor));
+		break;
+	case SHADER_ID_DEFAULT:
+		cbDefault = CBDefault(mesh, properties);
+		context->SetUniforms(UBO_BINDING_DEFAULT, shaderID, &cbDefault, sizeof(cbDefault));
+		break;
+	case SHADER_ID_DEPTH:
+	case SHADER_ID_DEPTH_OMNI:
+		cbDepth = CBDepth(properties.Light->GetLight().position, properties.DepthLayer);
+		context->SetUniforms(UBO_BINDING_DEFAULT, shaderID, &cbDepth, sizeof(cbDepth));
+		break;
+	case SHADER_ID_HUD:
+		cbHUD = CBHUD(RenderThread::GetMaterial(mesh)->diffuse, RenderThread::IsTransparent(mesh));
+		context->SetUniforms(UBO_BINDING_DEFAULT, shaderID, &cbHUD, sizeof(cbHUD));
+		break;
+	default:
+		break;
+	}
+
+	// BIND TEXTURES - Texture slots: [0, 5] mesh, 6 depth map 2D array, 7 depth map cube array
+	switch (shaderID) {
+	case SHADER_ID_DEFAULT:
+		for (uint32_t i = 0; i < MAX_TEXTURES; i++)
+			context->BindTexture(i, LightCluster::GetTexture(shaderID, mesh, i));
+
+		if (SceneManager::DepthMap2D != nullptr)
+			context->BindTexture(6, SceneManager::DepthMap2D->GetTexture());
+
+		if (SceneManager::DepthMapCube != nullptr)
+			context->BindTexture(7, SceneManager::DepthMapCube->GetTexture());
+
+		break;
+	case SHADER_ID_HUD:
+	case SHADER_ID_SKYBOX:
+		context->BindTexture(0, RenderThread::GetTexture(mesh, 0));
+		break;
+	default:
+		break;
+	}
+
+	return 0;
 }
 
 int ShaderProgram::UpdateUniformsVK(VkDevice deviceContext, Component* mesh, const VKUniform &uniform, const DrawProperties &properties)
@@ -504,7 +697,7 @@ int ShaderProgram::UpdateUniformsVK(VkDevice deviceContext, Component* mesh, con
 	CBMatrix cbMatrices;
 
 	if ((shaderID == SHADER_ID_DEPTH) || (shaderID == SHADER_ID_DEPTH_OMNI))
-		cbMatrices = CBMatrix(properties.Light, mesh);
+		cbMatrices = CBMatrix(properties.Light, mesh, properties.Cascade);
 	else
 		cbMatrices = CBMatrix(mesh, (shaderID == SHADER_ID_SKYBOX));
 
@@ -550,7 +743,7 @@ int ShaderProgram::UpdateUniformsVK(VkDevice deviceContext, Component* mesh, con
 
 		break;
 	case SHADER_ID_HUD:
-		cbHUD = CBHUD(mesh->ComponentMaterial.diffuse, dynamic_cast<HUD*>(mesh->Parent)->Transparent);
+		cbHUD = CBHUD(mesh->ComponentMaterial.diffuse, RenderThread::IsTransparent(mesh));
 
 		result = ShaderProgram::updateUniformsVK(
 			UBO_VK_HUD, UBO_BINDING_DEFAULT, uniform, &cbHUD, sizeof(cbHUD), deviceContext, mesh
@@ -610,6 +803,9 @@ int ShaderProgram::updateUniformsVK(UniformBufferTypeVK type, UniformBinding bin
 
 	vkUpdateDescriptorSets(deviceContext, 1, &uniformWriteSet, 0, nullptr);
 
+	RenderStats::AddBytesUploaded(valuesSize);
+	RenderStats::AddDescriptorUpdates();
+
 	return 0;
 }
 
@@ -634,9 +830,11 @@ int ShaderProgram::updateUniformSamplersVK(VkDescriptorSet uniformSet, VkDevice
 	case SHADER_ID_SKYBOX:
 		for (int i = 0; i < MAX_TEXTURES; i++)
 		{
+			Texture* texture = LightCluster::GetTexture(shaderID, mesh, i);
+
 			uniformTextureInfo[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-			uniformTextureInfo[i].imageView   = mesh->Textures[i]->ImageView;
-			uniformTextureInfo[i].sampler     = mesh->Textures[i]->Sampler;
+			uniformTextureInfo[i].imageView   = texture->ImageView;
+			uniformTextureInfo[i].sampler     = texture->Sampler;
 		}
 
 		// BIND 2D TEXTURE
@@ -647,6 +845,9 @@ int ShaderProgram::updateUniformSamplersVK(VkDescriptorSet uniformSet, VkDevice
 
 		vkUpdateDescriptorSets(deviceContext, 1, &uniformWriteSet, 0, nullptr);
 
+		RenderStats::AddDescriptorUpdates();
+		RenderStats::AddTextureBinds(MAX_TEXTURES);
+
 		break;
 	default:
 		break;
@@ -669,6 +870,9 @@ int ShaderProgram::updateUniformSamplersVK(VkDescriptorSet uniformSet, VkDevice
 
 		vkUpdateDescriptorSets(deviceContext, 1, &uniformWriteSet, 0, nullptr);
 
+		RenderStats::AddDescriptorUpdates();
+		RenderStats::AddTextureBinds();
+
 		// BIND DEPTH MAP - CUBE MAP ARRAY
 		uniformDepthInfo.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 		uniformDepthInfo.imageView   = SceneManager::DepthMapCube->GetTexture()->ImageView;
@@ -680,6 +884,9 @@ int ShaderProgram::updateUniformSamplersVK(VkDescriptorSet uniformSet, VkDevice
 		uniformWriteSet.pImageInfo      = &uniformDepthInfo;
 
 		vkUpdateDescriptorSets(deviceContext, 1, &uniformWriteSet, 0, nullptr);
+
+		RenderStats::AddDescriptorUpdates();
+		RenderStats::AddTextureBinds();
 	}
 
 	return 0;
@@ -700,7 +907,7 @@ int ShaderProgram::UpdateUniformsDX11(ID3D11Buffer** constBuffer, const void** c
 	CBMatrix matrices;
 
 	if ((this->ID() == SHADER_ID_DEPTH) || (this->ID() == SHADER_ID_DEPTH_OMNI))
-		matrices = CBMatrix(properties.Light, mesh);
+		matrices = CBMatrix(properties.Light, mesh, properties.Cascade);
 	else
 		matrices = CBMatrix(mesh, (this->ID() == SHADER_ID_SKYBOX));
 
@@ -713,6 +920,9 @@ int ShaderProgram::UpdateUniformsDX11(ID3D11Buffer** constBuffer, const void** c
 	if ((*constBuffer == nullptr) || (*constBufferValues == nullptr))
 		return -3;
 
+	RenderStats::AddBytesUploaded(bufferSize);
+	RenderStats::AddDescriptorUpdates();
+
 	return 0;
 }
 
@@ -730,7 +940,7 @@ int ShaderProgram::UpdateUniformsDX12(Component* mesh, const DrawProperties &pro
 	CBMatrix matrices;
 
 	if ((this->ID() == SHADER_ID_DEPTH) || (this->ID() == SHADER_ID_DEPTH_OMNI))
-		matrices = CBMatrix(properties.Light, mesh);
+		matrices = CBMatrix(properties.Light, mesh, properties.Cascade);
 	else
 		matrices = CBMatrix(mesh, (this->ID() == SHADER_ID_SKYBOX));
 
@@ -752,6 +962,9 @@ int ShaderProgram::UpdateUniformsDX12(Component* mesh, const DrawProperties &pro
 	std::memcpy(bufferData, constBufferValues, constBufferSize);
 	constBuffer->Unmap(0, nullptr);
 
+	RenderStats::AddBytesUploaded(constBufferSize);
+	RenderStats::AddDescriptorUpdates();
+
 	return 0;
 }
 
@@ -766,6 +979,51 @@ ID3DBlob* ShaderProgram::VS()
 }
 #endif
 
+// COMPILES A SPECIALIZED DEFAULT SHADER THE FIRST TIME A FEATURE COMBINATION IS USED,
+// FALLS BACK TO THE GENERIC PROGRAM IF THE VARIANT FAILS OR THE API HAS NO VARIANTS (DX11/DX12/NULL)
+ShaderProgram* ShaderProgram::Variant(uint32_t features)
+{
+	if ((this->base != nullptr) || (features == this->features) || (this->ID() != SHADER_ID_DEFAULT))
+		return this;
+
+	if ((RenderEngine::SelectedGraphicsAPI != GRAPHICS_API_OPENGL) && (RenderEngine::SelectedGraphicsAPI != GRAPHICS_API_VULKAN))
+		return this;
+
+	auto cached = this->variants.find(features);
+
+	if (cached != this->variants.end())
+		return (cached->second != nullptr ? cached->second : this);
+
+	ShaderProgram* variant = new ShaderProgram(this->name);
+	int            result  = 0;
+
+	variant->base     = this;
+	variant->features = features;
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	case GRAPHICS_API_OPENGL:
+		result = variant->LoadAndLink(this->sourceVS, ShaderProgram::injectFeaturesGL(this->sourceFS, features), this->sourceGS);
+		break;
+	// THE PIPELINES SPECIALIZE THE SHARED MODULES (VKContext::createPipeline)
+	case GRAPHICS_API_VULKAN:
+		variant->vulkanFS = this->vulkanFS;
+		variant->vulkanGS = this->vulkanGS;
+		variant->vulkanVS = this->vulkanVS;
+		break;
+	default:
+		throw;
+	}
+
+	if ((result < 0) || !variant->IsOK()) {
+		variant->Log();
+		_DELETEP(variant);
+	}
+
+	this->variants[features] = variant;
+
+	return (variant != nullptr ? variant : this);
+}
+
 VkShaderModule ShaderProgram::VulkanFS()
 {
 	return this->vulkanFS;
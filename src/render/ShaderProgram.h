@@ -17,11 +17,17 @@ public:
 	GLuint UniformBuffers[NR_OF_UBOS_GL];
 
 private:
-	wxString       name;
-	GLuint         program;
-	VkShaderModule vulkanFS;
-	VkShaderModule vulkanGS;
-	VkShaderModule vulkanVS;
+	ShaderProgram*                               base;
+	uint32_t                                     features;
+	wxString                                     name;
+	GLuint                                       program;
+	wxString                                     sourceFS;
+	wxString                                     sourceGS;
+	wxString                                     sourceVS;
+	std::unordered_map<uint32_t, ShaderProgram*> variants;
+	VkShaderModule                               vulkanFS;
+	VkShaderModule                               vulkanGS;
+	VkShaderModule                               vulkanVS;
 
 	#if defined _WINDOWS
 		ID3D11PixelShader*    shaderFS;
@@ -33,6 +39,11 @@ private:
 	#endif
 
 public:
+	static uint32_t GetFeatures(Component* mesh, const DrawProperties &properties, uint32_t lightFeatures);
+	static uint32_t GetLightFeatures();
+
+public:
+	uint32_t       Features();
 	bool           IsOK();
 	int            Link();
 	int            Load(const wxString &shaderFile);
@@ -43,7 +54,9 @@ public:
 	GLuint         Program();
 	int            UpdateAttribsGL(Component* mesh);
 	int            UpdateUniformsGL(Component* mesh, const DrawProperties &properties = {});
+	int            UpdateUniformsNull(NullContext* context, Component* mesh, const DrawProperties &properties = {});
 	int            UpdateUniformsVK(VkDevice deviceContext, Component* mesh, const VKUniform &uniform, const DrawProperties &properties = {});
+	ShaderProgram* Variant(uint32_t features);
 	VkShaderModule VulkanFS();
 	VkShaderModule VulkanGS();
 	VkShaderModule VulkanVS();
@@ -60,6 +73,9 @@ public:
 		int                   UpdateUniformsDX12(Component* mesh, const DrawProperties &properties = {});
 	#endif
 
+private:
+	static wxString injectFeaturesGL(const wxString &sourceText, uint32_t features);
+
 private:
 	int  loadShaderGL(GLuint type, const wxString &sourceText);
 	void setAttribsGL();
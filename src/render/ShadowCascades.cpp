@@ -0,0 +1,190 @@
+#include "ShadowCascades.h"
+
+float         ShadowCascades::CasterDistance = 50.0f;
+int           ShadowCascades::Count          = 4;
+float         ShadowCascades::Distance       = 100.0f;
+float         ShadowCascades::Lambda         = 0.75f;
+ShadowCascade ShadowCascades::cascades[MAX_SHADOW_CASCADES];
+int           ShadowCascades::count          = 0;
+glm::vec4     ShadowCascades::depthPlane     = {};
+int           ShadowCascades::light          = -1;
+glm::mat4     ShadowCascades::lightView      = {};
+
+glm::vec4 ShadowCascades::BiasScales()
+{
+	glm::vec4 scales = glm::vec4(1.0f);
+
+	for (int i = 0; i < ShadowCascades::count; i++)
+		scales[i] = ShadowCascades::cascades[i].BiasScale;
+
+	return scales;
+}
+
+int ShadowCascades::Cascades()
+{
+	return (ShadowCascades::light >= 0 ? ShadowCascades::count : 0);
+}
+
+void ShadowCascades::Close()
+{
+	ShadowCascades::count = 0;
+	ShadowCascades::light = -1;
+}
+
+// VIEW DEPTH = dot(xyz, position) + w
+glm::vec4 ShadowCascades::DepthPlane()
+{
+	return ShadowCascades::depthPlane;
+}
+
+// PRACTICAL SPLIT SCHEME - BLENDS THE LOGARITHMIC AND THE UNIFORM SPLITS
+float ShadowCascades::getSplit(int split, float near, float far)
+{
+	float fraction    = ((float)split / (float)ShadowCascades::count);
+	float logarithmic = (near * std::pow((far / near), fraction));
+	float uniform     = (near + ((far - near) * fraction));
+	float lambda      = glm::clamp(ShadowCascades::Lambda, 0.0f, 1.0f);
+
+	return ((lambda * logarithmic) + ((1.0f - lambda) * uniform));
+}
+
+// THE BOUNDING SPHERE OF THE MESH (AROUND ITS VERTEX BOUNDS CENTER) AGAINST THE CASCADE BOX, WHICH EXTENDS TOWARDS THE LIGHT TO KEEP THE CASTERS OUTSIDE THE SLICE
+bool ShadowCascades::IsCaster(Component* mesh, int cascade)
+{
+	Mesh* bounds = dynamic_cast<Mesh*>(mesh);
+
+	if ((cascade < 0) || (cascade >= ShadowCascades::count) || (bounds == nullptr))
+		return true;
+
+	const ShadowCascade &box    = ShadowCascades::cascades[cascade];
+	glm::vec3            center = glm::vec3(ShadowCascades::lightView * RenderThread::GetMatrix(mesh) * glm::vec4(bounds->Center(), 1.0f));
+	float                radius = bounds->Radius();
+	float                depth  = -center.z;
+
+	bool caster = (
+		((center.x + radius) >= box.Bounds.x) && ((center.x - radius) <= box.Bounds.y) &&
+		((center.y + radius) >= box.Bounds.z) && ((center.y - radius) <= box.Bounds.w) &&
+		((depth + radius) >= box.DepthMin) && ((depth - radius) <= box.DepthMax)
+	);
+
+	if (caster)
+		RenderStats::AddShadowCaster();
+	else
+		RenderStats::AddShadowCulled();
+
+	return caster;
+}
+
+// CASCADE 0 USES THE LAYER OF THE LIGHT SLOT
+int ShadowCascades::Layer(int cascade)
+{
+	return (cascade > 0 ? (MAX_LIGHT_SOURCES + cascade - 1) : ShadowCascades::light);
+}
+
+int ShadowCascades::Light()
+{
+	return ShadowCascades::light;
+}
+
+glm::vec4 ShadowCascades::Splits()
+{
+	glm::vec4 splits = {};
+
+	for (int i = 0; i < ShadowCascades::count; i++)
+		splits[i] = ShadowCascades::cascades[i].Split;
+
+	return splits;
+}
+
+// CALLED ON THE RENDER THREAD BEFORE THE SHADOW PASS, SO THE DEPTH PASS AND THE DEFAULT SHADER USE THE SAME CASCADES
+void ShadowCascades::Update()
+{
+	PROFILE_SCOPE("ShadowCascades::Update");
+
+	ShadowCascades::count = 0;
+	ShadowCascades::light = -1;
+
+	Camera* camera = RenderThread::GetCamera();
+	CBLight source;
+
+	for (int i = 0; (camera != nullptr) && (i < MAX_LIGHT_SOURCES); i++)
+	{
+		if (RenderThread::GetLight(i, source) && ((int)source.Active.y == ID_ICON_LIGHT_DIRECTIONAL)) {
+			ShadowCascades::light = i;
+			break;
+		}
+	}
+
+	if (ShadowCascades::light < 0)
+		return;
+
+	float near = camera->Near();
+	float far  = std::min(camera->Far(), ShadowCascades::Distance);
+
+	if ((near <= 0.0f) || (far <= near)) {
+		ShadowCascades::light = -1;
+		return;
+	}
+
+	ShadowCascades::count = glm::clamp(ShadowCascades::Count, 1, (int)MAX_SHADOW_CASCADES);
+
+	// A FIXED UP VECTOR, SO THE CASCADES DON'T ROTATE WITH THE CAMERA
+	glm::vec3 direction = glm::normalize(glm::vec3(source.Direction));
+	glm::vec3 up        = (std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f));
+
+	ShadowCascades::lightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+
+	glm::mat4 view        = camera->View();
+	glm::mat4 inverseView = glm::inverse(view);
+	glm::mat4 projection  = camera->Projection();
+
+	ShadowCascades::depthPlane = -glm::vec4(view[0][2], view[1][2], view[2][2], view[3][2]);
+
+	// SQUARED DISTANCE FROM THE VIEW AXIS TO THE FRUSTUM CORNERS AT A VIEW DEPTH OF 1
+	float tanX    = (1.0f / std::abs(projection[0][0]));
+	float tanY    = (1.0f / std::abs(projection[1][1]));
+	float corners = ((tanX * tanX) + (tanY * tanY));
+	float nearest = near;
+
+	for (int i = 0; i < ShadowCascades::count; i++)
+	{
+		ShadowCascade &cascade  = ShadowCascades::cascades[i];
+		float          farthest = ShadowCascades::getSplit((i + 1), near, far);
+
+		// BOUNDING SPHERE OF THE SLICE - THE RADIUS ONLY DEPENDS ON THE SPLITS AND THE FIELD OF VIEW, SO IT DOESN'T
+		// CHANGE WHEN THE CAMERA TURNS, AND THE SNAPPED PROJECTION ONLY EVER MOVES IN WHOLE TEXELS
+		float centerDepth = std::min((((nearest + farthest) * (1.0f + corners)) * 0.5f), farthest);
+		float nearRadius  = std::sqrt(((centerDepth - nearest) * (centerDepth - nearest)) + (nearest * nearest * corners));
+		float farRadius   = std::sqrt(((farthest - centerDepth) * (farthest - centerDepth)) + (farthest * farthest * corners));
+		float radius      = (std::ceil(std::max(nearRadius, farRadius) * 16.0f) / 16.0f);
+
+		glm::vec4 centerWorld = (inverseView * glm::vec4(0.0f, 0.0f, -centerDepth, 1.0f));
+		glm::vec3 center      = glm::vec3(ShadowCascades::lightView * centerWorld);
+		float     texelSize   = ((2.0f * radius) / (float)FBO_TEXTURE_SIZE);
+
+		center.x = (std::floor(center.x / texelSize) * texelSize);
+		center.y = (std::floor(center.y / texelSize) * texelSize);
+
+		cascade.Bounds   = glm::vec4((center.x - radius), (center.x + radius), (center.y - radius), (center.y + radius));
+		cascade.DepthMin = (-center.z - radius - ShadowCascades::CasterDistance);
+		cascade.DepthMax = (-center.z + radius);
+		cascade.Split    = farthest;
+
+		cascade.ViewProjection = (glm::ortho(
+			cascade.Bounds.x, cascade.Bounds.y, cascade.Bounds.z, cascade.Bounds.w, cascade.DepthMin, cascade.DepthMax
+		) * ShadowCascades::lightView);
+
+		// THE SHADER BIAS WAS TUNED FOR THE FIXED 60x60x29 PROJECTION OF THE LIGHT (LightSource) - KEEP IT THE SAME IN TEXELS
+		cascade.BiasScale = (((2.0f * radius) / 60.0f) * (29.0f / (cascade.DepthMax - cascade.DepthMin)));
+
+		nearest = farthest;
+	}
+}
+
+glm::mat4 ShadowCascades::ViewProjection(int cascade)
+{
+	if ((cascade < 0) || (cascade >= ShadowCascades::count))
+		return glm::mat4(1.0f);
+
+	return ShadowCascades::cascades[cascade].ViewProjection;
+}
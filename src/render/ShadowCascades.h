@@ -0,0 +1,58 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_SHADOWCASCADES_H
+#define S3DE_SHADOWCASCADES_H
+
+struct ShadowCascade
+{
+	float     BiasScale      = 1.0f;
+	glm::vec4 Bounds         = {};	// LIGHT SPACE { Left, Right, Bottom, Top }
+	float     DepthMax       = 0.0f;	// LIGHT SPACE DISTANCE ALONG THE LIGHT DIRECTION
+	float     DepthMin       = 0.0f;
+	float     Split          = 0.0f;	// FAR VIEW DEPTH
+	glm::mat4 ViewProjection = {};
+};
+
+// THE SHADOW MAP OF THE FIRST DIRECTIONAL LIGHT IS SPLIT INTO CASCADES FITTED TO SLICES OF THE CAMERA FRUSTUM.
+// EACH CASCADE IS AN ORTHOGRAPHIC PROJECTION AROUND THE BOUNDING SPHERE OF ITS SLICE, SNAPPED TO WHOLE SHADOW MAP
+// TEXELS SO THE SHADOWS DON'T SHIMMER WHEN THE CAMERA MOVES OR TURNS. CASCADE 0 USES THE DEPTH MAP LAYER OF THE
+// LIGHT SLOT, THE OTHER CASCADES USE THE LAYERS AFTER THE LIGHT SLOTS.
+class ShadowCascades
+{
+private:
+	ShadowCascades()  {}
+	~ShadowCascades() {}
+
+public:
+	static float CasterDistance;
+	static int   Count;
+	static float Distance;
+	static float Lambda;
+
+private:
+	static ShadowCascade cascades[MAX_SHADOW_CASCADES];
+	static int           count;
+	static glm::vec4     depthPlane;
+	static int           light;
+	static glm::mat4     lightView;
+
+public:
+	static glm::vec4 BiasScales();
+	static int       Cascades();
+	static void      Close();
+	static glm::vec4 DepthPlane();
+	static bool      IsCaster(Component* mesh, int cascade);
+	static int       Layer(int cascade);
+	static int       Light();
+	static glm::vec4 Splits();
+	static void      Update();
+	static glm::mat4 ViewProjection(int cascade);
+
+private:
+	static float getSplit(int split, float near, float far);
+
+};
+
+#endif
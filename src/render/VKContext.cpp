@@ -13,30 +13,6 @@ VKContext::~VKContext()
 	this->release();
 }
 
-void VKContext::blitImage(VkCommandBuffer cmdBuffer, VkImage image, int mipWidth, int mipHeight, int index)
-{
-	VkImageBlit imageBlit = {};
-
-	imageBlit.srcOffsets[1] = { mipWidth, mipHeight, 1 };
-
-	imageBlit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-	imageBlit.srcSubresource.mipLevel   = (index - 1);
-	imageBlit.srcSubresource.layerCount = 1;
-
-	imageBlit.dstOffsets[1] = { (mipWidth > 1 ? (mipWidth / 2) : 1), (mipHeight > 1 ? (mipHeight / 2) : 1), 1 };
-
-	imageBlit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-	imageBlit.dstSubresource.mipLevel   = index;
-	imageBlit.dstSubresource.layerCount = 1;
-
-	vkCmdBlitImage(
-		cmdBuffer,
-		image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-		image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-		1, &imageBlit, VK_FILTER_LINEAR
-	);
-}
-
 void VKContext::Clear(const glm::vec4 &colorRGBA, const DrawProperties &properties)
 {
 	VkCommandBuffer commandBuffer = properties.VKCommandBuffer;
@@ -107,6 +83,10 @@ void VKContext::Clear(const glm::vec4 &colorRGBA, const DrawProperties &properti
 
 		vkBeginCommandBuffer(commandBuffer, &beginCommandInfo);
 
+		this->boundPipeline = nullptr;
+
+		GPUTimer::ResetQueries(commandBuffer);
+
 		VkClearValue clearValues[2] = {};
 
 		clearValues[0].color        = { colorRGBA.r, colorRGBA.g, colorRGBA.b, colorRGBA.a };
@@ -138,6 +118,11 @@ void VKContext::Clear(const glm::vec4 &colorRGBA, const DrawProperties &properti
 	vkCmdSetScissor(commandBuffer,  0, 1, &scissorRect);
 }
 
+VkCommandBuffer VKContext::CommandBuffer()
+{
+	return (!this->commandBuffers.empty() ? this->commandBuffers[this->imageIndex] : nullptr);
+}
+
 VkCommandBuffer VKContext::CommandBufferBegin()
 {
 	VkCommandBufferBeginInfo     commandInfo    = {};
@@ -151,6 +136,8 @@ VkCommandBuffer VKContext::CommandBufferBegin()
 
     vkBeginCommandBuffer(commandBuffers[0], &commandInfo);
 
+	this->boundPipeline = nullptr;
+
     return commandBuffers[0];
 }
 
@@ -185,28 +172,6 @@ int VKContext::copyBuffer(VkBuffer sourceBuffer, VkBuffer destinationBuffer, VkD
 	return 0;
 }
 
-int VKContext::copyBufferToImage(VkBuffer buffer, VkImage image, int colorComponents, uint32_t width, uint32_t height, uint32_t index)
-{
-	VkCommandBuffer cmdBuffer = this->CommandBufferBegin();
-
-	if (cmdBuffer == nullptr)
-		return -1;
-
-	VkBufferImageCopy copyRegion = {};
-
-	copyRegion.bufferOffset                    = (index * width * height * colorComponents);
-	copyRegion.imageExtent                     = { width, height, 1 };
-	copyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-	copyRegion.imageSubresource.baseArrayLayer = index;
-	copyRegion.imageSubresource.layerCount     = 1;
-
-	vkCmdCopyBufferToImage(cmdBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
-
-	this->CommandBufferEnd(cmdBuffer);
-
-	return 0;
-}
-
 int VKContext::copyImage(VkImage image, VkFormat imageFormat, uint32_t mipLevels, TextureType textureType, VkImageLayout oldLayout, VkImageLayout newLayout)
 {
 	VkCommandBuffer cmdBuffer = this->CommandBufferBegin();
@@ -229,7 +194,7 @@ int VKContext::copyImage(VkImage image, VkFormat imageFormat, uint32_t mipLevels
 	switch (textureType) {
 		case TEXTURE_2D:            imageMemBarrier.subresourceRange.layerCount = 1; break;
 		case TEXTURE_CUBEMAP:       imageMemBarrier.subresourceRange.layerCount = MAX_TEXTURES; break;
-		case TEXTURE_2D_ARRAY:      imageMemBarrier.subresourceRange.layerCount = MAX_LIGHT_SOURCES; break;
+		case TEXTURE_2D_ARRAY:      imageMemBarrier.subresourceRange.layerCount = MAX_DEPTH_LAYERS; break;
 		case TEXTURE_CUBEMAP_ARRAY: imageMemBarrier.subresourceRange.layerCount = (MAX_LIGHT_SOURCES * MAX_TEXTURES); break;
 		default: throw;
 	}
@@ -249,6 +214,15 @@ int VKContext::copyImage(VkImage image, VkFormat imageFormat, uint32_t mipLevels
 		pipelineStageSrcFlags  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
 		pipelineStageDestFlags = VK_PIPELINE_STAGE_TRANSFER_BIT;
 	}
+	// BACK TO DESTINATION (UPDATE)
+	else if ((oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) && (newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL))
+	{
+		imageMemBarrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+		imageMemBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		pipelineStageSrcFlags  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		pipelineStageDestFlags = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	}
 	// TO SHADER
 	else if ((oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) && (newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL))
 	{
@@ -365,7 +339,7 @@ int VKContext::createImage(
 		imageInfo.flags       = VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
 		break;
 	case TEXTURE_2D_ARRAY:
-		imageInfo.arrayLayers = MAX_LIGHT_SOURCES;
+		imageInfo.arrayLayers = MAX_DEPTH_LAYERS;
 		break;
 	case TEXTURE_CUBEMAP_ARRAY:
 		imageInfo.arrayLayers = (MAX_LIGHT_SOURCES * MAX_TEXTURES);
@@ -474,75 +448,19 @@ int VKContext::CreateIndexBuffer(const std::vector<uint32_t> &indices, Buffer* b
 	return 0;
 }
 
-int VKContext::createMipMaps(VkImage image, VkFormat imageFormat, int width, int height, uint32_t mipLevels)
+VkQueryPool VKContext::CreateQueryPool(uint32_t count)
 {
-	VkFormatProperties formatProperties = {};
-
-	vkGetPhysicalDeviceFormatProperties(this->device, imageFormat, &formatProperties);
-
-	if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT))
-		return -1;
-
-	VkCommandBuffer      cmdBuffer       = this->CommandBufferBegin();
-	VkImageMemoryBarrier imageMemBarrier = {};
-	int                  mipWidth        = width;
-	int                  mipHeight       = height;
-
-	// BASE MIP LEVEL
-	imageMemBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-	imageMemBarrier.image = image;
-
-	imageMemBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-	imageMemBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	VkQueryPool           queryPool     = nullptr;
+	VkQueryPoolCreateInfo queryPoolInfo = {};
 
-	imageMemBarrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-	imageMemBarrier.subresourceRange.layerCount = 1;
-	imageMemBarrier.subresourceRange.levelCount = 1;
+	queryPoolInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	queryPoolInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+	queryPoolInfo.queryCount = count;
 
-	// MIP LEVELS
-	for (uint32_t i = 1; i < mipLevels; i++)
-	{
-		// TRANSITION TO SOURCE LAYOUT
-		imageMemBarrier.subresourceRange.baseMipLevel = (i - 1);
-
-		imageMemBarrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-		imageMemBarrier.newLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-		imageMemBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-		imageMemBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-
-		this->transitionImageLayout(cmdBuffer, imageMemBarrier, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-		// BLIT IMAGE
-		this->blitImage(cmdBuffer, image, mipWidth, mipHeight, i);
-
-		// TRANSITION TO FRAGMENT SHADER LAYOUT
-		imageMemBarrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-		imageMemBarrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-		imageMemBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-		imageMemBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-		this->transitionImageLayout(cmdBuffer, imageMemBarrier, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-
-		if (mipWidth > 1)
-			mipWidth /= 2;
-
-		if (mipHeight > 1)
-			mipHeight /= 2;
-	}
-
-	// TRANSITION LAST MIP LEVEL TO FRAGMENT SHADER LAYOUT
-	imageMemBarrier.subresourceRange.baseMipLevel = (mipLevels - 1);
-
-	imageMemBarrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-	imageMemBarrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-	imageMemBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-	imageMemBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-	this->transitionImageLayout(cmdBuffer, imageMemBarrier, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
-
-	this->CommandBufferEnd(cmdBuffer);
+	if (vkCreateQueryPool(this->deviceContext, &queryPoolInfo, nullptr, &queryPool) != VK_SUCCESS)
+		return nullptr;
 
-	return 0;
+	return queryPool;
 }
 
 int VKContext::createPipeline(
@@ -571,6 +489,31 @@ int VKContext::createPipeline(
 	fsStageInfo.module = shaderProgram->VulkanFS();
 	fsStageInfo.pName  = "main";
 
+	// SHADER PERMUTATION - default.fs.glsl (constant_id = 0) FEATURES, (constant_id = 1) LIGHT_COUNT
+	int32_t                  specData[2]    = {};
+	VkSpecializationMapEntry specEntries[2] = {};
+	VkSpecializationInfo     specInfo       = {};
+	uint32_t                 features       = shaderProgram->Features();
+
+	if (features != SHADER_FEATURES_ALL)
+	{
+		specData[0] = (int32_t)(features & SHADER_FEATURE_FLAGS);
+		specData[1] = (int32_t)(features >> SHADER_FEATURE_LIGHTS_SHIFT);
+
+		for (uint32_t i = 0; i < 2; i++) {
+			specEntries[i].constantID = i;
+			specEntries[i].offset     = (i * sizeof(int32_t));
+			specEntries[i].size       = sizeof(int32_t);
+		}
+
+		specInfo.mapEntryCount = 2;
+		specInfo.pMapEntries   = specEntries;
+		specInfo.dataSize      = sizeof(specData);
+		specInfo.pData         = specData;
+
+		fsStageInfo.pSpecializationInfo = &specInfo;
+	}
+
 	VkPipelineDynamicStateCreateInfo       dynamicState    = {};
 	VkDynamicState                         dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
 	VkPipelineInputAssemblyStateCreateInfo inputAssembly   = {};
@@ -704,24 +647,23 @@ int VKContext::createPipelineLayout(Buffer* buffer)
 	return 0;
 }
 
+// THE .spv FILES ARE COMPILED OFFLINE BY THE PRE-BUILD STEP (glslangValidator -V)
 int VKContext::CreateShaderModule(const wxString &shaderFile, const wxString &stage, VkShaderModule* shaderModule)
 {
 	#if defined _DEBUG
-		wxArrayString output;
-		wxString      glsValidator = wxString(std::getenv("VK_SDK_PATH")).append("/Bin/glslangValidator -V ");
-		wxString      command      = wxString(glsValidator + shaderFile + " -S " + stage + " -o " + shaderFile + ".spv");
-		long          result       = wxExecute(command, output, wxEXEC_SYNC);
-
-		for (auto line : output)
-			wxLogDebug("%s\n", line.c_str().AsChar());
+		wxFileName source(shaderFile);
+		wxFileName spirv(shaderFile + ".spv");
 
-		if (result < 0)
-			return -1;
+		if (!spirv.FileExists() || (source.GetModificationTime() > spirv.GetModificationTime()))
+			wxLogDebug("WARNING: %s.spv (%s) is missing or older than the source, rebuild to recompile the shaders.\n", shaderFile.c_str().AsChar(), stage.c_str().AsChar());
 	#endif
 
 	std::vector<uint8_t>     byteCode         = Utils::LoadDataFile(wxString(shaderFile + ".spv"));
 	VkShaderModuleCreateInfo shaderModuleInfo = {};
 
+	if (byteCode.empty())
+		return -1;
+
 	shaderModuleInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
 	shaderModuleInfo.codeSize = byteCode.size();
 	shaderModuleInfo.pCode    = reinterpret_cast<const uint32_t*>(byteCode.data());
@@ -732,46 +674,65 @@ int VKContext::CreateShaderModule(const wxString &shaderFile, const wxString &st
 	return 0;
 }
 
-int VKContext::CreateTexture(const std::vector<uint8_t*> &imagePixels, Texture* texture, VkFormat imageFormat)
+// UPLOADS ALL LEVELS OF THE CPU MIP CHAIN (RGBA8 OR BLOCK COMPRESSED) IN ONE TRANSFER
+int VKContext::CreateTexture(const CompressedImage &image, Texture* texture, VkFormat imageFormat)
 {
-	if ((texture == nullptr) || imagePixels.empty())
+	if ((texture == nullptr) || image.Levels.empty())
 		return -1;
 
 	VkBufferUsageFlags    bufferUseFlags      = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 	VkMemoryPropertyFlags bufferMemFlags      = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-	wxSize                textureSize         = texture->Size();
-	int                   colorComponents     = ((imageFormat == VK_FORMAT_R8G8B8A8_UNORM || imageFormat == VK_FORMAT_R8G8B8A8_SRGB) ? 4 : 3);
-	VkDeviceSize          imageSize           = (textureSize.GetWidth() * textureSize.GetHeight() * colorComponents);
+	VkDeviceSize          imageSize           = (VkDeviceSize)image.Size();
 	VkBuffer              stagingBuffer       = nullptr;
 	VkDeviceMemory        stagingBufferMemory = nullptr;
 
 	// STAGING BUFFER
-	int result = this->createBuffer(
-		(imagePixels.size() * imageSize), bufferUseFlags, bufferMemFlags,
-		&stagingBuffer, &stagingBufferMemory
-	);
+	int result = this->createBuffer(imageSize, bufferUseFlags, bufferMemFlags, &stagingBuffer, &stagingBufferMemory);
 
 	if (result < 0)
 		return -2;
 
-	// COPY IMAGE DATA TO STAGE BUFFER
-	void* imageMemData = nullptr;
+	// COPY ALL LEVELS TO THE STAGING BUFFER, ONE COPY REGION PER LEVEL AND LAYER
+	std::vector<VkBufferImageCopy> copyRegions;
+	void*                          imageMemData = nullptr;
+	VkDeviceSize                   offset       = 0;
+
+	vkMapMemory(this->deviceContext, stagingBufferMemory, 0, imageSize, 0, &imageMemData);
 
-	for (size_t i = 0; i < imagePixels.size(); i++)
+	for (uint32_t level = 0; level < (uint32_t)image.Levels.size(); level++)
 	{
-		vkMapMemory(this->deviceContext, stagingBufferMemory, (i * imageSize), imageSize, 0, &imageMemData);
-		memcpy(imageMemData, imagePixels[i], (size_t)imageSize);
-		vkUnmapMemory(this->deviceContext, stagingBufferMemory);
+		const CompressedLevel &mipLevel  = image.Levels[level];
+		VkDeviceSize           layerSize = (mipLevel.Data.size() / image.Layers);
+
+		memcpy((static_cast<uint8_t*>(imageMemData) + offset), mipLevel.Data.data(), mipLevel.Data.size());
+
+		for (uint32_t layer = 0; layer < (uint32_t)image.Layers; layer++)
+		{
+			VkBufferImageCopy copyRegion = {};
+
+			copyRegion.bufferOffset                    = (offset + (layer * layerSize));
+			copyRegion.imageExtent                     = { (uint32_t)mipLevel.Width, (uint32_t)mipLevel.Height, 1 };
+			copyRegion.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+			copyRegion.imageSubresource.baseArrayLayer = layer;
+			copyRegion.imageSubresource.layerCount     = 1;
+			copyRegion.imageSubresource.mipLevel       = level;
+
+			copyRegions.push_back(copyRegion);
+		}
+
+		offset += mipLevel.Data.size();
 	}
 
+	vkUnmapMemory(this->deviceContext, stagingBufferMemory);
+
 	// CREATE IMAGE
-	VkMemoryPropertyFlags imageUseFlags = (VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+	VkMemoryPropertyFlags imageUseFlags = (VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
 	VkMemoryPropertyFlags imageMemFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
-	TextureType           textureType   = (imagePixels.size() > 1 ? TEXTURE_CUBEMAP : TEXTURE_2D);
-	uint32_t              mipLevels     = (textureType == TEXTURE_CUBEMAP ? 1 : texture->MipLevels());
+	TextureType           textureType   = (image.Layers > 1 ? TEXTURE_CUBEMAP : TEXTURE_2D);
+	uint32_t              mipLevels     = (uint32_t)image.Levels.size();
 
 	result = this->createImage(
-		(uint32_t)textureSize.GetWidth(), (uint32_t)textureSize.GetHeight(),
+		(uint32_t)image.Width, (uint32_t)image.Height,
 		mipLevels, VK_SAMPLE_COUNT_1_BIT, imageFormat, VK_IMAGE_TILING_OPTIMAL,
 		imageUseFlags, imageMemFlags, textureType, &texture->Image, &texture->ImageMemory
 	);
@@ -779,25 +740,23 @@ int VKContext::CreateTexture(const std::vector<uint8_t*> &imagePixels, Texture*
 	if (result < 0)
 		return result;
 
-	for (size_t i = 0; i < imagePixels.size(); i++)
-	{
-		// TRANSITION IMAGE LAYOUT TO DESTINATION
-		if (this->copyImage(texture->Image, imageFormat, mipLevels, textureType, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) < 0)
-			return -4;
+	// TRANSITION IMAGE LAYOUT TO DESTINATION
+	if (this->copyImage(texture->Image, imageFormat, mipLevels, textureType, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) < 0)
+		return -4;
 
-		// COPY DATA FROM STAGING BUFFER TO IMAGE (DEVICE LOCAL)
-		if (this->copyBufferToImage(stagingBuffer, texture->Image, colorComponents, (uint32_t)textureSize.GetWidth(), (uint32_t)textureSize.GetHeight(), i) < 0)
-			return -5;
+	// COPY DATA FROM STAGING BUFFER TO IMAGE (DEVICE LOCAL)
+	VkCommandBuffer cmdBuffer = this->CommandBufferBegin();
 
-		// TRANSITION IMAGE LAYOUT TO SHADER
-		if (textureType == TEXTURE_CUBEMAP)
-			result = this->copyImage(texture->Image, imageFormat, mipLevels, textureType, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-		else
-			result = this->createMipMaps(texture->Image, imageFormat, textureSize.GetWidth(), textureSize.GetHeight(), mipLevels);
+	if (cmdBuffer == nullptr)
+		return -5;
 
-		if (result < 0)
-			return -6;
-	}
+	vkCmdCopyBufferToImage(cmdBuffer, stagingBuffer, texture->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)copyRegions.size(), copyRegions.data());
+
+	this->CommandBufferEnd(cmdBuffer);
+
+	// TRANSITION IMAGE LAYOUT TO SHADER
+	if (this->copyImage(texture->Image, imageFormat, mipLevels, textureType, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) < 0)
+		return -6;
 
 	vkFreeMemory(this->deviceContext,    stagingBufferMemory, nullptr);
 	vkDestroyBuffer(this->deviceContext, stagingBuffer,       nullptr);
@@ -881,7 +840,7 @@ int VKContext::CreateTextureBuffer(FBOType fboType, VkFormat imageFormat, Textur
 	switch (textureType) {
 		case TEXTURE_2D:            layerCount = 1; break;
 		case TEXTURE_CUBEMAP:       layerCount = MAX_TEXTURES; break;
-		case TEXTURE_2D_ARRAY:      layerCount = MAX_LIGHT_SOURCES; break;
+		case TEXTURE_2D_ARRAY:      layerCount = MAX_DEPTH_LAYERS; break;
 		case TEXTURE_CUBEMAP_ARRAY: layerCount = (MAX_LIGHT_SOURCES * MAX_TEXTURES); break;
 		default: throw;
 	}
@@ -894,12 +853,14 @@ int VKContext::CreateTextureBuffer(FBOType fboType, VkFormat imageFormat, Textur
 		return -4;
 
 	// DEPTH BUFFER LAYERED VIEWS
+	uint32_t depthViews = (textureType == TEXTURE_2D_ARRAY ? MAX_DEPTH_LAYERS : MAX_LIGHT_SOURCES);
+
 	if (fboType == FBO_DEPTH)
 	{
-		for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (uint32_t i = 0; i < depthViews; i++)
 		{
 			uint32_t layer  = (i * (textureType == TEXTURE_CUBEMAP_ARRAY ? MAX_TEXTURES : 1));
-			uint32_t layers = (layerCount / MAX_LIGHT_SOURCES);
+			uint32_t layers = (textureType == TEXTURE_CUBEMAP_ARRAY ? MAX_TEXTURES : 1);
 
 			texture->DepthViews[i] = this->createImageView(
 				texture->Image, imageFormat, imageAspectFlags, 1, viewType, layers, layer
@@ -935,7 +896,7 @@ int VKContext::CreateTextureBuffer(FBOType fboType, VkFormat imageFormat, Textur
 	// DEPTH BUFFER LAYERED FRAMEBUFFERS
 	if (fboType == FBO_DEPTH)
 	{
-		for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (uint32_t i = 0; i < depthViews; i++)
 		{
 			framebufferInfo.pAttachments = &texture->DepthViews[i];
 
@@ -971,6 +932,8 @@ int VKContext::createUniformBuffers(Buffer* buffer)
 	if (this->createBuffer(sizeof(CBHUD), bufferUseFlags, bufferMemFlags, &buffer->Uniform.Buffers[UBO_VK_HUD], &buffer->Uniform.BufferMemories[UBO_VK_HUD]) < 0)
 		return -5;
 
+	MemoryTracker::Allocate(buffer, MEMORY_TAG_UNIFORMS, MEMORY_GPU, (sizeof(CBMatrix) + sizeof(CBColor) + sizeof(CBDefault) + sizeof(CBDepth) + sizeof(CBHUD)));
+
 	return 0;
 }
 
@@ -1158,6 +1121,14 @@ void VKContext::DestroyPipelineLayout(VkPipelineLayout* pipelineLayout)
 	}
 }
 
+void VKContext::DestroyQueryPool(VkQueryPool* queryPool)
+{
+	if (*queryPool != nullptr) {
+		vkDestroyQueryPool(this->deviceContext, *queryPool, nullptr);
+		*queryPool = nullptr;
+	}
+}
+
 void VKContext::DestroyShaderModule(VkShaderModule* shaderModule)
 {
 	if (*shaderModule != nullptr) {
@@ -1262,13 +1233,43 @@ int VKContext::Draw(Component* mesh, ShaderProgram* shaderProgram, const DrawPro
 	VkCommandBuffer cmdBuffer = (properties.VKCommandBuffer != nullptr ? properties.VKCommandBuffer : this->commandBuffers[this->imageIndex]);
 
 	// BIND SHADER TO PIPELINE
-	if (properties.FBO != nullptr)
+	if (shaderProgram != ShaderManager::Programs[shaderID])
+	{
+		auto &variants = (properties.FBO != nullptr ? vertexBuffer->Pipeline.VariantsFBO : vertexBuffer->Pipeline.Variants);
+		auto variant   = variants.find(shaderProgram->Features());
+
+		if (variant != variants.end()) {
+			pipeline = variant->second;
+		} else {
+			VkVertexInputBindingDescription                attribsBindingDesc = {};
+			std::vector<VkVertexInputAttributeDescription> attribsDescs       = {};
+
+			this->initVertexInput(vertexBuffer, attribsDescs, attribsBindingDesc);
+
+			if (this->createPipeline(shaderProgram, &pipeline, vertexBuffer->Pipeline.Layout, (properties.FBO != nullptr ? FBO_COLOR : FBO_UNKNOWN), attribsDescs, attribsBindingDesc) < 0)
+				return -4;
+
+			variants[shaderProgram->Features()] = pipeline;
+		}
+	}
+	else if (properties.FBO != nullptr)
+	{
 		pipeline = vertexBuffer->Pipeline.PipelinesFBO[shaderID];
+	}
 	else
+	{
 		pipeline = vertexBuffer->Pipeline.Pipelines[shaderID];
+	}
 
 	vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 
+	// A COMMAND BUFFER STARTS WITHOUT A BOUND PIPELINE - THE BOUND PIPELINE IS CLEARED WHEN RECORDING BEGINS
+	if ((pipeline != this->boundPipeline) || (cmdBuffer != this->boundCommandBuffer)) {
+		this->boundCommandBuffer = cmdBuffer;
+		this->boundPipeline      = pipeline;
+		RenderStats::AddProgramSwitch();
+	}
+
 	// BIND INDEX AND VERTEX BUFFERS
 	if (indexBuffer != nullptr)
 		vkCmdBindIndexBuffer(cmdBuffer, indexBuffer->IndexBuffer, 0, VK_INDEX_TYPE_UINT32);
@@ -1289,6 +1290,20 @@ int VKContext::Draw(Component* mesh, ShaderProgram* shaderProgram, const DrawPro
 	return 0;
 }
 
+// NEVER WAITS - RETURNS 1 IF ANY OF THE RESULTS ARE NOT AVAILABLE YET
+int VKContext::GetQueryResults(VkQueryPool queryPool, uint32_t first, uint32_t count, uint64_t* results)
+{
+	VkResult result = vkGetQueryPoolResults(
+		this->deviceContext, queryPool, first, count, (count * sizeof(uint64_t)), results, sizeof(uint64_t), VK_QUERY_RESULT_64_BIT
+	);
+
+	switch (result) {
+		case VK_SUCCESS:   return 0;
+		case VK_NOT_READY: return 1;
+		default:           return -1;
+	}
+}
+
 wxString VKContext::getApiVersion(VkPhysicalDevice device)
 {
 	if (device == nullptr)
@@ -1740,6 +1755,14 @@ VkDevice VKContext::initDeviceContext()
 	if (this->device == nullptr)
 		return nullptr;
 
+	// BLOCK COMPRESSED TEXTURES ARE OPTIONAL - ENABLE WHAT THE DEVICE SUPPORTS
+	VkPhysicalDeviceFeatures deviceFeatures = {};
+
+	vkGetPhysicalDeviceFeatures(this->device, &deviceFeatures);
+
+	features.textureCompressionBC   = deviceFeatures.textureCompressionBC;
+	features.textureCompressionETC2 = deviceFeatures.textureCompressionETC2;
+
 	this->multiSampleCount = this->getMultiSampleCount();	// MSAA
 
 	std::vector<VkDeviceQueueCreateInfo> queueInfos;
@@ -1776,6 +1799,8 @@ VkDevice VKContext::initDeviceContext()
 	if (vkCreateDevice(this->device, &deviceInfo, nullptr, &deviceContext) != VK_SUCCESS)
 		return nullptr;
 
+	this->enabledFeatures = features;
+
 	// Create the graphics and presentation queues
 	vkGetDeviceQueue(deviceContext, this->queues[VK_QUEUE_GRAPHICS]->Index,     0, &this->queues[VK_QUEUE_GRAPHICS]->Queue);
 	vkGetDeviceQueue(deviceContext, this->queues[VK_QUEUE_PRESENTATION]->Index, 0, &this->queues[VK_QUEUE_PRESENTATION]->Queue);
@@ -1881,52 +1906,7 @@ int VKContext::InitPipelines(Buffer* buffer)
 	VkVertexInputBindingDescription                attribsBindingDesc = {};
 	std::vector<VkVertexInputAttributeDescription> attribsDescs       = {};
 
-	uint32_t offset = 0;
-
-	// NORMALS
-	if (buffer->Normals() > 0)
-	{
-		VkVertexInputAttributeDescription attribsDesc = {};
-		
-		attribsDesc.location = ATTRIB_NORMAL;
-		attribsDesc.format   = VK_FORMAT_R32G32B32_SFLOAT;
-		attribsDesc.offset   = offset;
-
-		attribsDescs.push_back(attribsDesc);
-
-		offset += (3 * sizeof(float));
-	}
-
-	// POSITIONS
-	if (buffer->Vertices() > 0)
-	{
-		VkVertexInputAttributeDescription attribsDesc = {};
-
-		attribsDesc.location = ATTRIB_POSITION;
-		attribsDesc.format   = VK_FORMAT_R32G32B32_SFLOAT;
-		attribsDesc.offset   = offset;
-
-		attribsDescs.push_back(attribsDesc);
-
-		offset += (3 * sizeof(float));
-	}
-
-	// TEXTURE COORDINATES
-	if (buffer->TexCoords() > 0)
-	{
-		VkVertexInputAttributeDescription attribsDesc = {};
-
-		attribsDesc.location = ATTRIB_TEXCOORDS;
-		attribsDesc.format   = VK_FORMAT_R32G32_SFLOAT;
-		attribsDesc.offset   = offset;
-
-		attribsDescs.push_back(attribsDesc);
-
-		offset += (2 * sizeof(float));
-	}
-
-	attribsBindingDesc.stride    = offset;
-	attribsBindingDesc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+	this->initVertexInput(buffer, attribsDescs, attribsBindingDesc);
 
 	this->createUniformSet(buffer);
 	this->createUniformBuffers(buffer);
@@ -2188,6 +2168,56 @@ bool VKContext::initSync()
 	return true;
 }
 
+void VKContext::initVertexInput(Buffer* buffer, std::vector<VkVertexInputAttributeDescription> &attribsDescs, VkVertexInputBindingDescription &attribsBindingDesc)
+{
+	uint32_t offset = 0;
+
+	// NORMALS
+	if (buffer->Normals() > 0)
+	{
+		VkVertexInputAttributeDescription attribsDesc = {};
+		
+		attribsDesc.location = ATTRIB_NORMAL;
+		attribsDesc.format   = VK_FORMAT_R32G32B32_SFLOAT;
+		attribsDesc.offset   = offset;
+
+		attribsDescs.push_back(attribsDesc);
+
+		offset += (3 * sizeof(float));
+	}
+
+	// POSITIONS
+	if (buffer->Vertices() > 0)
+	{
+		VkVertexInputAttributeDescription attribsDesc = {};
+
+		attribsDesc.location = ATTRIB_POSITION;
+		attribsDesc.format   = VK_FORMAT_R32G32B32_SFLOAT;
+		attribsDesc.offset   = offset;
+
+		attribsDescs.push_back(attribsDesc);
+
+		offset += (3 * sizeof(float));
+	}
+
+	// TEXTURE COORDINATES
+	if (buffer->TexCoords() > 0)
+	{
+		VkVertexInputAttributeDescription attribsDesc = {};
+
+		attribsDesc.location = ATTRIB_TEXCOORDS;
+		attribsDesc.format   = VK_FORMAT_R32G32_SFLOAT;
+		attribsDesc.offset   = offset;
+
+		attribsDescs.push_back(attribsDesc);
+
+		offset += (2 * sizeof(float));
+	}
+
+	attribsBindingDesc.stride    = offset;
+	attribsBindingDesc.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+}
+
 VkPipelineViewportStateCreateInfo VKContext::initViewport()
 {
 	VkPipelineViewportStateCreateInfo viewportState = {};
@@ -2201,8 +2231,11 @@ VkPipelineViewportStateCreateInfo VKContext::initViewport()
 
 bool VKContext::init(bool vsync)
 {
-	this->frameIndex = 0;
-	this->vSync      = vsync;
+	this->boundCommandBuffer = nullptr;
+	this->boundPipeline      = nullptr;
+	this->enabledFeatures    = {};
+	this->frameIndex         = 0;
+	this->vSync              = vsync;
 
 	this->instance = this->initInstance();
 
@@ -2237,6 +2270,25 @@ bool VKContext::init(bool vsync)
 	return true;
 }
 
+bool VKContext::IsFormatSupported(VkFormat format)
+{
+	if (this->device == nullptr)
+		return false;
+
+	if ((format >= VK_FORMAT_BC1_RGB_UNORM_BLOCK) && (format <= VK_FORMAT_BC7_SRGB_BLOCK) && !this->enabledFeatures.textureCompressionBC)
+		return false;
+
+	if ((format >= VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK) && (format <= VK_FORMAT_EAC_R11G11_SNORM_BLOCK) && !this->enabledFeatures.textureCompressionETC2)
+		return false;
+
+	VkFormatProperties   formatProperties = {};
+	VkFormatFeatureFlags requiredFeatures = (VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT | VK_FORMAT_FEATURE_TRANSFER_DST_BIT);
+
+	vkGetPhysicalDeviceFormatProperties(this->device, format, &formatProperties);
+
+	return ((formatProperties.optimalTilingFeatures & requiredFeatures) == requiredFeatures);
+}
+
 bool VKContext::IsOK()
 {
 	return this->isOK;
@@ -2413,6 +2465,20 @@ void VKContext::ResetPipelines()
 	RenderEngine::Ready = true;
 }
 
+void VKContext::ResetQueryPool(VkQueryPool queryPool, uint32_t first, uint32_t count, VkCommandBuffer cmdBuffer)
+{
+	// QUERIES HAVE TO BE RESET OUTSIDE OF A RENDER PASS - WITHOUT A COMMAND BUFFER THE RESET IS SUBMITTED AND WAITED FOR
+	VkCommandBuffer commandBuffer = (cmdBuffer != nullptr ? cmdBuffer : this->CommandBufferBegin());
+
+	if (commandBuffer == nullptr)
+		return;
+
+	vkCmdResetQueryPool(commandBuffer, queryPool, first, count);
+
+	if (cmdBuffer == nullptr)
+		this->CommandBufferEnd(commandBuffer);
+}
+
 bool VKContext::ResetSwapChain()
 {
 	RenderEngine::Ready = false;
@@ -2437,6 +2503,125 @@ void VKContext::SetVSync(bool enable)
 	this->ResetSwapChain();
 }
 
+// NANOSECONDS PER TIMESTAMP TICK - 0 IF THE GRAPHICS QUEUE DOES NOT SUPPORT TIMESTAMPS
+float VKContext::TimestampPeriod()
+{
+	if ((this->device == nullptr) || (this->queues.size() <= VK_QUEUE_GRAPHICS) || (this->queues[VK_QUEUE_GRAPHICS]->Index < 0))
+		return 0.0f;
+
+	VkPhysicalDeviceProperties deviceProperties;
+	vkGetPhysicalDeviceProperties(this->device, &deviceProperties);
+
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(this->device, &queueFamilyCount, nullptr);
+
+	std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(this->device, &queueFamilyCount, queueFamilies.data());
+
+	uint32_t index = (uint32_t)this->queues[VK_QUEUE_GRAPHICS]->Index;
+
+	if ((index >= queueFamilyCount) || (queueFamilies[index].timestampValidBits == 0))
+		return 0.0f;
+
+	return deviceProperties.limits.timestampPeriod;
+}
+
+// THE PIXELS HOLD THE WHOLE LEVEL 0 (RGBA8), ONLY THE REGION IS STAGED AND COPIED
+int VKContext::UpdateTexture(Texture* texture, const uint8_t* pixels, const wxRect &region)
+{
+	if ((texture == nullptr) || (texture->Image == nullptr) || (pixels == nullptr))
+		return -1;
+
+	VkBufferUsageFlags    bufferUseFlags      = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	VkMemoryPropertyFlags bufferMemFlags      = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	VkFormat              imageFormat         = TextureCompressor::ToVkFormat(TEXTURE_COMPRESSION_NONE, texture->SRGB());
+	size_t                rowSize             = ((size_t)region.GetWidth() * 4);
+	VkDeviceSize          regionSize          = (VkDeviceSize)(rowSize * region.GetHeight());
+	VkBuffer              stagingBuffer       = nullptr;
+	VkDeviceMemory        stagingBufferMemory = nullptr;
+	size_t                width               = (size_t)texture->Size().GetWidth();
+
+	// STAGING BUFFER
+	if (this->createBuffer(regionSize, bufferUseFlags, bufferMemFlags, &stagingBuffer, &stagingBufferMemory) < 0)
+		return -2;
+
+	// COPY THE ROWS OF THE REGION TO THE STAGING BUFFER
+	void* imageMemData = nullptr;
+
+	vkMapMemory(this->deviceContext, stagingBufferMemory, 0, regionSize, 0, &imageMemData);
+
+	for (int y = 0; y < region.GetHeight(); y++) {
+		const uint8_t* row = (pixels + ((((size_t)(region.GetY() + y) * width) + region.GetX()) * 4));
+		memcpy((static_cast<uint8_t*>(imageMemData) + (y * rowSize)), row, rowSize);
+	}
+
+	vkUnmapMemory(this->deviceContext, stagingBufferMemory);
+
+	int result = -3;
+
+	if (this->copyImage(texture->Image, imageFormat, 1, TEXTURE_2D, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) == 0)
+	{
+		VkCommandBuffer cmdBuffer = this->CommandBufferBegin();
+
+		if (cmdBuffer != nullptr)
+		{
+			VkBufferImageCopy copyRegion = {};
+
+			copyRegion.imageExtent                 = { (uint32_t)region.GetWidth(), (uint32_t)region.GetHeight(), 1 };
+			copyRegion.imageOffset                 = { region.GetX(), region.GetY(), 0 };
+			copyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+			copyRegion.imageSubresource.layerCount = 1;
+
+			vkCmdCopyBufferToImage(cmdBuffer, stagingBuffer, texture->Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyRegion);
+
+			this->CommandBufferEnd(cmdBuffer);
+
+			result = 0;
+		}
+
+		// THE IMAGE GOES BACK TO THE SHADER LAYOUT EVEN IF THE COPY FAILED
+		if (this->copyImage(texture->Image, imageFormat, 1, TEXTURE_2D, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) < 0)
+			result = -4;
+	}
+
+	vkFreeMemory(this->deviceContext,    stagingBufferMemory, nullptr);
+	vkDestroyBuffer(this->deviceContext, stagingBuffer,       nullptr);
+
+	return result;
+}
+
+// COPIES NEW VERTEX DATA OF THE SAME SIZE INTO THE EXISTING VERTEX BUFFER, SO THE PIPELINES OF THE BUFFER ARE KEPT
+int VKContext::UpdateVertexBuffer(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer)
+{
+	if ((buffer == nullptr) || (buffer->VertexBuffer == nullptr))
+		return -1;
+
+	VkBuffer              stagingBuffer         = nullptr;
+	VkDeviceMemory        stagingBufferMemory   = nullptr;
+	VkMemoryPropertyFlags stagingBufferMemFlags = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+	VkBufferUsageFlags    stagingBufferUseFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	std::vector<float>    vertexBufferData      = Utils::ToVertexBufferData(vertices, normals, texCoords);
+	void*                 vertexBufferMemData   = nullptr;
+	size_t                vertexBufferSize      = (vertexBufferData.size() * sizeof(float));
+
+	// STAGING BUFFER
+	if (this->createBuffer(vertexBufferSize, stagingBufferUseFlags, stagingBufferMemFlags, &stagingBuffer, &stagingBufferMemory) < 0)
+		return -2;
+
+	// COPY DATA TO STAGE BUFFER
+	vkMapMemory(this->deviceContext, stagingBufferMemory, 0, vertexBufferSize, 0, &vertexBufferMemData);
+	memcpy(vertexBufferMemData, vertexBufferData.data(), (size_t)vertexBufferSize);
+	vkUnmapMemory(this->deviceContext, stagingBufferMemory);
+
+	// COPY DATA FROM STAGING TO VERTEX BUFFER (DEVICE LOCAL)
+	int result = (this->copyBuffer(stagingBuffer, buffer->VertexBuffer, vertexBufferSize) < 0 ? -3 : 0);
+
+	vkFreeMemory(this->deviceContext,    stagingBufferMemory, nullptr);
+	vkDestroyBuffer(this->deviceContext, stagingBuffer,       nullptr);
+
+	return result;
+}
+
 void VKContext::transitionImageLayout(VkCommandBuffer cmdBuffer, VkImageMemoryBarrier &imageMemBarrier, VkPipelineStageFlagBits destStage)
 {
 	vkCmdPipelineBarrier(
@@ -73,6 +73,8 @@ public:
 	~VKContext();
 
 private:
+	VkCommandBuffer              boundCommandBuffer;
+	VkPipeline                   boundPipeline;
 	std::vector<VkImage>         colorImages;
 	std::vector<VkDeviceMemory>  colorImageMemories;
 	std::vector<VkImageView>     colorImageViews;
@@ -83,6 +85,7 @@ private:
 	std::vector<VkImageView>     depthBufferImageViews;
 	VkPhysicalDevice             device;
 	VkDevice                     deviceContext;
+	VkPhysicalDeviceFeatures     enabledFeatures;
 	std::vector<VkFramebuffer>   frameBuffers;
 	std::vector<VkFence>         frameFences;
 	uint32_t                     frameIndex;
@@ -105,38 +108,44 @@ private:
 
 public:
 	void            Clear(const glm::vec4 &colorRGBA, const DrawProperties& properties);
+	VkCommandBuffer CommandBuffer();
 	VkCommandBuffer CommandBufferBegin();
 	void            CommandBufferEnd(VkCommandBuffer cmdBuffer);
 	int             CreateIndexBuffer(const std::vector<uint32_t> &indices, Buffer* buffer);
+	VkQueryPool     CreateQueryPool(uint32_t count);
 	int             CreateShaderModule(const wxString &shaderFile, const wxString &stage, VkShaderModule* shaderModule);
-	int             CreateTexture(const std::vector<uint8_t*> &imagePixels, Texture* texture, VkFormat imageFormat);
+	int             CreateTexture(const CompressedImage &image, Texture* texture, VkFormat imageFormat);
 	int             CreateTextureBuffer(FBOType fboType, VkFormat imageFormat, Texture* texture);
 	int             CreateVertexBuffer(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer);
 	void            DestroyBuffer(VkBuffer* buffer, VkDeviceMemory* bufferMemory);
 	void            DestroyFramebuffer(VkFramebuffer* frameBuffer);
 	void            DestroyPipeline(VkPipeline* pipeline);
 	void            DestroyPipelineLayout(VkPipelineLayout* pipelineLayout);
+	void            DestroyQueryPool(VkQueryPool* queryPool);
 	void            DestroyShaderModule(VkShaderModule* shaderModule);
 	void            DestroyTexture(VkImage* image, VkDeviceMemory* imageMemory, VkImageView* textureImageView, VkSampler* sampler);
 	void            DestroyUniformSet(VkDescriptorPool* uniformPool, VkDescriptorSetLayout* uniformLayout);
 	int             Draw(Component* mesh, ShaderProgram* shaderProgram, const DrawProperties &properties = {});
+	int             GetQueryResults(VkQueryPool queryPool, uint32_t first, uint32_t count, uint64_t* results);
 	int             InitPipelines(Buffer* buffer);
+	bool            IsFormatSupported(VkFormat format);
 	bool            IsOK();
 	void            Present(VkCommandBuffer cmdBuffer = nullptr);
 	void            ResetPipelines();
+	void            ResetQueryPool(VkQueryPool queryPool, uint32_t first, uint32_t count, VkCommandBuffer cmdBuffer = nullptr);
 	bool            ResetSwapChain();
 	void            SetVSync(bool enable);
+	float           TimestampPeriod();
+	int             UpdateTexture(Texture* texture, const uint8_t* pixels, const wxRect &region);
+	int             UpdateVertexBuffer(const std::vector<float> &vertices, const std::vector<float> &normals, const std::vector<float> &texCoords, Buffer* buffer);
 
 private:
-	void                                   blitImage(VkCommandBuffer cmdBuffer, VkImage image, int mipWidth, int mipHeight, int index);
 	int                                    copyBuffer(VkBuffer sourceBuffer, VkBuffer destinationBuffer, VkDeviceSize bufferSize);
-	int                                    copyBufferToImage(VkBuffer buffer, VkImage image, int colorComponents, uint32_t width, uint32_t height, uint32_t index = 0);
 	int                                    copyImage(VkImage image, VkFormat imageFormat, uint32_t mipLevels, TextureType textureType, VkImageLayout oldLayout, VkImageLayout newLayout);
 	int                                    createBuffer(VkDeviceSize size, VkBufferUsageFlags useFlags, VkMemoryPropertyFlags memoryFlags, VkBuffer* buffer, VkDeviceMemory* bufferMemory);
 	int                                    createImage(uint32_t width, uint32_t height, uint32_t mipLevels, uint32_t sampleCount, VkFormat format, VkImageTiling tiling, VkImageUsageFlags useFlags, VkMemoryPropertyFlags memoryFlags, TextureType textureType, VkImage* image, VkDeviceMemory* imageMemory);
 	VkSampler                              createImageSampler(float mipLevels, float sampleCount, VkSamplerCreateInfo &samplerInfo);
 	VkImageView                            createImageView(VkImage image, VkFormat imageFormat, VkImageAspectFlags aspectFlags, uint32_t mipLevels, VkImageViewType viewType, uint32_t layerCount = 1, uint32_t layer = 0);
-	int                                    createMipMaps(VkImage image, VkFormat imageFormat, int width, int height, uint32_t mipLevels);
 	int                                    createPipeline(ShaderProgram* shaderProgram, VkPipeline* pipeline, VkPipelineLayout pipelineLayout, FBOType fboType, const std::vector<VkVertexInputAttributeDescription> &attribsDescs, const VkVertexInputBindingDescription &attribsBindingDesc);
 	int                                    createPipelineLayout(Buffer* buffer);
 	int                                    createUniformBuffers(Buffer* buffer);
@@ -172,6 +181,7 @@ private:
 	VkSurfaceKHR                           initSurface();
 	VKSwapchain*                           initSwapChain();
 	bool                                   initSync();
+	void                                   initVertexInput(Buffer* buffer, std::vector<VkVertexInputAttributeDescription> &attribsDescs, VkVertexInputBindingDescription &attribsBindingDesc);
 	VkPipelineViewportStateCreateInfo      initViewport();
 	bool                                   init(bool vsync = true);
 	void                                   release();
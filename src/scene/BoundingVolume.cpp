@@ -18,35 +18,21 @@ BoundingVolume::BoundingVolume() : Mesh(nullptr, "")
 
 void BoundingVolume::loadBoundingBox(float scaleSize)
 {
-	this->Name    = "Bounding Box";
-	auto aiMeshes = Utils::LoadModelFile(Utils::RESOURCE_MODELS[ID_ICON_CUBE]);
-
-	if (!aiMeshes.empty()) {
-		this->loadModelFile(aiMeshes[0]->Mesh, scaleSize);
-		aiReleaseImport(aiMeshes[0]->Scene);
-	}
-	
+	this->Name = "Bounding Box";
+	this->loadPrimitive(Primitives::Get(ID_ICON_CUBE), scaleSize);
 }
 
 void BoundingVolume::loadBoundingSphere(float scaleSize)
 {
-	this->Name    = "Bounding Sphere";
-	auto aiMeshes = Utils::LoadModelFile(Utils::RESOURCE_MODELS[ID_ICON_ICO_SPHERE]);
-
-	if (!aiMeshes.empty()) {
-		this->loadModelFile(aiMeshes[0]->Mesh, scaleSize);
-		aiReleaseImport(aiMeshes[0]->Scene);
-	}
+	this->Name = "Bounding Sphere";
+	this->loadPrimitive(Primitives::Get(ID_ICON_ICO_SPHERE), scaleSize);
 }
 
-bool BoundingVolume::loadModelFile(aiMesh* mesh, float scaleSize)
+bool BoundingVolume::loadPrimitive(PrimitiveMesh* primitive, float scaleSize)
 {
-	if (mesh == nullptr)
+	if (!this->setPrimitiveData(primitive))
 		return false;
 
-	this->loadModelData(mesh);
-	this->setModelData();
-
 	this->scale = glm::vec3(scaleSize, scaleSize, scaleSize);
 	//this->LockToParentPosition = true;
 	//this->LockToParentRotation = true;
@@ -54,7 +40,7 @@ bool BoundingVolume::loadModelFile(aiMesh* mesh, float scaleSize)
 
 	this->updateModelData();
 
-	this->isValid = ((this->IBO() > 0) && (this->VBO() > 0));
+	this->isValid = this->IsOK();
 
 	return this->isValid;
 }
@@ -23,7 +23,7 @@ public:
 private:
 	void loadBoundingBox(float scaleSize);
 	void loadBoundingSphere(float scaleSize);
-	bool loadModelFile(aiMesh* mesh, float scaleSize);
+	bool loadPrimitive(PrimitiveMesh* primitive, float scaleSize);
 	
 };
 
@@ -20,12 +20,12 @@ CBLight::CBLight(LightSource* lightSource)
 
 CBMatrix::CBMatrix(Component* mesh, bool removeTranslation)
 {
-	this->Model  = mesh->Matrix();
+	this->Model  = RenderThread::GetMatrix(mesh);
 	this->Normal = glm::mat4(glm::transpose(glm::inverse(glm::mat3(this->Model))));
-	this->MVP    = RenderEngine::CameraMain->MVP(this->Model, removeTranslation);
+	this->MVP    = RenderThread::GetCamera()->MVP(this->Model, removeTranslation);
 }
 
-CBMatrix::CBMatrix(LightSource* lightSource, Component* mesh)
+CBMatrix::CBMatrix(LightSource* lightSource, Component* mesh, int cascade)
 {
 	glm::mat4 depthTransform = glm::mat4(
 		1.0f, 0.0f, 0.0f, 0.0f,
@@ -34,8 +34,8 @@ CBMatrix::CBMatrix(LightSource* lightSource, Component* mesh)
 		0.0f, 0.0f, 0.5f, 1.0f
 	);
 
-	this->Model = mesh->Matrix();
-	this->MVP   = lightSource->MVP(this->Model);
+	this->Model = RenderThread::GetMatrix(mesh);
+	this->MVP   = (cascade >= 0 ? (ShadowCascades::ViewProjection(cascade) * this->Model) : lightSource->MVP(this->Model));
 
 	glm::mat4 projection = lightSource->Projection();
 
@@ -69,25 +69,25 @@ CBColor::CBColor(const glm::vec4 &color)
 
 CBDefault::CBDefault(Component* mesh, const DrawProperties &properties)
 {
-	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++) {
-		if (SceneManager::LightSources[i] != nullptr)
-			this->LightSources[i] = CBLight(SceneManager::LightSources[i]);
-	}
+	for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+		RenderThread::GetLight(i, this->LightSources[i]);
 
 	for (int i = 0; i < MAX_TEXTURES; i++)
-		this->IsTextured[i] = Utils::ToVec4Float(mesh->IsTextured(i));
+		this->IsTextured[i] = Utils::ToVec4Float(RenderThread::IsTextured(mesh, i));
 
 	for (int i = 0; i < MAX_TEXTURES; i++)
-		this->TextureScales[i] = glm::vec4(mesh->Textures[i]->Scale.x, mesh->Textures[i]->Scale.y, 0.0f, 0.0f);
+		this->TextureScales[i] = glm::vec4(RenderThread::GetTextureScale(mesh, i), 0.0f, 0.0f);
+
+	Material* material = RenderThread::GetMaterial(mesh);
 
-	this->MeshSpecular = glm::vec4(mesh->ComponentMaterial.specular.intensity, mesh->ComponentMaterial.specular.shininess);
-	this->MeshDiffuse  = mesh->ComponentMaterial.diffuse;
+	this->MeshSpecular = glm::vec4(material->specular.intensity, material->specular.shininess);
+	this->MeshDiffuse  = material->diffuse;
 
 	this->ClipMax        = glm::vec4(properties.ClipMax, 0.0f);
 	this->ClipMin        = glm::vec4(properties.ClipMin, 0.0f);
 	this->EnableClipping = Utils::ToVec4Float(properties.EnableClipping);
 
-	this->CameraPosition = glm::vec4(RenderEngine::CameraMain->Position(), 0.0f);
+	this->CameraPosition = glm::vec4(RenderThread::GetCamera()->Position(), 0.0f);
 	this->ComponentType  = Utils::ToVec4Float(static_cast<int>(mesh->Type()));
 	this->EnableSRGB     = Utils::ToVec4Float(RenderEngine::EnableSRGB);
 	this->WaterProps     = {};
@@ -96,6 +96,18 @@ CBDefault::CBDefault(Component* mesh, const DrawProperties &properties)
 		auto water = dynamic_cast<Water*>(mesh->Parent);
 		this->WaterProps = { water->FBO()->MoveFactor(), water->FBO()->WaveStrength, 0.0f, 0.0f };
 	}
+
+	this->ClusterDepth          = LightCluster::Depth();
+	this->ClusterGrid           = LightCluster::Grid();
+	this->ClusterViewProjection = LightCluster::ViewProjection();
+
+	this->ShadowCascadeLight  = glm::vec4((float)ShadowCascades::Cascades(), (float)ShadowCascades::Light(), 0.0f, 0.0f);
+	this->ShadowCascadeBias   = ShadowCascades::BiasScales();
+	this->ShadowCascadeDepth  = ShadowCascades::DepthPlane();
+	this->ShadowCascadeSplits = ShadowCascades::Splits();
+
+	for (int i = 0; i < MAX_SHADOW_CASCADES; i++)
+		this->ShadowCascadeViewProjections[i] = ShadowCascades::ViewProjection(i);
 }
 
 CBDepth::CBDepth(const glm::vec3 &lightPosition, int depthLayer)
@@ -171,7 +183,7 @@ CBDefaultDX::CBDefaultDX(const CBMatrix &matrices, Component* mesh, const glm::v
 		this->IsTextured[i] = Utils::ToXMFLOAT4(mesh->IsTextured(i));
 
 	for (int i = 0; i < MAX_TEXTURES; i++)
-		this->TextureScales[i] = DirectX::XMFLOAT4(mesh->Textures[i]->Scale.x, mesh->Textures[i]->Scale.y, 0.0f, 0.0f);
+		this->TextureScales[i] = DirectX::XMFLOAT4(mesh->TextureScales[i].x, mesh->TextureScales[i].y, 0.0f, 0.0f);
 
 	this->MeshSpecular = Utils::ToXMFLOAT4(mesh->ComponentMaterial.specular.intensity, mesh->ComponentMaterial.specular.shininess);
 	this->MeshDiffuse  = Utils::ToXMFLOAT4(mesh->ComponentMaterial.diffuse);
@@ -189,6 +201,18 @@ CBDefaultDX::CBDefaultDX(const CBMatrix &matrices, Component* mesh, const glm::v
 		auto water = dynamic_cast<Water*>(mesh->Parent);
 		this->WaterProps = { water->FBO()->MoveFactor(), water->FBO()->WaveStrength, 0.0f, 0.0f };
 	}
+
+	this->ClusterDepth          = Utils::ToXMFLOAT4(LightCluster::Depth());
+	this->ClusterGrid           = Utils::ToXMFLOAT4(LightCluster::Grid());
+	this->ClusterViewProjection = Utils::ToXMMATRIX(LightCluster::ViewProjection());
+
+	this->ShadowCascadeLight  = Utils::ToXMFLOAT4(glm::vec4((float)ShadowCascades::Cascades(), (float)ShadowCascades::Light(), 0.0f, 0.0f));
+	this->ShadowCascadeBias   = Utils::ToXMFLOAT4(ShadowCascades::BiasScales());
+	this->ShadowCascadeDepth  = Utils::ToXMFLOAT4(ShadowCascades::DepthPlane());
+	this->ShadowCascadeSplits = Utils::ToXMFLOAT4(ShadowCascades::Splits());
+
+	for (int i = 0; i < MAX_SHADOW_CASCADES; i++)
+		this->ShadowCascadeViewProjections[i] = Utils::ToXMMATRIX(ShadowCascades::ViewProjection(i));
 }
 
 CBDefaultDX::CBDefaultDX(const CBDefault &default, const CBMatrix &matrices)
@@ -215,6 +239,18 @@ CBDefaultDX::CBDefaultDX(const CBDefault &default, const CBMatrix &matrices)
 	this->ComponentType  = Utils::ToXMFLOAT4(default.ComponentType);
 	this->EnableSRGB     = Utils::ToXMFLOAT4(default.EnableSRGB);
 	this->WaterProps     = Utils::ToXMFLOAT4(default.WaterProps);
+
+	this->ClusterDepth          = Utils::ToXMFLOAT4(default.ClusterDepth);
+	this->ClusterGrid           = Utils::ToXMFLOAT4(default.ClusterGrid);
+	this->ClusterViewProjection = Utils::ToXMMATRIX(default.ClusterViewProjection);
+
+	this->ShadowCascadeLight  = Utils::ToXMFLOAT4(default.ShadowCascadeLight);
+	this->ShadowCascadeBias   = Utils::ToXMFLOAT4(default.ShadowCascadeBias);
+	this->ShadowCascadeDepth  = Utils::ToXMFLOAT4(default.ShadowCascadeDepth);
+	this->ShadowCascadeSplits = Utils::ToXMFLOAT4(default.ShadowCascadeSplits);
+
+	for (int i = 0; i < MAX_SHADOW_CASCADES; i++)
+		this->ShadowCascadeViewProjections[i] = Utils::ToXMMATRIX(default.ShadowCascadeViewProjections[i]);
 }
 
 CBDepthDX::CBDepthDX(const CBMatrix &matrices, const glm::vec3 &lightPosition, int depthLayer)
@@ -241,6 +277,8 @@ Buffer::Buffer(std::vector<uint32_t> &indices)
 {
 	this->init();
 
+	RenderStats::AddBytesUploaded(indices.size() * sizeof(uint32_t));
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 	#if defined _WINDOWS
 	case GRAPHICS_API_DIRECTX11:
@@ -263,6 +301,9 @@ Buffer::Buffer(std::vector<uint32_t> &indices)
 	case GRAPHICS_API_VULKAN:
 		RenderEngine::Canvas.VK->CreateIndexBuffer(indices, this);
 		break;
+	case GRAPHICS_API_NULL:
+		this->NullID = RenderEngine::Canvas.Null->CreateResource(indices.size() * sizeof(uint32_t));
+		break;
 	default:
 		throw;
 	}
@@ -272,6 +313,8 @@ Buffer::Buffer(std::vector<float> &data)
 {
 	this->init();
 
+	RenderStats::AddBytesUploaded(data.size() * sizeof(float));
+
 	glCreateBuffers(1, &this->id);
 
 	if (id > 0) {
@@ -289,6 +332,8 @@ Buffer::Buffer(std::vector<float> &vertices, std::vector<float> &normals, std::v
 	this->texCoords = texCoords;
 	this->vertices  = vertices;
 
+	RenderStats::AddBytesUploaded((vertices.size() + normals.size() + texCoords.size()) * sizeof(float));
+
 	switch (RenderEngine::SelectedGraphicsAPI) {
 	case GRAPHICS_API_DIRECTX11:
 		RenderEngine::Canvas.DX->CreateVertexBuffer11(vertices, normals, texCoords, this);
@@ -302,6 +347,9 @@ Buffer::Buffer(std::vector<float> &vertices, std::vector<float> &normals, std::v
 		RenderEngine::Canvas.VK->CreateVertexBuffer(vertices, normals, texCoords, this);
 		RenderEngine::Canvas.VK->InitPipelines(this);
 		break;
+	case GRAPHICS_API_NULL:
+		this->NullID = RenderEngine::Canvas.Null->CreateResource((vertices.size() + normals.size() + texCoords.size()) * sizeof(float));
+		break;
 	default:
 		throw;
 	}
@@ -344,6 +392,11 @@ Buffer::~Buffer()
 		this->id = 0;
 	}
 
+	if ((this->NullID > 0) && (RenderEngine::Canvas.Null != nullptr)) {
+		RenderEngine::Canvas.Null->DestroyResource(this->NullID);
+		this->NullID = 0;
+	}
+
 	for (uint32_t i = 0; i < NR_OF_UBOS_VK; i++)
 		RenderEngine::Canvas.VK->DestroyBuffer(&this->Uniform.Buffers[i], &this->Uniform.BufferMemories[i]);
 
@@ -352,10 +405,18 @@ Buffer::~Buffer()
 		RenderEngine::Canvas.VK->DestroyPipeline(&this->Pipeline.PipelinesFBO[i]);
 	}
 
+	for (auto &variant : this->Pipeline.Variants)
+		RenderEngine::Canvas.VK->DestroyPipeline(&variant.second);
+
+	for (auto &variant : this->Pipeline.VariantsFBO)
+		RenderEngine::Canvas.VK->DestroyPipeline(&variant.second);
+
 	RenderEngine::Canvas.VK->DestroyPipelineLayout(&this->Pipeline.Layout);
 	RenderEngine::Canvas.VK->DestroyUniformSet(&this->Uniform.Pool, &this->Uniform.Layout);
 	RenderEngine::Canvas.VK->DestroyBuffer(&this->IndexBuffer,  &this->IndexBufferMemory);
 	RenderEngine::Canvas.VK->DestroyBuffer(&this->VertexBuffer, &this->VertexBufferMemory);
+
+	MemoryTracker::Free(this);
 }
 
 void Buffer::init()
@@ -364,6 +425,7 @@ void Buffer::init()
 	this->id                 = 0;
 	this->IndexBuffer        = nullptr;
 	this->IndexBufferMemory  = nullptr;
+	this->NullID             = 0;
 	this->Pipeline           = {};
 	this->Uniform            = {};
 	this->VertexBuffer       = nullptr;
@@ -415,6 +477,15 @@ void Buffer::ResetPipelines()
 		RenderEngine::Canvas.VK->DestroyPipeline(&Pipeline.PipelinesFBO[i]);
 	}
 
+	for (auto &variant : Pipeline.Variants)
+		RenderEngine::Canvas.VK->DestroyPipeline(&variant.second);
+
+	for (auto &variant : Pipeline.VariantsFBO)
+		RenderEngine::Canvas.VK->DestroyPipeline(&variant.second);
+
+	Pipeline.Variants.clear();
+	Pipeline.VariantsFBO.clear();
+
 	RenderEngine::Canvas.VK->DestroyBuffer(&this->VertexBuffer, &this->VertexBufferMemory);
 	RenderEngine::Canvas.VK->CreateVertexBuffer(this->vertices, this->normals, this->texCoords, this);
 }
@@ -424,6 +495,56 @@ size_t Buffer::TexCoords()
 	return this->texCoords.size();
 }
 
+// OPENGL ATTRIBUTE BUFFER - THE DATA KEEPS ITS SIZE
+int Buffer::Update(std::vector<float> &data)
+{
+	if ((this->id == 0) || data.empty())
+		return -1;
+
+	RenderStats::AddBytesUploaded(data.size() * sizeof(float));
+
+	glBindBuffer(GL_ARRAY_BUFFER, this->id);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, (data.size() * sizeof(float)), &data[0]);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	return 0;
+}
+
+// INTERLEAVED VERTEX BUFFER - THE DATA KEEPS ITS SIZE, SO THE PIPELINES AND STATES OF THE BUFFER ARE KEPT
+int Buffer::Update(std::vector<float> &vertices, std::vector<float> &normals, std::vector<float> &texCoords)
+{
+	if ((vertices.size() != this->vertices.size()) || (normals.size() != this->normals.size()) || (texCoords.size() != this->texCoords.size()))
+		return -1;
+
+	this->normals   = normals;
+	this->texCoords = texCoords;
+	this->vertices  = vertices;
+
+	RenderStats::AddBytesUploaded((vertices.size() + normals.size() + texCoords.size()) * sizeof(float));
+
+	int result = 0;
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+		result = RenderEngine::Canvas.DX->UpdateVertexBuffer11(vertices, normals, texCoords, this);
+		break;
+	case GRAPHICS_API_DIRECTX12:
+		result = RenderEngine::Canvas.DX->UpdateVertexBuffer12(vertices, normals, texCoords, this);
+		break;
+	#endif
+	case GRAPHICS_API_VULKAN:
+		result = RenderEngine::Canvas.VK->UpdateVertexBuffer(vertices, normals, texCoords, this);
+		break;
+	case GRAPHICS_API_NULL:
+		break;
+	default:
+		throw;
+	}
+
+	return (result < 0 ? -2 : 0);
+}
+
 size_t Buffer::Vertices()
 {
 	return this->vertices.size();
@@ -28,7 +28,7 @@ struct CBLight
 struct CBMatrix
 {
 	CBMatrix(Component* mesh, bool removeTranslation);
-	CBMatrix(LightSource* lightSource, Component* mesh);
+	CBMatrix(LightSource* lightSource, Component* mesh, int cascade = -1);
 	CBMatrix() {}
 
 	glm::mat4 Normal = {};
@@ -66,6 +66,16 @@ struct CBDefault
 	glm::vec4 ComponentType  = {};
 	glm::vec4 EnableSRGB     = {};
 	glm::vec4 WaterProps     = {}; // { MoveFactor, WaveStrength, 0, 0 }
+
+	glm::vec4 ClusterDepth          = {}; // { Near, Far, Scale, Bias }
+	glm::vec4 ClusterGrid           = {}; // { TilesX, TilesY, Slices, Lights }
+	glm::mat4 ClusterViewProjection = {};
+
+	glm::vec4 ShadowCascadeLight      = {}; // { Count, Light, 0, 0 }
+	glm::vec4 ShadowCascadeBias       = {}; // { Scale[0], Scale[1], Scale[2], Scale[3] }
+	glm::vec4 ShadowCascadeDepth      = {}; // VIEW DEPTH = dot(xyz, position) + w
+	glm::vec4 ShadowCascadeSplits     = {}; // { Far[0], Far[1], Far[2], Far[3] }
+	glm::mat4 ShadowCascadeViewProjections[MAX_SHADOW_CASCADES];
 };
 
 struct CBDepth
@@ -148,6 +158,16 @@ struct CBDefaultDX
 	DirectX::XMFLOAT4 ComponentType  = {};
 	DirectX::XMFLOAT4 EnableSRGB     = {};
 	DirectX::XMFLOAT4 WaterProps     = {}; // { MoveFactor, WaveStrength, 0, 0 }
+
+	DirectX::XMFLOAT4 ClusterDepth          = {}; // { Near, Far, Scale, Bias }
+	DirectX::XMFLOAT4 ClusterGrid           = {}; // { TilesX, TilesY, Slices, Lights }
+	DirectX::XMMATRIX ClusterViewProjection = {};
+
+	DirectX::XMFLOAT4 ShadowCascadeLight      = {}; // { Count, Light, 0, 0 }
+	DirectX::XMFLOAT4 ShadowCascadeBias       = {}; // { Scale[0], Scale[1], Scale[2], Scale[3] }
+	DirectX::XMFLOAT4 ShadowCascadeDepth      = {}; // VIEW DEPTH = dot(xyz, position) + w
+	DirectX::XMFLOAT4 ShadowCascadeSplits     = {}; // { Far[0], Far[1], Far[2], Far[3] }
+	DirectX::XMMATRIX ShadowCascadeViewProjections[MAX_SHADOW_CASCADES];
 };
 
 struct CBDepthDX
@@ -193,6 +213,7 @@ public:
 	UINT           BufferStride;
 	VkBuffer       IndexBuffer;
 	VkDeviceMemory IndexBufferMemory;
+	uint32_t       NullID;
 	VKPipeline     Pipeline;
 	VKUniform      Uniform;
 	VkBuffer       VertexBuffer;
@@ -238,6 +259,8 @@ public:
 	size_t Normals();
 	void   ResetPipelines();
 	size_t TexCoords();
+	int    Update(std::vector<float> &data);
+	int    Update(std::vector<float> &vertices, std::vector<float> &normals, std::vector<float> &texCoords);
 	size_t Vertices();
 
 private:
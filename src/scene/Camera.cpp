@@ -41,7 +41,7 @@ bool Camera::InputKeyboard(char key)
 {
 	glm::vec3    moveVector;
 	const double MOVE_SPEED   = 20.0;
-	float        moveModifier = (TimeManager::DeltaTime * MOVE_SPEED);
+	float        moveModifier = (TimeManager::FixedDeltaTime * MOVE_SPEED);
 	glm::vec3    moveAmount   = { moveModifier, moveModifier, moveModifier };
 	bool         result       = false;
 
@@ -79,7 +79,7 @@ void Camera::InputMouseMove(const wxMouseEvent &event, const MouseState &mouseSt
 	glm::vec3    moveVector;
 	const double MOVE_SPEED    = 3.0;
 	glm::vec2    mouseMovement = { (event.GetX() - mouseState.Position.x), (event.GetY() - mouseState.Position.y) };
-	glm::vec2    moveModifier  = { (mouseMovement.x * TimeManager::DeltaTime * MOVE_SPEED), (mouseMovement.y * TimeManager::DeltaTime * MOVE_SPEED) };
+	glm::vec2    moveModifier  = { (mouseMovement.x * TimeManager::FixedDeltaTime * MOVE_SPEED), (mouseMovement.y * TimeManager::FixedDeltaTime * MOVE_SPEED) };
 	glm::vec3    moveAmountX   = { -moveModifier.x, -moveModifier.x, -moveModifier.x };
 	glm::vec3    moveAmountY   = { -moveModifier.y, -moveModifier.y, -moveModifier.y };
 
@@ -104,7 +104,7 @@ void Camera::InputMouseScroll(const wxMouseEvent &event)
 {
 	glm::vec3    moveVector;
 	const double MOVE_SPEED   = 20.0;
-	float        moveModifier = ((std::signbit((float)event.GetWheelRotation()) ? -1.0 : 1.0) * TimeManager::DeltaTime * MOVE_SPEED);
+	float        moveModifier = ((std::signbit((float)event.GetWheelRotation()) ? -1.0 : 1.0) * TimeManager::FixedDeltaTime * MOVE_SPEED);
 	glm::vec3    moveAmount   = { moveModifier, moveModifier, moveModifier };
 
     // UP / DOWN (Y)
@@ -7,6 +7,10 @@ Component::Component(const wxString &name, const glm::vec3 &position)
 	this->AutoRotate        = false;
 	this->AutoRotation      = {};
 	this->isValid           = false;
+	this->lastPosition      = position;
+	this->lastRotation      = {};
+	this->lastScale         = { 1.0f, 1.0f, 1.0f };
+	this->lastStep          = 0;
 	//this->LockToParentPosition = false;
 	//this->LockToParentRotation = false;
 	//this->LockToParentScale    = false;
@@ -19,10 +23,15 @@ Component::Component(const wxString &name, const glm::vec3 &position)
 	this->scale             = { 1.0f, 1.0f, 1.0f };
 	this->type              = COMPONENT_UNKNOWN;
 
-	for (uint32_t i = 0; i < MAX_TEXTURES; i++)
-		this->Textures[i] = nullptr;
+	for (uint32_t i = 0; i < MAX_TEXTURES; i++) {
+		this->TextureFiles[i]  = "";
+		this->Textures[i]      = nullptr;
+		this->TextureScales[i] = { 1.0f, 1.0f };
+	}
 
 	this->id = Component::sid++;
+
+	MemoryTracker::Allocate(this, MEMORY_TAG_SCENE, MEMORY_CPU, sizeof(Component));
 }
 
 Component::~Component()
@@ -34,11 +43,10 @@ Component::~Component()
 
 	this->Children.clear();
 
-	for (uint32_t i = 0; i < MAX_TEXTURES; i++) {
-		if ((this->type != COMPONENT_WATER) && (this->Textures[i] != SceneManager::EmptyTexture) && (this->Textures[i] != SceneManager::EmptyCubemap)) {
-			_DELETEP(this->Textures[i]);
-		}
-	}
+	for (int i = 0; i < MAX_TEXTURES; i++)
+		this->releaseTexture(i);
+
+	MemoryTracker::Free(this);
 }
 
 int Component::GetChildIndex(Component* child)
@@ -56,6 +64,39 @@ uint32_t Component::ID()
 	return this->id;
 }
 
+// INTERPOLATES BETWEEN THE TWO LAST SIMULATION STATES IF THE COMPONENT WAS UPDATED IN THE LAST FIXED STEP
+glm::mat4 Component::InterpolatedMatrix()
+{
+	if ((this->lastStep == 0) || (this->lastStep != TimeManager::Steps))
+		return this->matrix;
+
+	float     alpha        = (float)TimeManager::Interpolation;
+	float     fullRotation = (2.0f * glm::pi<float>());
+	glm::vec3 rotation;
+
+	// TAKE THE SHORTEST PATH IF THE ROTATION WRAPPED AROUND 360 DEGREES (2PI)
+	for (int i = 0; i < 3; i++)
+	{
+		float delta = (this->rotation[i] - this->lastRotation[i]);
+
+		if (delta > glm::pi<float>())
+			delta -= fullRotation;
+		else if (delta < -glm::pi<float>())
+			delta += fullRotation;
+
+		rotation[i] = (this->lastRotation[i] + (delta * alpha));
+	}
+
+	glm::mat4 rotateMatrixX = glm::rotate(rotation[0], glm::vec3(1.0f, 0.0f, 0.0f));
+	glm::mat4 rotateMatrixY = glm::rotate(rotation[1], glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 rotateMatrixZ = glm::rotate(rotation[2], glm::vec3(0.0f, 0.0f, 1.0f));
+
+	glm::mat4 translationMatrix = glm::translate(glm::mix(this->lastPosition, this->position, alpha));
+	glm::mat4 scaleMatrix       = glm::scale(glm::mix(this->lastScale, this->scale, alpha));
+
+	return (translationMatrix * (rotateMatrixZ * rotateMatrixY * rotateMatrixX) * scaleMatrix);
+}
+
 bool Component::IsTextured(int index)
 {
 	if ((index < 0) || (index > MAX_TEXTURES))
@@ -77,6 +118,8 @@ bool Component::IsTextured(int index)
 		return ((texture->ID() > 0) && !texture->ImageFile().empty());
 	case GRAPHICS_API_VULKAN:
 		return ((texture->ImageView != nullptr) && (texture->Sampler != nullptr) && !texture->ImageFile().empty());
+	case GRAPHICS_API_NULL:
+		return ((texture->NullID > 0) && !texture->ImageFile().empty());
 	default:
 		throw;
 	}
@@ -88,8 +131,21 @@ bool Component::IsValid()
 	return this->isValid;
 }
 
-void Component::LoadTexture(Texture* texture, int index)
+// TAKES OVER THE CALLER'S REFERENCE TO A CACHED TEXTURE AND RELEASES THE ONE IT REPLACES.
+// THE CACHE SHARES ONE TEXTURE BETWEEN PATHS HOLDING THE SAME IMAGE, SO THE SLOT KEEPS THE REQUESTED PATH.
+void Component::LoadTexture(Texture* texture, int index, const wxString &imageFile)
 {
+	wxString textureFile = (texture != nullptr ? texture->ImageFile() : "");
+
+	this->TextureFiles[index] = ((!textureFile.empty() && !imageFile.empty()) ? imageFile : textureFile);
+
+	if (texture == this->Textures[index]) {
+		TextureCache::Release(texture);
+		return;
+	}
+
+	this->releaseTexture(index);
+
     this->Textures[index] = texture;
 }
 
@@ -149,6 +205,14 @@ void Component::RotateTo(const glm::vec3 &newRotationRadians)
 	this->updateRotation();
 }
 
+void Component::SaveState()
+{
+	this->lastPosition = this->position;
+	this->lastRotation = this->rotation;
+	this->lastScale    = this->scale;
+	this->lastStep     = TimeManager::Steps;
+}
+
 glm::vec3 Component::Scale()
 {
 	return this->scale;
@@ -171,6 +235,15 @@ ComponentType Component::Type()
 	return this->type;
 }
 
+// UNCACHED TEXTURES ARE OWNED BY THE SLOT, EXCEPT THE EMPTY TEXTURES AND THE WATER FRAME BUFFERS
+void Component::releaseTexture(int index)
+{
+	if (TextureCache::Release(this->Textures[index]))
+		this->Textures[index] = nullptr;
+	else if ((this->type != COMPONENT_WATER) && (this->Textures[index] != SceneManager::EmptyTexture) && (this->Textures[index] != SceneManager::EmptyCubemap))
+		_DELETEP(this->Textures[index]);
+}
+
 void Component::updateMatrix()
 {
 	this->matrix = (this->translationMatrix * this->rotationMatrix * this->scaleMatrix);
@@ -21,13 +21,19 @@ public:
 	//bool                    LockToParentScale;
 	wxString                Name;
 	Component*              Parent;
+	wxString                TextureFiles[MAX_TEXTURES];
 	Texture*                Textures[MAX_TEXTURES];
+	glm::vec2               TextureScales[MAX_TEXTURES];
 
 protected:
 	static uint32_t sid;
 
 	uint32_t      id;
 	bool          isValid;
+	glm::vec3     lastPosition;
+	glm::vec3     lastRotation;
+	glm::vec3     lastScale;
+	uint64_t      lastStep;
 	glm::mat4     matrix;
 	wxString      modelFile;
 	glm::vec3     rotation;
@@ -41,9 +47,10 @@ protected:
 public:
 	int           GetChildIndex(Component* child);
 	uint32_t      ID();
+	glm::mat4     InterpolatedMatrix();
 	bool          IsTextured(int index);
 	bool          IsValid();
-	void          LoadTexture(Texture* texture, int index);
+	void          LoadTexture(Texture* texture, int index, const wxString &imageFile = "");
 	glm::mat4     Matrix();
 	wxString      ModelFile();
 	virtual void  MoveBy(const glm::vec3 &amount);
@@ -53,12 +60,14 @@ public:
 	glm::vec3     Rotation();
 	virtual void  RotateBy(const glm::vec3 &amountRadians);
 	virtual void  RotateTo(const glm::vec3 &newRotationRadions);
+	void          SaveState();
 	glm::vec3     Scale();
 	virtual void  ScaleBy(const glm::vec3 &amount);
 	virtual void  ScaleTo(const glm::vec3 &newScale);
 	ComponentType Type();
 
 protected:
+	void         releaseTexture(int index);
 	void         updateMatrix();
 	virtual void updateRotation();
 	void         updateScale();
@@ -1,10 +1,12 @@
 #include "FrameBuffer.h"
 
-FrameBuffer::FrameBuffer(const wxSize &size, FBOType fboType, TextureType textureType)
+FrameBuffer::FrameBuffer(const wxSize &size, FBOType fboType, TextureType textureType, bool depthBuffer)
 {
-	this->size    = size;
-	this->texture = nullptr;
-	this->type    = fboType;
+	this->depthBuffer = 0;
+	this->fbo         = 0;
+	this->size        = size;
+	this->texture     = nullptr;
+	this->type        = fboType;
 
 	switch (RenderEngine::SelectedGraphicsAPI) {
 		#if defined _WINDOWS
@@ -13,16 +15,22 @@ FrameBuffer::FrameBuffer(const wxSize &size, FBOType fboType, TextureType textur
 		#endif
 		case GRAPHICS_API_OPENGL: this->createTextureGL(textureType); break;
 		case GRAPHICS_API_VULKAN: this->createTextureVK(textureType); break;
+		case GRAPHICS_API_NULL:   this->texture = new Texture(this->type, textureType, this->size); break;
 		default: throw;
 	}
+
+	// ONLY THE OPENGL COLOR TARGETS NEED THEIR OWN DEPTH BUFFER
+	if (depthBuffer && (this->type == FBO_COLOR) && (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_OPENGL))
+		this->createDepthBufferGL();
 }
 
 FrameBuffer::FrameBuffer()
 {
-	this->fbo     = 0;
-	this->size    = {};
-	this->texture = nullptr;
-	this->type    = FBO_UNKNOWN;
+	this->depthBuffer = 0;
+	this->fbo         = 0;
+	this->size        = {};
+	this->texture     = nullptr;
+	this->type        = FBO_UNKNOWN;
 }
 
 FrameBuffer::~FrameBuffer()
@@ -31,10 +39,26 @@ FrameBuffer::~FrameBuffer()
 
 	_DELETEP(this->texture);
 
+	if (this->depthBuffer > 0) {
+		glDeleteRenderbuffers(1, &this->depthBuffer);
+		this->depthBuffer = 0;
+	}
+
 	if (this->fbo > 0) {
 		glDeleteFramebuffers(1, &this->fbo);
 		this->fbo = 0;
 	}
+
+	MemoryTracker::Free(this);
+}
+
+void FrameBuffer::createDepthBufferGL()
+{
+	glCreateRenderbuffers(1, &this->depthBuffer);
+	glNamedRenderbufferStorage(this->depthBuffer, GL_DEPTH24_STENCIL8, this->size.GetWidth(), this->size.GetHeight());
+	glNamedFramebufferRenderbuffer(this->fbo, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, this->depthBuffer);
+
+	MemoryTracker::Allocate(this, MEMORY_TAG_FRAMEBUFFERS, MEMORY_GPU, ((uint64_t)this->size.GetWidth() * (uint64_t)this->size.GetHeight() * 4));
 }
 
 void FrameBuffer::createTextureDX(TextureType textureType)
@@ -130,6 +154,9 @@ void FrameBuffer::Bind(int depthLayer)
 		break;
 	case GRAPHICS_API_VULKAN:
 		break;
+	case GRAPHICS_API_NULL:
+		RenderEngine::Canvas.Null->Bind(this->type, this->texture, depthLayer);
+		break;
 	default:
 		throw;
 	}
@@ -158,6 +185,9 @@ void FrameBuffer::Unbind()
 		break;
 	case GRAPHICS_API_VULKAN:
 		break;
+	case GRAPHICS_API_NULL:
+		RenderEngine::Canvas.Null->Unbind();
+		break;
 	default:
 		throw;
 	}
@@ -8,11 +8,12 @@
 class FrameBuffer
 {
 public:
-	FrameBuffer(const wxSize &size, FBOType fboType, TextureType textureType);
+	FrameBuffer(const wxSize &size, FBOType fboType, TextureType textureType, bool depthBuffer = false);
 	FrameBuffer();
 	~FrameBuffer();
 
 private:
+	GLuint   depthBuffer;
 	Texture* texture;
 	GLuint   fbo;
 	wxSize   size;
@@ -27,6 +28,7 @@ public:
 	FBOType  Type();
 
 private:
+	void createDepthBufferGL();
 	void createTextureDX(TextureType textureType);
 	void createTextureGL(TextureType textureType);
 	void createTextureVK(TextureType textureType);
@@ -0,0 +1,344 @@
+#include "GlyphAtlas.h"
+
+int                            GlyphAtlas::MaxLayouts  = 256;
+int                            GlyphAtlas::Width       = 512;
+wxRect                         GlyphAtlas::dirty;
+std::map<wxString, GlyphPage*> GlyphAtlas::pages;
+std::vector<uint8_t>           GlyphAtlas::pixels;
+int                            GlyphAtlas::shelfHeight = 0;
+int                            GlyphAtlas::shelfX      = 0;
+int                            GlyphAtlas::shelfY      = 0;
+GlyphAtlasStats                GlyphAtlas::stats;
+Texture*                       GlyphAtlas::texture     = nullptr;
+
+// THE GLYPHS ARE DRAWN WHITE ON BLACK, SO THE RED CHANNEL IS THE COVERAGE
+void GlyphAtlas::addGlyphs(GlyphPage* page, const std::vector<wxUniChar> &characters)
+{
+	const int minHeight = 64;
+	const int padding   = 2;
+
+	std::vector<int> stripX;
+	int              stripWidth = 0;
+
+	// PACK THE NEW GLYPHS INTO SHELVES SHARED BY ALL THE FONTS - ONLY THE LAST SHELF GROWS IN HEIGHT
+	{
+		wxBitmap   bitmap(1, 1, 24);
+		wxMemoryDC mdc(bitmap);
+		wxGCDC     gcdc(mdc);
+
+		gcdc.SetFont(page->Font);
+
+		for (auto character : characters)
+		{
+			int width = std::min(gcdc.GetTextExtent(wxString(character)).GetWidth(), (GlyphAtlas::Width - padding));
+
+			if ((GlyphAtlas::shelfX > 0) && ((GlyphAtlas::shelfX + width + padding) > GlyphAtlas::Width)) {
+				GlyphAtlas::shelfX       = 0;
+				GlyphAtlas::shelfY      += (GlyphAtlas::shelfHeight + padding);
+				GlyphAtlas::shelfHeight  = 0;
+			}
+
+			Glyph glyph;
+
+			glyph.Advance = width;
+			glyph.Rect    = wxRect(GlyphAtlas::shelfX, GlyphAtlas::shelfY, width, page->LineHeight);
+
+			page->Glyphs[character.GetValue()] = glyph;
+
+			GlyphAtlas::shelfHeight  = std::max(GlyphAtlas::shelfHeight, page->LineHeight);
+			GlyphAtlas::shelfX      += (width + padding);
+
+			stripX.push_back(stripWidth);
+			stripWidth += (width + padding);
+		}
+	}
+
+	// THE PAGE ONLY GROWS (POWER OF TWO ROWS) - THE NEW ROWS ARE WHITE WITHOUT COVERAGE
+	int rows   = (GlyphAtlas::shelfY + GlyphAtlas::shelfHeight);
+	int height = std::max(minHeight, (int)(GlyphAtlas::pixels.size() / ((size_t)GlyphAtlas::Width * 4)));
+
+	while (height < rows)
+		height *= 2;
+
+	size_t size = ((size_t)GlyphAtlas::Width * (size_t)height * 4);
+
+	if (size > GlyphAtlas::pixels.size())
+	{
+		size_t first = GlyphAtlas::pixels.size();
+
+		GlyphAtlas::pixels.resize(size, 0xFF);
+
+		for (size_t i = first; i < size; i += 4)
+			GlyphAtlas::pixels[i + 3] = 0;
+	}
+
+	if ((stripWidth == 0) || (page->LineHeight == 0))
+		return;
+
+	// RASTERIZE ALL THE NEW GLYPHS IN ONE STRIP
+	wxBitmap bitmap(stripWidth, page->LineHeight, 24);
+
+	{
+		wxMemoryDC mdc(bitmap);
+		wxGCDC     gcdc(mdc);
+
+		gcdc.SetBackground(*wxBLACK_BRUSH);
+		gcdc.Clear();
+		gcdc.SetFont(page->Font);
+		gcdc.SetTextForeground(*wxWHITE);
+
+		for (size_t i = 0; i < characters.size(); i++)
+			gcdc.DrawText(wxString(characters[i]), stripX[i], 0);
+	}
+
+	wxImage image = bitmap.ConvertToImage();
+
+	if (!image.IsOk())
+		return;
+
+	const uint8_t* rgb = image.GetData();
+
+	for (size_t i = 0; i < characters.size(); i++)
+	{
+		const wxRect &rect = page->Glyphs[characters[i].GetValue()].Rect;
+
+		for (int y = 0; y < rect.GetHeight(); y++)
+		{
+			uint8_t*       row   = (GlyphAtlas::pixels.data() + ((((size_t)(rect.GetY() + y) * GlyphAtlas::Width) + rect.GetX()) * 4));
+			const uint8_t* strip = (rgb + ((((size_t)y * stripWidth) + stripX[i]) * 3));
+
+			for (int x = 0; x < rect.GetWidth(); x++)
+				row[(x * 4) + 3] = strip[x * 3];
+		}
+
+		GlyphAtlas::dirty = (GlyphAtlas::dirty.IsEmpty() ? rect : GlyphAtlas::dirty.Union(rect));
+	}
+
+	GlyphAtlas::stats.Glyphs += (int)characters.size();
+}
+
+// STRAIGHT ALPHA, SOURCE OVER DESTINATION
+void GlyphAtlas::Blend(uint8_t* pixel, const wxColour &color, uint8_t coverage)
+{
+	uint32_t alpha   = ((((uint32_t)coverage * color.Alpha()) + 127) / 255);
+	uint32_t inverse = ((((255 - alpha) * pixel[3]) + 127) / 255);
+	uint32_t result  = (alpha + inverse);
+
+	if (result == 0)
+		return;
+
+	pixel[0] = (uint8_t)((((uint32_t)color.Red()   * alpha) + (pixel[0] * inverse) + (result / 2)) / result);
+	pixel[1] = (uint8_t)((((uint32_t)color.Green() * alpha) + (pixel[1] * inverse) + (result / 2)) / result);
+	pixel[2] = (uint8_t)((((uint32_t)color.Blue()  * alpha) + (pixel[2] * inverse) + (result / 2)) / result);
+	pixel[3] = (uint8_t)result;
+}
+
+void GlyphAtlas::Close()
+{
+	for (auto &page : GlyphAtlas::pages)
+		_DELETEP(page.second);
+
+	_DELETEP(GlyphAtlas::texture);
+
+	GlyphAtlas::pages.clear();
+	GlyphAtlas::pixels.clear();
+
+	GlyphAtlas::dirty       = wxRect();
+	GlyphAtlas::shelfHeight = 0;
+	GlyphAtlas::shelfX      = 0;
+	GlyphAtlas::shelfY      = 0;
+	GlyphAtlas::stats       = {};
+}
+
+// NULL UNTIL THE FIRST GlyphAtlas::Update
+Texture* GlyphAtlas::GetTexture()
+{
+	return GlyphAtlas::texture;
+}
+
+GlyphPage* GlyphAtlas::getPage(const wxFont &font)
+{
+	wxString key  = wxString::Format("%s|%d|%d", font.GetFaceName(), font.GetPointSize(), (int)font.GetWeight());
+	auto     page = GlyphAtlas::pages.find(key);
+
+	if (page != GlyphAtlas::pages.end())
+		return page->second;
+
+	GlyphPage* newPage = new GlyphPage();
+
+	newPage->Font = font;
+
+	{
+		wxBitmap   bitmap(1, 1, 24);
+		wxMemoryDC mdc(bitmap);
+		wxGCDC     gcdc(mdc);
+
+		gcdc.SetFont(font);
+
+		newPage->LineHeight = gcdc.GetCharHeight();
+	}
+
+	GlyphAtlas::pages[key] = newPage;
+	GlyphAtlas::stats.Pages++;
+
+	// PRINTABLE ASCII UP FRONT
+	std::vector<wxUniChar> characters;
+
+	for (int character = 32; character < 127; character++)
+		characters.push_back(wxUniChar(character));
+
+	GlyphAtlas::addGlyphs(newPage, characters);
+
+	return newPage;
+}
+
+// THE LAYOUT IS OWNED BY THE ATLAS AND ONLY VALID UNTIL THE NEXT CALL
+const TextLayout* GlyphAtlas::Layout(const wxFont &font, const wxString &text)
+{
+	GlyphPage* page   = GlyphAtlas::getPage(font);
+	auto       cached = page->Layouts.find(text);
+
+	if (cached != page->Layouts.end()) {
+		GlyphAtlas::stats.LayoutHits++;
+		return &cached->second;
+	}
+
+	GlyphAtlas::stats.LayoutMisses++;
+
+	// RASTERIZE THE GLYPHS THIS STRING USES FOR THE FIRST TIME
+	std::vector<wxUniChar> missing;
+
+	for (auto character : text)
+	{
+		if ((character < 32) || (page->Glyphs.find(character.GetValue()) != page->Glyphs.end()))
+			continue;
+
+		if (std::find(missing.begin(), missing.end(), character) == missing.end())
+			missing.push_back(character);
+	}
+
+	if (!missing.empty())
+		GlyphAtlas::addGlyphs(page, missing);
+
+	// COUNTERS PRODUCE A NEW STRING EVERY UPDATE - START OVER RATHER THAN GROW WITHOUT BOUNDS
+	if ((int)page->Layouts.size() >= GlyphAtlas::MaxLayouts)
+		page->Layouts.clear();
+
+	TextLayout &layout = page->Layouts[text];
+
+	layout.LineHeight = page->LineHeight;
+	layout.LineWidths = { 0 };
+	layout.Page       = page;
+
+	for (auto character : text)
+	{
+		if (character == '\n') {
+			layout.LineWidths.push_back(0);
+			continue;
+		}
+
+		auto glyph = page->Glyphs.find(character.GetValue());
+
+		if ((character < 32) || (glyph == page->Glyphs.end()))
+			continue;
+
+		GlyphQuad quad;
+		int       line = (int)(layout.LineWidths.size() - 1);
+
+		quad.Line   = line;
+		quad.Source = glyph->second.Rect;
+		quad.X      = layout.LineWidths[line];
+
+		layout.Quads.push_back(quad);
+		layout.LineWidths[line] += glyph->second.Advance;
+	}
+
+	layout.Size = wxSize(
+		*std::max_element(layout.LineWidths.begin(), layout.LineWidths.end()),
+		((int)layout.LineWidths.size() * layout.LineHeight)
+	);
+
+	return &layout;
+}
+
+// THE GLYPH QUADS OF THE LAYOUT ALIGNED IN THE BOX, CLIPPED TO THE BOX
+void GlyphAtlas::Place(const TextLayout* layout, const wxRect &box, int alignment, std::vector<GlyphInstance> &glyphs)
+{
+	glyphs.clear();
+
+	if (layout == nullptr)
+		return;
+
+	int top = box.GetY();
+
+	if (alignment & wxALIGN_BOTTOM)
+		top += (box.GetHeight() - layout->Size.GetHeight());
+	else if (alignment & wxALIGN_CENTER_VERTICAL)
+		top += ((box.GetHeight() - layout->Size.GetHeight()) / 2);
+
+	for (const auto &quad : layout->Quads)
+	{
+		int left      = box.GetX();
+		int lineWidth = layout->LineWidths[quad.Line];
+
+		if (alignment & wxALIGN_RIGHT)
+			left += (box.GetWidth() - lineWidth);
+		else if (alignment & wxALIGN_CENTER_HORIZONTAL)
+			left += ((box.GetWidth() - lineWidth) / 2);
+
+		wxRect target  = wxRect((left + quad.X), (top + (quad.Line * layout->LineHeight)), quad.Source.GetWidth(), quad.Source.GetHeight());
+		wxRect clipped = target.Intersect(box);
+
+		if (clipped.IsEmpty())
+			continue;
+
+		GlyphInstance glyph;
+
+		glyph.Source = wxRect(
+			(quad.Source.GetX() + (clipped.GetX() - target.GetX())), (quad.Source.GetY() + (clipped.GetY() - target.GetY())),
+			clipped.GetWidth(), clipped.GetHeight()
+		);
+
+		glyph.Target = clipped;
+
+		glyphs.push_back(glyph);
+	}
+}
+
+GlyphAtlasStats GlyphAtlas::Stats()
+{
+	return GlyphAtlas::stats;
+}
+
+// CALLED BY THE HUD BATCH BEFORE THE FRAME IS RECORDED - ONLY THE NEW GLYPHS ARE UPLOADED, A NEW TEXTURE WHEN THE PAGE GREW
+void GlyphAtlas::Update()
+{
+	int height = (int)(GlyphAtlas::pixels.size() / ((size_t)GlyphAtlas::Width * 4));
+
+	if (height == 0)
+		return;
+
+	if ((GlyphAtlas::texture != nullptr) && (GlyphAtlas::texture->Size().GetHeight() == height))
+	{
+		if (GlyphAtlas::dirty.IsEmpty() || (GlyphAtlas::texture->UpdatePixels(GlyphAtlas::pixels.data(), GlyphAtlas::dirty) == 0)) {
+			GlyphAtlas::dirty = wxRect();
+			return;
+		}
+	}
+
+	_DELETEP(GlyphAtlas::texture);
+
+	CompressedImage image;
+
+	image.Height = height;
+	image.Layers = 1;
+	image.Width  = GlyphAtlas::Width;
+
+	image.Levels.resize(1);
+	image.Levels[0].Data   = GlyphAtlas::pixels;
+	image.Levels[0].Height = image.Height;
+	image.Levels[0].Width  = image.Width;
+
+	GlyphAtlas::texture = new Texture(image);
+	GlyphAtlas::dirty   = wxRect();
+}
@@ -0,0 +1,92 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_GLYPHATLAS_H
+#define S3DE_GLYPHATLAS_H
+
+struct Glyph
+{
+	int    Advance = 0;
+	wxRect Rect;	// IN THE ATLAS PAGE
+};
+
+struct GlyphInstance
+{
+	wxRect Source;	// IN THE ATLAS PAGE
+	wxRect Target;	// IN THE TEXT BOX, TOP-DOWN
+};
+
+struct GlyphQuad
+{
+	int    Line = 0;
+	wxRect Source;	// IN THE ATLAS PAGE
+	int    X    = 0;	// FROM THE START OF THE LINE
+};
+
+struct GlyphPage;
+
+struct TextLayout
+{
+	int                    LineHeight = 0;
+	std::vector<int>       LineWidths;
+	const GlyphPage*       Page       = nullptr;
+	std::vector<GlyphQuad> Quads;
+	wxSize                 Size;
+};
+
+struct GlyphPage
+{
+	wxFont                         Font;
+	std::map<uint32_t, Glyph>      Glyphs;
+	std::map<wxString, TextLayout> Layouts;
+	int                            LineHeight = 0;
+};
+
+struct GlyphAtlasStats
+{
+	int      Glyphs       = 0;
+	uint64_t LayoutHits   = 0;
+	uint64_t LayoutMisses = 0;
+	int      Pages        = 0;
+};
+
+// GLYPHS ARE RASTERIZED ONCE PER FONT FACE AND SIZE INTO ONE SHARED ATLAS PAGE (PRINTABLE ASCII UP FRONT, THE REST ON
+// FIRST USE), AND THE GLYPH QUADS OF EACH STRING ARE LAID OUT ONCE. THE PAGE IS WHITE WITH THE COVERAGE IN THE ALPHA, THE
+// HUD BATCH DRAWS THE QUADS FROM IT AND THE SHADER APPLIES THE TEXT COLOR.
+class GlyphAtlas
+{
+private:
+	GlyphAtlas()  {}
+	~GlyphAtlas() {}
+
+public:
+	static int MaxLayouts;
+	static int Width;
+
+private:
+	static wxRect                         dirty;	// NOT YET UPLOADED
+	static std::map<wxString, GlyphPage*> pages;
+	static std::vector<uint8_t>           pixels;	// RGBA8, Width x POWER OF TWO ROWS, ROWS TOP-DOWN
+	static int                            shelfHeight;
+	static int                            shelfX;
+	static int                            shelfY;
+	static GlyphAtlasStats                stats;
+	static Texture*                       texture;
+
+public:
+	static void              Blend(uint8_t* pixel, const wxColour &color, uint8_t coverage);
+	static void              Close();
+	static Texture*          GetTexture();
+	static const TextLayout* Layout(const wxFont &font, const wxString &text);
+	static void              Place(const TextLayout* layout, const wxRect &box, int alignment, std::vector<GlyphInstance> &glyphs);
+	static GlyphAtlasStats   Stats();
+	static void              Update();
+
+private:
+	static void       addGlyphs(GlyphPage* page, const std::vector<wxUniChar> &characters);
+	static GlyphPage* getPage(const wxFont &font);
+
+};
+
+#endif
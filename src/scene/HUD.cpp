@@ -49,6 +49,31 @@ HUD::HUD()
 	this->type        = COMPONENT_HUD;
 }
 
+const std::vector<GlyphInstance>& HUD::Glyphs()
+{
+	return this->glyphs;
+}
+
+const uint8_t* HUD::Pixels()
+{
+	return (!this->pixels.empty() ? this->pixels.data() : nullptr);
+}
+
+wxSize HUD::PixelSize()
+{
+	return this->size;
+}
+
+// THE REGION CHANGED SINCE THE LAST CALL
+wxRect HUD::TakeDirtyRegion()
+{
+	wxRect region = this->dirty;
+
+	this->dirty = wxRect();
+
+	return region;
+}
+
 wxString HUD::Text()
 {
 	return this->text;
@@ -58,64 +83,103 @@ void HUD::Update(const wxString &newText)
 {
 	this->text = (!newText.empty() ? newText : this->text);
 
-	if (this->Children[0] != nullptr)
+	if (this->Children[0] == nullptr)
+		return;
+
+	Component* plane = this->Children[0];
+	glm::vec3  scale = plane->Scale();
+	wxSize     size((RenderEngine::Canvas.Size.GetWidth() * std::abs(scale[0])), (RenderEngine::Canvas.Size.GetHeight() * std::abs(scale[1])));
+	int        width  = size.GetWidth();
+	int        height = size.GetHeight();
+
+	if ((width < 1) || (height < 1))
+		return;
+
+	wxColour color     = Utils::ToWxColour(plane->ComponentMaterial.diffuse);
+	wxString imageFile = (plane->IsTextured(0) ? plane->TextureFiles[0] : "");
+
+	wxString state = wxString::Format("%dx%d|%08x|%d|%s", width, height, color.GetRGBA(), (int)this->Transparent, imageFile);
+
+	// ONLY A CHANGED BACKGROUND IS DRAWN - THE HUD BATCH DRAWS THE TEXT FROM THE GLYPH ATLAS
+	if ((state != this->state) || (this->size != size))
 	{
-		glm::vec3  scale = this->Children[0]->Scale();
-		wxFont     font(this->TextSize, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD, false, this->TextFont);
-		wxSize     size((RenderEngine::Canvas.Size.GetWidth() * std::abs(scale[0])), (RenderEngine::Canvas.Size.GetHeight() * std::abs(scale[1])));
-		wxBitmap   bitmap(size, 32); bitmap.UseAlpha(true);
-		wxMemoryDC mdc(bitmap);
-		wxGCDC     gcdc(mdc);
-
-		if (this->Transparent)
-			gcdc.SetBackground(*wxTRANSPARENT_BRUSH);
-		else
-			gcdc.SetBackground(wxBrush(Utils::ToWxColour(this->Children[0]->ComponentMaterial.diffuse)));
-
-		gcdc.Clear();
-		
-		if (this->Children[0]->IsTextured(0))
-		{
-			wxImage* textureImage = Utils::LoadImageFile(this->Children[0]->Textures[0]->ImageFile());
-			wxBitmap textureBMP   = wxBitmap(*textureImage);
+		this->updateBackground(size, imageFile, color);
 
-			if (textureImage->HasAlpha())
-				textureBMP.UseAlpha(true);
+		this->dirty = wxRect(size);
+		this->size  = size;
+		this->state = state;
+	}
 
-			gcdc.GetGraphicsContext()->DrawBitmap(textureBMP, 0.0, 0.0, size.GetWidth(), size.GetHeight());
-			textureImage->Destroy();
-		}
+	wxString    verticalAlign      = this->TextAlign.substr(0, this->TextAlign.find("-"));
+	wxString    horizontalAlign    = this->TextAlign.substr(this->TextAlign.find("-") + 1);
+	wxAlignment verticalPosition   = wxALIGN_TOP;
+	wxAlignment horizontalPosition = wxALIGN_LEFT;
+
+	if (verticalAlign == "Top")
+		verticalPosition = wxALIGN_TOP;
+	else if (verticalAlign == "Middle")
+		verticalPosition = wxALIGN_CENTER_VERTICAL;
+	else if (verticalAlign == "Bottom")
+		verticalPosition = wxALIGN_BOTTOM;
+
+	if (horizontalAlign == "Left")
+		horizontalPosition = wxALIGN_LEFT;
+	else if (horizontalAlign == "Center")
+		horizontalPosition = wxALIGN_CENTER_HORIZONTAL;
+	else if (horizontalAlign == "Right")
+		horizontalPosition = wxALIGN_RIGHT;
+
+	// THE GLYPHS AND THE LAYOUT OF THE STRING COME FROM THE SHARED ATLAS
+	wxFont font(this->TextSize, wxFONTFAMILY_DEFAULT, wxFONTSTYLE_NORMAL, wxFONTWEIGHT_BOLD, false, this->TextFont);
+
+	GlyphAtlas::Place(GlyphAtlas::Layout(font, this->text), wxRect(size), (verticalPosition | horizontalPosition), this->glyphs);
+}
+
+// THE BACKGROUND COLOR (NONE WHEN TRANSPARENT) WITH THE TEXTURE IMAGE STRETCHED OVER IT
+void HUD::updateBackground(const wxSize &size, const wxString &imageFile, const wxColour &color)
+{
+	int width  = size.GetWidth();
+	int height = size.GetHeight();
 
-		wxString    verticalAlign      = this->TextAlign.substr(0, this->TextAlign.find("-"));
-		wxString    horizontalAlign    = this->TextAlign.substr(this->TextAlign.find("-") + 1);
-		wxAlignment verticalPosition   = wxALIGN_LEFT;
-		wxAlignment horizontalPosition = wxALIGN_TOP;
-
-		if (verticalAlign == "Top")
-			verticalPosition = wxALIGN_TOP;
-		else if (verticalAlign == "Middle")
-			verticalPosition = wxALIGN_CENTER_VERTICAL;
-		else if (verticalAlign == "Bottom")
-			verticalPosition = wxALIGN_BOTTOM;
-
-		if (horizontalAlign == "Left")
-			horizontalPosition = wxALIGN_LEFT;
-		else if (horizontalAlign == "Center")
-			horizontalPosition = wxALIGN_CENTER_HORIZONTAL;
-		else if (horizontalAlign == "Right")
-			horizontalPosition = wxALIGN_RIGHT;
-
-		gcdc.SetFont(font);
-		gcdc.SetTextForeground(this->TextColor);
-		gcdc.DrawLabel(this->text, wxRect(0, 0, size.GetWidth(), size.GetHeight()), (verticalPosition | horizontalPosition));
-
-		wxImage image = bitmap.ConvertToImage();
-
-		if (image.IsOk()) {
-			Texture* texture = new Texture(&image, false, true);
-			this->Children[0]->LoadTexture(texture, 5);
+	// THE TEXTURE IMAGE IS ONLY READ FROM DISK WHEN IT OR THE SIZE CHANGES
+	if ((imageFile != this->backgroundFile) || (this->backgroundImage.IsOk() && (this->backgroundImage.GetSize() != size)))
+	{
+		this->backgroundFile = imageFile;
+		this->backgroundImage.Destroy();
+
+		wxImage* image = (!imageFile.empty() ? Utils::LoadImageFile(imageFile) : nullptr);
+
+		if (image != nullptr) {
+			this->backgroundImage = image->Scale(width, height, wxIMAGE_QUALITY_BILINEAR);
+			image->Destroy();
 		}
+	}
+
+	wxColour clearColor = (this->Transparent ? wxColour(0, 0, 0, 0) : color);
 
-		image.Destroy();
+	this->pixels.resize((size_t)width * (size_t)height * 4);
+
+	for (size_t i = 0; i < this->pixels.size(); i += 4) {
+		this->pixels[i]     = clearColor.Red();
+		this->pixels[i + 1] = clearColor.Green();
+		this->pixels[i + 2] = clearColor.Blue();
+		this->pixels[i + 3] = clearColor.Alpha();
+	}
+
+	if (!this->backgroundImage.IsOk())
+		return;
+
+	const uint8_t* rgb   = this->backgroundImage.GetData();
+	const uint8_t* alpha = (this->backgroundImage.HasAlpha() ? this->backgroundImage.GetAlpha() : nullptr);
+
+	for (int y = 0; y < height; y++)
+	{
+		uint8_t* row = (this->pixels.data() + ((size_t)(height - 1 - y) * width * 4));
+
+		for (int x = 0; x < width; x++)
+		{
+			size_t i = (((size_t)y * width) + x);
+			GlyphAtlas::Blend((row + (x * 4)), wxColour(rgb[i * 3], rgb[(i * 3) + 1], rgb[(i * 3) + 2]), (alpha != nullptr ? alpha[i] : 0xFF));
+		}
 	}
 }
@@ -13,7 +13,14 @@ public:
 	~HUD() {}
 
 private:
-	wxString text;
+	wxString                   backgroundFile;
+	wxImage                    backgroundImage;	// SCALED TO THE HUD
+	wxRect                     dirty;	// BOTTOM-UP, NOT YET COPIED TO THE HUD BATCH
+	std::vector<GlyphInstance> glyphs;	// DRAWN OVER THE BACKGROUND BY THE HUD BATCH
+	std::vector<uint8_t>       pixels;	// BACKGROUND ONLY, RGBA8, ROWS BOTTOM-UP
+	wxSize                     size;
+	wxString                   state;
+	wxString                   text;
 
 public:
 	wxString TextAlign;
@@ -23,8 +30,15 @@ public:
 	bool     Transparent;
 
 public:
-	wxString Text();
-	void     Update(const wxString &newText = "");
+	const std::vector<GlyphInstance>& Glyphs();
+	const uint8_t*                    Pixels();
+	wxSize                            PixelSize();
+	wxRect                            TakeDirtyRegion();
+	wxString                          Text();
+	void                              Update(const wxString &newText = "");
+
+private:
+	void updateBackground(const wxSize &size, const wxString &imageFile, const wxColour &color);
 
 };
 
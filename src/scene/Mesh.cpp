@@ -3,11 +3,14 @@
 Mesh::Mesh(Component* parent, const wxString &name) : Component(name)
 {
 	this->boundingVolume      = nullptr;
+	this->center              = glm::vec3(0.0f);
 	this->isSelected          = false;
 	this->maxScale            = 0.0f;
 	this->Parent              = parent;
 	this->indexBuffer         = nullptr;
 	this->normalBuffer        = nullptr;
+	this->sharedIndexBuffer   = false;
+	this->sharedVertexBuffers = false;
 	this->textureCoordsBuffer = nullptr;
 	this->type                = parent->Type();
 	this->vertexBuffer        = nullptr;
@@ -19,10 +22,13 @@ Mesh::Mesh(Component* parent, const wxString &name) : Component(name)
 Mesh::Mesh() : Component("")
 {
 	this->boundingVolume      = nullptr;
+	this->center              = glm::vec3(0.0f);
 	this->isSelected          = false;
 	this->maxScale            = 0.0f;
 	this->indexBuffer         = nullptr;
 	this->normalBuffer        = nullptr;
+	this->sharedIndexBuffer   = false;
+	this->sharedVertexBuffers = false;
 	this->textureCoordsBuffer = nullptr;
 	this->type                = COMPONENT_MESH;
 	this->vertexBuffer        = nullptr;
@@ -38,12 +44,24 @@ Mesh::~Mesh()
 	this->textureCoords.clear();
 	this->vertices.clear();
 
+	// SHARED BUFFERS ARE OWNED BY THE PRIMITIVE
+	if (this->sharedIndexBuffer)
+		this->indexBuffer = nullptr;
+
+	if (this->sharedVertexBuffers) {
+		this->normalBuffer        = nullptr;
+		this->textureCoordsBuffer = nullptr;
+		this->vertexBuffer        = nullptr;
+	}
+
 	_DELETEP(this->indexBuffer);
 	_DELETEP(this->normalBuffer);
 	_DELETEP(this->textureCoordsBuffer);
 	_DELETEP(this->vertexBuffer);
 
 	_DELETEP(this->boundingVolume);
+
+	MemoryTracker::Free(this);
 }
 
 void Mesh::BindBuffer(GLuint bufferID, GLuint shaderAttrib, GLsizei size, GLenum arrayType, GLboolean normalized, const GLvoid* offset)
@@ -54,6 +72,12 @@ void Mesh::BindBuffer(GLuint bufferID, GLuint shaderAttrib, GLsizei size, GLenum
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+// THE CENTER OF THE VERTEX BOUNDS IN MODEL SPACE
+glm::vec3 Mesh::Center()
+{
+	return this->center;
+}
+
 BoundingVolume* Mesh::GetBoundingVolume()
 {
 	return this->boundingVolume;
@@ -101,6 +125,7 @@ bool Mesh::IsOK()
 	case GRAPHICS_API_OPENGL:
 		return ((this->IBO() > 0) && (this->VBO() > 0));
 	case GRAPHICS_API_VULKAN:
+	case GRAPHICS_API_NULL:
 		return ((this->IndexBuffer() != nullptr) && (this->VertexBuffer() != nullptr));
 	default:
 		throw;
@@ -114,7 +139,7 @@ bool Mesh::IsSelected()
 	return this->isSelected;
 }
 
-bool Mesh::LoadArrays(std::vector<unsigned int> &indices, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices)
+bool Mesh::LoadArrays(std::vector<unsigned int> &indices, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices, BoundingVolumeType boundingVolume)
 {
 	this->indices       = indices;
 	this->normals       = normals;
@@ -124,7 +149,7 @@ bool Mesh::LoadArrays(std::vector<unsigned int> &indices, std::vector<float> &no
 	this->setModelData();
 	this->updateModelData();
     this->setMaxScale();
-	this->SetBoundingVolume(BOUNDING_VOLUME_BOX);
+	this->SetBoundingVolume(boundingVolume);
 
 	this->isValid = this->IsOK();
 
@@ -138,9 +163,11 @@ bool Mesh::loadModelData(aiMesh* mesh)
 		return false;
 
 	unsigned int i, j;
+	WindowFrame* window = RenderEngine::Canvas.Window;	// NO WINDOW IN THE STANDALONE BENCHMARKS
 
 	// INDICES (FACES)
-	RenderEngine::Canvas.Window->SetStatusText("Loading the Indices ...");
+	if (window != nullptr)
+		window->SetStatusText("Loading the Indices ...");
 
 	for (i = 0; i < mesh->mNumFaces; i++) {
 		for (j = 0; j < mesh->mFaces[i].mNumIndices; j++)
@@ -148,7 +175,8 @@ bool Mesh::loadModelData(aiMesh* mesh)
 	}
 
 	// NORMALS
-	RenderEngine::Canvas.Window->SetStatusText("Loading the Normals ...");
+	if (window != nullptr)
+		window->SetStatusText("Loading the Normals ...");
 
 	for (i = 0; i < mesh->mNumVertices; i++) {
 		this->normals.push_back(mesh->mNormals[i].x);
@@ -157,7 +185,8 @@ bool Mesh::loadModelData(aiMesh* mesh)
 	}
 
 	// TEXTURE COORDINATES
-	RenderEngine::Canvas.Window->SetStatusText("Loading the Texture Coordinates ...");
+	if (window != nullptr)
+		window->SetStatusText("Loading the Texture Coordinates ...");
 
 	for (i = 0; i < mesh->mNumVertices; i++) {
 		if ((mesh->mTextureCoords != nullptr) && (mesh->mTextureCoords[0] != nullptr)) {
@@ -167,7 +196,8 @@ bool Mesh::loadModelData(aiMesh* mesh)
 	}
 
 	// VERTICES (POSITION/LOCATIONS)
-	RenderEngine::Canvas.Window->SetStatusText("Loading the Vertices ...");
+	if (window != nullptr)
+		window->SetStatusText("Loading the Vertices ...");
 
 	for (i = 0; i < mesh->mNumVertices; i++) {
 		this->vertices.push_back(mesh->mVertices[i].x);
@@ -211,6 +241,29 @@ bool Mesh::LoadModelFile(aiMesh* mesh, const aiMatrix4x4 &transformMatrix)
 
 	return this->isValid;
 }
+
+bool Mesh::LoadPrimitive(PrimitiveMesh* primitive)
+{
+	if (!this->setPrimitiveData(primitive))
+		return false;
+
+	aiVector3D position = {};
+	aiVector3D rotation = { primitive->Rotation.x, primitive->Rotation.y, primitive->Rotation.z };
+	aiVector3D scale    = { 1.0f, 1.0f, 1.0f };
+
+	if (this->type == COMPONENT_WATER) {
+		scale.z = 10.0f;
+		this->ComponentMaterial.specular.shininess = 20.0f;
+	}
+
+	this->updateModelData(position, scale, rotation);
+	this->setMaxScale();
+	this->SetBoundingVolume(BOUNDING_VOLUME_BOX);
+
+	this->isValid = this->IsOK();
+
+	return this->isValid;
+}
 //
 //void Mesh::LoadTexture(Texture* texture, int index)
 //{
@@ -224,7 +277,7 @@ int Mesh::LoadTextureImage(const wxString &imageFile, int index)
 		return -1;
 	}
 
-	this->Textures[index] = new Texture(imageFile, (index == 0));
+	this->LoadTexture(TextureCache::Acquire(imageFile, (index == 0)), index, imageFile);
 
     return 0;
 }
@@ -255,6 +308,12 @@ size_t Mesh::NrOfVertices()
 	return (this->vertices.size() / 3);
 }
 
+// BOUNDING SPHERE OF THE SCALED VERTICES - IT CONTAINS THEM CENTERED ON THE MESH POSITION OR ON Center()
+float Mesh::Radius()
+{
+	return glm::length(this->maxScale * this->scale);
+}
+
 void Mesh::RemoveTexture(int index)
 {
 	this->LoadTexture(SceneManager::EmptyTexture, index);
@@ -281,10 +340,48 @@ void Mesh::SetBoundingVolume(BoundingVolumeType type)
 	}
 }
 
+// CACHED TEXTURES ARE SHARED, SO A CHANGED SAMPLER STATE GETS ITS OWN CACHED COPY
+void Mesh::SetTextureFlipY(int index, bool flipY)
+{
+	Texture* texture = this->Textures[index];
+
+	if ((texture == nullptr) || (texture->FlipY() == flipY))
+		return;
+
+	if (TextureCache::IsCached(texture))
+		this->LoadTexture(TextureCache::Acquire(this->TextureFiles[index], texture->SRGB(), texture->Repeat(), flipY, texture->Transparent()), index, this->TextureFiles[index]);
+	else
+		texture->SetFlipY(flipY);
+}
+
+void Mesh::SetTextureRepeat(int index, bool repeat)
+{
+	Texture* texture = this->Textures[index];
+
+	if ((texture == nullptr) || (texture->Repeat() == repeat))
+		return;
+
+	if (TextureCache::IsCached(texture))
+		this->LoadTexture(TextureCache::Acquire(this->TextureFiles[index], texture->SRGB(), repeat, texture->FlipY(), texture->Transparent()), index, this->TextureFiles[index]);
+	else
+		texture->SetRepeat(repeat);
+}
+
+// THE CENTER OF THE VERTEX BOUNDS IS ALWAYS INSIDE THE MAX SCALE BOX, SO Radius() COVERS THE VERTICES AROUND IT TOO
 void Mesh::setMaxScale()
 {
-	for (auto vertex : this->vertices)
-		this->maxScale = std::max(this->maxScale, std::abs(vertex));
+	glm::vec3 minimum = glm::vec3(FLT_MAX);
+	glm::vec3 maximum = glm::vec3(-FLT_MAX);
+
+	for (size_t i = 0; i < this->vertices.size(); i++)
+	{
+		this->maxScale = std::max(this->maxScale, std::abs(this->vertices[i]));
+
+		minimum[i % 3] = std::min(minimum[i % 3], this->vertices[i]);
+		maximum[i % 3] = std::max(maximum[i % 3], this->vertices[i]);
+	}
+
+	this->center = (this->vertices.size() >= 3 ? ((minimum + maximum) * 0.5f) : glm::vec3(0.0f));
 }
 
 bool Mesh::setModelData()
@@ -316,6 +413,7 @@ bool Mesh::setModelData()
 
 		break;
 	case GRAPHICS_API_VULKAN:
+	case GRAPHICS_API_NULL:
 		if (!this->indices.empty())
 			this->indexBuffer = new Buffer(this->indices);
 
@@ -327,9 +425,98 @@ bool Mesh::setModelData()
 		throw;
 	}
 
+	// THE MESH ARRAYS STAY IN CPU MEMORY - DIRECTX AND VULKAN VERTEX BUFFERS KEEP ANOTHER COPY
+	wxString asset       = ((this->Parent != nullptr) && !this->Parent->ModelFile().empty() ? this->Parent->ModelFile() : this->Name);
+	uint64_t indexBytes  = (this->indices.size() * sizeof(unsigned int));
+	uint64_t vertexBytes = ((this->normals.size() + this->textureCoords.size() + this->vertices.size()) * sizeof(float));
+
+	// RELOADED MESHES REPLACE THE SIZES TRACKED FOR THE OLD DATA
+	MemoryTracker::Free(this);
+
+	MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_CPU, (indexBytes + vertexBytes), asset);
+	MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_GPU, (indexBytes + vertexBytes), asset);
+
+	if ((RenderEngine::SelectedGraphicsAPI != GRAPHICS_API_OPENGL) && (this->vertexBuffer != nullptr))
+		MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_CPU, vertexBytes, asset);
+
 	return true;
 }
 
+// THE INDEX BUFFER IS ALWAYS SHARED, THE VERTEX BUFFERS ONLY WHERE THEY DON'T HOLD PER-MESH STATE (SEE Primitives::upload)
+bool Mesh::setPrimitiveData(PrimitiveMesh* primitive)
+{
+	if ((primitive == nullptr) || (primitive->IndexBuffer == nullptr))
+		return false;
+
+	this->indices       = primitive->Indices;
+	this->normals       = primitive->Normals;
+	this->textureCoords = primitive->TextureCoords;
+	this->vertices      = primitive->Vertices;
+
+	this->indexBuffer       = primitive->IndexBuffer;
+	this->sharedIndexBuffer = true;
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+	case GRAPHICS_API_DIRECTX12:
+	#endif
+	case GRAPHICS_API_VULKAN:
+		this->vertexBuffer = new Buffer(this->vertices, this->normals, this->textureCoords);
+		break;
+	case GRAPHICS_API_OPENGL:
+	case GRAPHICS_API_NULL:
+		this->normalBuffer        = primitive->NormalBuffer;
+		this->textureCoordsBuffer = primitive->TextureCoordsBuffer;
+		this->vertexBuffer        = primitive->VertexBuffer;
+		this->sharedVertexBuffers = true;
+		break;
+	default:
+		throw;
+	}
+
+	// THE SHARED GPU BUFFERS ARE TRACKED ONCE BY THE PRIMITIVE
+	wxString asset       = ((this->Parent != nullptr) && !this->Parent->ModelFile().empty() ? this->Parent->ModelFile() : this->Name);
+	uint64_t indexBytes  = (this->indices.size() * sizeof(unsigned int));
+	uint64_t vertexBytes = ((this->normals.size() + this->textureCoords.size() + this->vertices.size()) * sizeof(float));
+
+	MemoryTracker::Free(this);
+
+	MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_CPU, (indexBytes + vertexBytes), asset);
+
+	if (!this->sharedVertexBuffers) {
+		MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_GPU, vertexBytes, asset);
+		MemoryTracker::Allocate(this, MEMORY_TAG_MESHES, MEMORY_CPU, vertexBytes, asset);
+	}
+
+	return true;
+}
+
+// DYNAMIC MESHES UPDATE THEIR VERTEX BUFFERS IN PLACE - THE NUMBER OF VERTICES AND THE INDICES CAN'T CHANGE
+int Mesh::UpdateArrays(std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices)
+{
+	if ((this->vertexBuffer == nullptr) || (normals.size() != this->normals.size()) || (textureCoords.size() != this->textureCoords.size()) || (vertices.size() != this->vertices.size()))
+		return -1;
+
+	this->normals       = normals;
+	this->textureCoords = textureCoords;
+	this->vertices      = vertices;
+
+	if (RenderEngine::SelectedGraphicsAPI != GRAPHICS_API_OPENGL)
+		return this->vertexBuffer->Update(this->vertices, this->normals, this->textureCoords);
+
+	if ((this->normalBuffer != nullptr) && (this->normalBuffer->Update(this->normals) < 0))
+		return -2;
+
+	if ((this->textureCoordsBuffer != nullptr) && (this->textureCoordsBuffer->Update(this->textureCoords) < 0))
+		return -3;
+
+	if (this->vertexBuffer->Update(this->vertices) < 0)
+		return -4;
+
+	return 0;
+}
+
 void Mesh::UpdateBoundingVolume()
 {
 	if (this->boundingVolume != nullptr)
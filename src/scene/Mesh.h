@@ -24,11 +24,15 @@ protected:
 
 private:
 	BoundingVolume* boundingVolume;
+	glm::vec3       center;	// OF THE VERTEX BOUNDS, IN MODEL SPACE
 	bool            isSelected;
 	float           maxScale;
+	bool            sharedIndexBuffer;
+	bool            sharedVertexBuffers;
 
 public:
 	void            BindBuffer(GLuint bufferID, GLuint shaderAttrib, GLsizei size, GLenum arrayType, GLboolean normalized, const GLvoid* offset = nullptr);
+	glm::vec3       Center();
 	BoundingVolume* GetBoundingVolume();
 	Buffer*         IndexBuffer();
 	Buffer*         VertexBuffer();
@@ -38,22 +42,28 @@ public:
 	GLuint          VBO();
 	bool            IsOK();
 	bool            IsSelected();
-	bool            LoadArrays(std::vector<unsigned int> &indices, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices);
+	bool            LoadArrays(std::vector<unsigned int> &indices, std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices, BoundingVolumeType boundingVolume = BOUNDING_VOLUME_BOX);
 	bool            LoadModelFile(aiMesh* mesh, const aiMatrix4x4 &transformMatrix);
+	bool            LoadPrimitive(PrimitiveMesh* primitive);
 	//void            LoadTexture(Texture* texture, int index);
 	int             LoadTextureImage(const wxString &imageFile, int index);
 	void            MoveBy(const glm::vec3 &amount)      override;
 	void            MoveTo(const glm::vec3 &newPosition) override;
 	size_t          NrOfIndices();
 	size_t          NrOfVertices();
+	float           Radius();
 	void            RemoveTexture(int index);
 	void            Select(bool selected);
 	void            SetBoundingVolume(BoundingVolumeType type);
+	void            SetTextureFlipY(int index, bool flipY);
+	void            SetTextureRepeat(int index, bool repeat);
+	int             UpdateArrays(std::vector<float> &normals, std::vector<float> &textureCoords, std::vector<float> &vertices);
 	void            UpdateBoundingVolume();
 
 protected:
 	bool loadModelData(aiMesh* mesh);
 	bool setModelData();
+	bool setPrimitiveData(PrimitiveMesh* primitive);
 	void updateModelData();
 
 private:
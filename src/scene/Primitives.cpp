@@ -0,0 +1,390 @@
+#include "Primitives.h"
+
+std::map<IconType, PrimitiveMesh*> Primitives::meshes;
+
+PrimitiveMesh::PrimitiveMesh(const wxString &name, const glm::vec3 &rotation)
+{
+	this->Name     = name;
+	this->Rotation = rotation;
+}
+
+PrimitiveMesh::~PrimitiveMesh()
+{
+	_DELETEP(this->IndexBuffer);
+	_DELETEP(this->NormalBuffer);
+	_DELETEP(this->TextureCoordsBuffer);
+	_DELETEP(this->VertexBuffer);
+
+	MemoryTracker::Free(this);
+}
+
+void Primitives::addQuad(PrimitiveMesh* mesh, unsigned int a, unsigned int b, unsigned int c, unsigned int d)
+{
+	mesh->Indices.insert(mesh->Indices.end(), { a, b, c, a, c, d });
+}
+
+void Primitives::addVertex(PrimitiveMesh* mesh, const glm::vec3 &position, const glm::vec3 &normal, const glm::vec2 &textureCoords)
+{
+	mesh->Normals.insert(mesh->Normals.end(),             { normal.x, normal.y, normal.z });
+	mesh->TextureCoords.insert(mesh->TextureCoords.end(), { textureCoords.x, textureCoords.y });
+	mesh->Vertices.insert(mesh->Vertices.end(),           { position.x, position.y, position.z });
+}
+
+void Primitives::Close()
+{
+	for (auto &mesh : Primitives::meshes)
+		_DELETEP(mesh.second);
+
+	Primitives::meshes.clear();
+}
+
+// TIP AT +Z - EVERY SIDE TRIANGLE HAS ITS OWN TIP VERTEX SO THE SIDE NORMALS STAY SMOOTH AROUND THE CONE
+PrimitiveMesh* Primitives::Cone(int segments, float radius, float depth)
+{
+	PrimitiveMesh* mesh   = new PrimitiveMesh("Cone", { -glm::half_pi<float>(), 0.0f, 0.0f });
+	float          bottom = (depth * -0.5f);
+	float          top    = (depth *  0.5f);
+	float          step   = (glm::two_pi<float>() / (float)segments);
+
+	for (int i = 0; i <= segments; i++)
+	{
+		float     angle     = (step * (float)i);
+		float     tip       = (angle + (step * 0.5f));
+		glm::vec3 normal    = glm::normalize(glm::vec3((depth * std::cos(angle)), (depth * std::sin(angle)), radius));
+		glm::vec3 tipNormal = glm::normalize(glm::vec3((depth * std::cos(tip)),   (depth * std::sin(tip)),   radius));
+		float     u         = ((float)i / (float)segments);
+
+		Primitives::addVertex(mesh, { (radius * std::cos(angle)), (radius * std::sin(angle)), bottom }, normal,    { u, 0.0f });
+		Primitives::addVertex(mesh, { 0.0f, 0.0f, top },                                                tipNormal, { (u + (0.5f / (float)segments)), 1.0f });
+	}
+
+	for (int i = 0; i < segments; i++) {
+		unsigned int base = (unsigned int)(i * 2);
+		mesh->Indices.insert(mesh->Indices.end(), { base, (base + 2), (base + 1) });
+	}
+
+	// BASE
+	unsigned int center = (unsigned int)(mesh->Vertices.size() / 3);
+
+	Primitives::addVertex(mesh, { 0.0f, 0.0f, bottom }, { 0.0f, 0.0f, -1.0f }, { 0.5f, 0.5f });
+
+	for (int i = 0; i <= segments; i++) {
+		float angle = (step * (float)i);
+		Primitives::addVertex(mesh, { (radius * std::cos(angle)), (radius * std::sin(angle)), bottom }, { 0.0f, 0.0f, -1.0f }, { (0.5f + std::cos(angle) * 0.5f), (0.5f + std::sin(angle) * 0.5f) });
+	}
+
+	for (unsigned int i = 0; i < (unsigned int)segments; i++)
+		mesh->Indices.insert(mesh->Indices.end(), { center, (center + i + 2), (center + i + 1) });
+
+	return mesh;
+}
+
+PrimitiveMesh* Primitives::Cube(float size)
+{
+	PrimitiveMesh* mesh = new PrimitiveMesh("Cube");
+	float          half = (size * 0.5f);
+
+	// { NORMAL, U, V } - U x V = NORMAL SO EVERY FACE WINDS COUNTER-CLOCKWISE FROM THE OUTSIDE
+	const glm::vec3 faces[6][3] = {
+		{ {  1.0f, 0.0f, 0.0f }, {  0.0f, 1.0f, 0.0f }, { 0.0f,  0.0f, 1.0f } },
+		{ { -1.0f, 0.0f, 0.0f }, {  0.0f,-1.0f, 0.0f }, { 0.0f,  0.0f, 1.0f } },
+		{ {  0.0f, 1.0f, 0.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f,  0.0f, 1.0f } },
+		{ {  0.0f,-1.0f, 0.0f }, {  1.0f, 0.0f, 0.0f }, { 0.0f,  0.0f, 1.0f } },
+		{ {  0.0f, 0.0f, 1.0f }, {  1.0f, 0.0f, 0.0f }, { 0.0f,  1.0f, 0.0f } },
+		{ {  0.0f, 0.0f,-1.0f }, {  1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f } }
+	};
+
+	for (const auto &face : faces)
+	{
+		unsigned int first = (unsigned int)(mesh->Vertices.size() / 3);
+
+		Primitives::addVertex(mesh, ((face[0] - face[1] - face[2]) * half), face[0], { 0.0f, 0.0f });
+		Primitives::addVertex(mesh, ((face[0] + face[1] - face[2]) * half), face[0], { 1.0f, 0.0f });
+		Primitives::addVertex(mesh, ((face[0] + face[1] + face[2]) * half), face[0], { 1.0f, 1.0f });
+		Primitives::addVertex(mesh, ((face[0] - face[1] + face[2]) * half), face[0], { 0.0f, 1.0f });
+
+		Primitives::addQuad(mesh, first, (first + 1), (first + 2), (first + 3));
+	}
+
+	return mesh;
+}
+
+PrimitiveMesh* Primitives::Cylinder(int segments, float radius, float depth)
+{
+	PrimitiveMesh* mesh   = new PrimitiveMesh("Cylinder", { -glm::half_pi<float>(), 0.0f, 0.0f });
+	float          bottom = (depth * -0.5f);
+	float          top    = (depth *  0.5f);
+	float          step   = (glm::two_pi<float>() / (float)segments);
+
+	// SIDES - THE SEAM IS DUPLICATED SO U GOES ALL THE WAY TO 1
+	for (int i = 0; i <= segments; i++)
+	{
+		float     angle  = (step * (float)i);
+		glm::vec3 normal = { std::cos(angle), std::sin(angle), 0.0f };
+		float     u      = ((float)i / (float)segments);
+
+		Primitives::addVertex(mesh, { (radius * normal.x), (radius * normal.y), bottom }, normal, { u, 0.0f });
+		Primitives::addVertex(mesh, { (radius * normal.x), (radius * normal.y), top },    normal, { u, 1.0f });
+	}
+
+	for (int i = 0; i < segments; i++) {
+		unsigned int base = (unsigned int)(i * 2);
+		Primitives::addQuad(mesh, base, (base + 2), (base + 3), (base + 1));
+	}
+
+	// CAPS
+	for (float z : { bottom, top })
+	{
+		float        nz     = (z < 0.0f ? -1.0f : 1.0f);
+		unsigned int center = (unsigned int)(mesh->Vertices.size() / 3);
+
+		Primitives::addVertex(mesh, { 0.0f, 0.0f, z }, { 0.0f, 0.0f, nz }, { 0.5f, 0.5f });
+
+		for (int i = 0; i <= segments; i++) {
+			float angle = (step * (float)i);
+			Primitives::addVertex(mesh, { (radius * std::cos(angle)), (radius * std::sin(angle)), z }, { 0.0f, 0.0f, nz }, { (0.5f + std::cos(angle) * 0.5f), (0.5f + std::sin(angle) * 0.5f) });
+		}
+
+		for (unsigned int i = 0; i < (unsigned int)segments; i++)
+		{
+			if (nz > 0.0f)
+				mesh->Indices.insert(mesh->Indices.end(), { center, (center + i + 1), (center + i + 2) });
+			else
+				mesh->Indices.insert(mesh->Indices.end(), { center, (center + i + 2), (center + i + 1) });
+		}
+	}
+
+	return mesh;
+}
+
+// THE DEFAULT MESHES ARE BUILT AND UPLOADED ONCE PER GRAPHICS API, EVERY MESH USING THEM SHARES THE BUFFERS
+PrimitiveMesh* Primitives::Get(IconType type)
+{
+	if (Primitives::meshes.find(type) != Primitives::meshes.end())
+		return Primitives::meshes[type];
+
+	PrimitiveMesh* mesh = nullptr;
+
+	switch (type) {
+		case ID_ICON_CONE:       mesh = Primitives::Cone();      break;
+		case ID_ICON_CUBE:       mesh = Primitives::Cube();      break;
+		case ID_ICON_CYLINDER:   mesh = Primitives::Cylinder();  break;
+		case ID_ICON_ICO_SPHERE: mesh = Primitives::IcoSphere(); break;
+		case ID_ICON_PLANE:      mesh = Primitives::Plane();     break;
+		case ID_ICON_QUAD:       mesh = Primitives::Quad();      break;
+		case ID_ICON_UV_SPHERE:  mesh = Primitives::UVSphere();  break;
+		default: return nullptr;
+	}
+
+	Primitives::upload(mesh);
+	Primitives::meshes[type] = mesh;
+
+	return mesh;
+}
+
+// THE TORUS AND MONKEY HEAD ARE STILL IMPORTED FROM THEIR .blend FILES
+IconType Primitives::GetType(const wxString &modelFile)
+{
+	for (auto type : { ID_ICON_CONE, ID_ICON_CUBE, ID_ICON_CYLINDER, ID_ICON_ICO_SPHERE, ID_ICON_PLANE, ID_ICON_QUAD, ID_ICON_UV_SPHERE }) {
+		if (modelFile == Utils::RESOURCE_MODELS[type])
+			return type;
+	}
+
+	return ID_ICON_UNKNOWN;
+}
+
+// SUBDIVISIONS = 1 GIVES THE 42 VERTICES OF THE BLENDER DEFAULT ICO SPHERE
+PrimitiveMesh* Primitives::IcoSphere(int subdivisions, float radius)
+{
+	PrimitiveMesh*            mesh = new PrimitiveMesh("Icosphere");
+	const float               t    = ((1.0f + std::sqrt(5.0f)) * 0.5f);
+	std::vector<glm::vec3>    positions = {
+		{ -1.0f, t, 0.0f }, { 1.0f, t, 0.0f }, { -1.0f, -t, 0.0f }, { 1.0f, -t, 0.0f },
+		{ 0.0f, -1.0f, t }, { 0.0f, 1.0f, t }, { 0.0f, -1.0f, -t }, { 0.0f, 1.0f, -t },
+		{ t, 0.0f, -1.0f }, { t, 0.0f, 1.0f }, { -t, 0.0f, -1.0f }, { -t, 0.0f, 1.0f }
+	};
+	std::vector<unsigned int> triangles = {
+		0, 11, 5,  0, 5, 1,  0, 1, 7,  0, 7, 10,  0, 10, 11,
+		1, 5, 9,   5, 11, 4, 11, 10, 2, 10, 7, 6,  7, 1, 8,
+		3, 9, 4,   3, 4, 2,  3, 2, 6,  3, 6, 8,   3, 8, 9,
+		4, 9, 5,   2, 4, 11, 6, 2, 10, 8, 6, 7,   9, 8, 1
+	};
+
+	for (auto &position : positions)
+		position = glm::normalize(position);
+
+	// EVERY EDGE IS SPLIT ONCE - THE MIDPOINT IS SHARED BY THE TWO TRIANGLES ON EACH SIDE OF IT
+	for (int i = 0; i < subdivisions; i++)
+	{
+		std::unordered_map<uint64_t, unsigned int> midpoints;
+		std::vector<unsigned int>                  triangles2;
+
+		auto midpoint = [&positions, &midpoints](unsigned int a, unsigned int b)
+		{
+			uint64_t key = (((uint64_t)std::min(a, b) << 32) | (uint64_t)std::max(a, b));
+			auto     mid = midpoints.find(key);
+
+			if (mid != midpoints.end())
+				return mid->second;
+
+			positions.push_back(glm::normalize((positions[a] + positions[b]) * 0.5f));
+			midpoints[key] = (unsigned int)(positions.size() - 1);
+
+			return midpoints[key];
+		};
+
+		for (size_t j = 0; j < triangles.size(); j += 3)
+		{
+			unsigned int a  = triangles[j], b = triangles[j + 1], c = triangles[j + 2];
+			unsigned int ab = midpoint(a, b);
+			unsigned int bc = midpoint(b, c);
+			unsigned int ca = midpoint(c, a);
+
+			triangles2.insert(triangles2.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+		}
+
+		triangles.swap(triangles2);
+	}
+
+	for (const auto &position : positions)
+	{
+		glm::vec2 uv = {
+			(0.5f + (std::atan2(position.y, position.x) / glm::two_pi<float>())),
+			(0.5f + (std::asin(position.z) / glm::pi<float>()))
+		};
+
+		Primitives::addVertex(mesh, (position * radius), position, uv);
+	}
+
+	mesh->Indices = triangles;
+
+	return mesh;
+}
+
+std::vector<Component*> Primitives::Load(const wxString &modelFile, Component* parent)
+{
+	std::vector<Component*> children;
+	PrimitiveMesh*          primitive = Primitives::Get(Primitives::GetType(modelFile));
+
+	if (primitive == nullptr)
+		return children;
+
+	Mesh* mesh = new Mesh(parent, primitive->Name);
+
+	// KEEP THE MATERIAL OF THE COMPONENT, LIKE THE ASSIMP PATH COPIES THE IMPORTED ONE (Utils::LoadModelFile)
+	if (parent != nullptr)
+		mesh->ComponentMaterial = parent->ComponentMaterial;
+
+	if (!mesh->LoadPrimitive(primitive)) {
+		_DELETEP(mesh);
+		return children;
+	}
+
+	children.push_back(mesh);
+
+	return children;
+}
+
+PrimitiveMesh* Primitives::Plane(int subdivisions, float size)
+{
+	PrimitiveMesh* mesh  = new PrimitiveMesh("Plane", { -glm::half_pi<float>(), 0.0f, 0.0f });
+	int            verts = (subdivisions + 1);
+
+	for (int y = 0; y < verts; y++) {
+		for (int x = 0; x < verts; x++) {
+			glm::vec2 uv = { ((float)x / (float)subdivisions), ((float)y / (float)subdivisions) };
+			Primitives::addVertex(mesh, { ((uv.x - 0.5f) * size), ((uv.y - 0.5f) * size), 0.0f }, { 0.0f, 0.0f, 1.0f }, uv);
+		}
+	}
+
+	for (int y = 0; y < subdivisions; y++) {
+		for (int x = 0; x < subdivisions; x++) {
+			unsigned int first = (unsigned int)((y * verts) + x);
+			Primitives::addQuad(mesh, first, (first + 1), (first + verts + 1), (first + verts));
+		}
+	}
+
+	return mesh;
+}
+
+// THE HUD SHADER USES THE XY POSITIONS AS CLIP SPACE, SO THE QUAD IS NOT ROTATED
+PrimitiveMesh* Primitives::Quad(float size)
+{
+	PrimitiveMesh* mesh = Primitives::Plane(1, size);
+
+	mesh->Name     = "Quad";
+	mesh->Rotation = {};
+
+	return mesh;
+}
+
+void Primitives::upload(PrimitiveMesh* mesh)
+{
+	mesh->IndexBuffer = new Buffer(mesh->Indices);
+
+	// DIRECTX AND VULKAN VERTEX BUFFERS ALSO HOLD THE CONSTANT BUFFERS AND PIPELINES OF A MESH, SO ONLY THE INDICES ARE SHARED
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+	case GRAPHICS_API_DIRECTX12:
+	#endif
+	case GRAPHICS_API_VULKAN:
+		break;
+	case GRAPHICS_API_OPENGL:
+		mesh->NormalBuffer        = new Buffer(mesh->Normals);
+		mesh->TextureCoordsBuffer = new Buffer(mesh->TextureCoords);
+		mesh->VertexBuffer        = new Buffer(mesh->Vertices);
+		break;
+	case GRAPHICS_API_NULL:
+		mesh->VertexBuffer = new Buffer(mesh->Vertices, mesh->Normals, mesh->TextureCoords);
+		break;
+	default:
+		throw;
+	}
+
+	uint64_t indexBytes  = (mesh->Indices.size() * sizeof(unsigned int));
+	uint64_t vertexBytes = ((mesh->Normals.size() + mesh->TextureCoords.size() + mesh->Vertices.size()) * sizeof(float));
+	uint64_t gpuBytes    = (mesh->VertexBuffer != nullptr ? (indexBytes + vertexBytes) : indexBytes);
+
+	MemoryTracker::Allocate(mesh, MEMORY_TAG_MESHES, MEMORY_CPU, (indexBytes + vertexBytes), mesh->Name);
+	MemoryTracker::Allocate(mesh, MEMORY_TAG_MESHES, MEMORY_GPU, gpuBytes, mesh->Name);
+
+	if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_NULL)
+		MemoryTracker::Allocate(mesh, MEMORY_TAG_MESHES, MEMORY_CPU, vertexBytes, mesh->Name);
+}
+
+// POLES AT +/-Z - THE TRIANGLES TOUCHING A POLE COLLAPSE TO ONE PER SEGMENT
+PrimitiveMesh* Primitives::UVSphere(int segments, int rings, float radius)
+{
+	PrimitiveMesh* mesh = new PrimitiveMesh("Sphere");
+
+	for (int i = 0; i <= rings; i++)
+	{
+		float theta = (glm::pi<float>() * (float)i / (float)rings);
+
+		for (int j = 0; j <= segments; j++)
+		{
+			float     phi    = (glm::two_pi<float>() * (float)j / (float)segments);
+			glm::vec3 normal = { (std::sin(theta) * std::cos(phi)), (std::sin(theta) * std::sin(phi)), std::cos(theta) };
+
+			Primitives::addVertex(mesh, (normal * radius), normal, { ((float)j / (float)segments), (1.0f - ((float)i / (float)rings)) });
+		}
+	}
+
+	for (int i = 0; i < rings; i++)
+	{
+		for (int j = 0; j < segments; j++)
+		{
+			unsigned int a = (unsigned int)((i * (segments + 1)) + j);
+			unsigned int b = (a + (unsigned int)(segments + 1));
+
+			if (i > 0)
+				mesh->Indices.insert(mesh->Indices.end(), { a, b, (a + 1) });
+
+			if (i < (rings - 1))
+				mesh->Indices.insert(mesh->Indices.end(), { (a + 1), b, (b + 1) });
+		}
+	}
+
+	return mesh;
+}
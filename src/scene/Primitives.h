@@ -0,0 +1,58 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_PRIMITIVES_H
+#define S3DE_PRIMITIVES_H
+
+struct PrimitiveMesh
+{
+	PrimitiveMesh(const wxString &name, const glm::vec3 &rotation = {});
+	PrimitiveMesh() {}
+	~PrimitiveMesh();
+
+	std::vector<unsigned int> Indices;
+	std::vector<float>        Normals;
+	std::vector<float>        TextureCoords;
+	std::vector<float>        Vertices;
+
+	Buffer*   IndexBuffer         = nullptr;
+	wxString  Name                = "";
+	Buffer*   NormalBuffer        = nullptr;
+	glm::vec3 Rotation            = {};
+	Buffer*   TextureCoordsBuffer = nullptr;
+	Buffer*   VertexBuffer        = nullptr;
+};
+
+// THE MESHES ARE GENERATED Z-UP WITH THE SAME OBJECT ROTATIONS AS THE .blend FILES THEY REPLACE,
+// SO SAVED SCENES AND THE PLANE BOUNDING VOLUME (THIN IN LOCAL Z) STILL LINE UP
+class Primitives
+{
+private:
+	Primitives()  {}
+	~Primitives() {}
+
+private:
+	static std::map<IconType, PrimitiveMesh*> meshes;
+
+public:
+	static void                    Close();
+	static PrimitiveMesh*          Cone(int segments = 32, float radius = 1.0f, float depth = 2.0f);
+	static PrimitiveMesh*          Cube(float size = 2.0f);
+	static PrimitiveMesh*          Cylinder(int segments = 32, float radius = 1.0f, float depth = 2.0f);
+	static PrimitiveMesh*          Get(IconType type);
+	static IconType                GetType(const wxString &modelFile);
+	static PrimitiveMesh*          IcoSphere(int subdivisions = 1, float radius = 1.0f);
+	static std::vector<Component*> Load(const wxString &modelFile, Component* parent);
+	static PrimitiveMesh*          Plane(int subdivisions = 1, float size = 2.0f);
+	static PrimitiveMesh*          Quad(float size = 2.0f);
+	static PrimitiveMesh*          UVSphere(int segments = 32, int rings = 16, float radius = 1.0f);
+
+private:
+	static void addQuad(PrimitiveMesh* mesh, unsigned int a, unsigned int b, unsigned int c, unsigned int d);
+	static void addVertex(PrimitiveMesh* mesh, const glm::vec3 &position, const glm::vec3 &normal, const glm::vec2 &textureCoords);
+	static void upload(PrimitiveMesh* mesh);
+
+};
+
+#endif
@@ -1,14 +1,18 @@
 #include "SceneManager.h"
 
-std::vector<Component*> SceneManager::Components;
-FrameBuffer*            SceneManager::DepthMap2D        = nullptr;
-FrameBuffer*            SceneManager::DepthMapCube      = nullptr;
-Texture*                SceneManager::EmptyCubemap      = nullptr;
-Texture*                SceneManager::EmptyTexture      = nullptr;
-bool                    SceneManager::Ready             = true;
-Component*              SceneManager::SelectedChild     = nullptr;
-Component*              SceneManager::SelectedComponent = nullptr;
-glm::vec4               SceneManager::SelectColor       = { 1.0f, 0.5f, 0.0f, 1.0f };
+// OLD SCENES STORE "auto_rotation" IN RADIANS PER FRAME AT 60 FPS
+static const float LEGACY_AUTO_ROTATION_FPS = 60.0f;
+
+std::vector<LightSource*> SceneManager::ClusteredLights;
+std::vector<Component*>   SceneManager::Components;
+FrameBuffer*              SceneManager::DepthMap2D        = nullptr;
+FrameBuffer*              SceneManager::DepthMapCube      = nullptr;
+Texture*                  SceneManager::EmptyCubemap      = nullptr;
+Texture*                  SceneManager::EmptyTexture      = nullptr;
+bool                      SceneManager::Ready             = true;
+Component*                SceneManager::SelectedChild     = nullptr;
+Component*                SceneManager::SelectedComponent = nullptr;
+glm::vec4                 SceneManager::SelectColor       = { 1.0f, 0.5f, 0.0f, 1.0f };
 
 LightSource* SceneManager::LightSources[MAX_LIGHT_SOURCES] = {};
 
@@ -70,7 +74,13 @@ int SceneManager::AddLightSource(Component* component)
 		}
 	}
 
-	wxMessageBox(("WARNING: Max " + std::to_wstring(MAX_LIGHT_SOURCES) + " light sources are supported in the scene."), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+	// THE SLOTS ARE THE SHADOWED LIGHTS, MORE POINT AND SPOT LIGHTS ARE CLUSTERED WITHOUT SHADOWS (LightCluster)
+	if (lightSource->SourceType() != ID_ICON_LIGHT_DIRECTIONAL) {
+		SceneManager::ClusteredLights.push_back(lightSource);
+		return 0;
+	}
+
+	wxMessageBox(("WARNING: Max " + std::to_wstring(MAX_LIGHT_SOURCES) + " light sources with shadows are supported in the scene, including the directional lights."), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
 
 	return -2;
 }
@@ -85,6 +95,8 @@ void SceneManager::Clear()
 	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++)
 		SceneManager::LightSources[i] = nullptr;
 
+	SceneManager::ClusteredLights.clear();
+
 	RenderEngine::HUDs.clear();
 	RenderEngine::LightSources.clear();
 	RenderEngine::Renderables.clear();
@@ -160,6 +172,8 @@ Model* SceneManager::LoadModel(const wxString &file)
 
 int SceneManager::LoadScene(const wxString &file)
 {
+	PROFILE_SCOPE("SceneManager::LoadScene");
+
 	if (file.empty())
 		return -1;
 
@@ -220,7 +234,7 @@ int SceneManager::LoadScene(const wxString &file)
 			
 			break;
 		case COMPONENT_TERRAIN:
-			component       =  SceneManager::LoadTerrain(componentJSON["size"].int_value(), componentJSON["octaves"].int_value(), componentJSON["redistribution"].number_value());
+			component       =  SceneManager::LoadTerrain(componentJSON["size"].int_value(), componentJSON["octaves"].int_value(), componentJSON["redistribution"].number_value(), componentJSON["streamed"].bool_value());
 			component->Name = componentJSON["name"].string_value();
 			
 			break;
@@ -284,7 +298,11 @@ int SceneManager::LoadScene(const wxString &file)
 			child->ScaleTo(scale);
 			child->RotateTo(Utils::ToVec3(childJSON["rotation"].array_items()));
 
-			child->AutoRotation = Utils::ToVec3(childJSON["auto_rotation"].array_items());
+			if (!childJSON["auto_rotation_per_second"].is_null())
+				child->AutoRotation = Utils::ToVec3(childJSON["auto_rotation_per_second"].array_items());
+			else
+				child->AutoRotation = (Utils::ToVec3(childJSON["auto_rotation"].array_items()) * LEGACY_AUTO_ROTATION_FPS);
+
 			child->AutoRotate   = childJSON["auto_rotate"].bool_value();
 			child->ComponentMaterial.diffuse            = Utils::ToVec4(childJSON["color"].array_items());
 			child->ComponentMaterial.specular.intensity = Utils::ToVec3(childJSON["spec_intensity"].array_items());
@@ -308,7 +326,7 @@ int SceneManager::LoadScene(const wxString &file)
 
 				// TERRAIN, WATER
 				if ((type == COMPONENT_TERRAIN) || (type == COMPONENT_WATER)) {
-					texture->Scale = Utils::ToVec2(textureJSON["scale"].array_items());
+					child->TextureScales[j] = Utils::ToVec2(textureJSON["scale"].array_items());
 				// SKYBOX
 				} else if (type == COMPONENT_SKYBOX) {
 					//
@@ -325,16 +343,16 @@ int SceneManager::LoadScene(const wxString &file)
 					if (imageFile.empty())
 						continue;
 
-					texture = new Texture(
+					texture = TextureCache::Acquire(
 						imageFile,
 						textureJSON["srgb"].bool_value(),
 						textureJSON["repeat"].bool_value(),
 						textureJSON["flip"].bool_value(),
-						textureJSON["transparent"].bool_value(),
-						Utils::ToVec2(textureJSON["scale"].array_items())
+						textureJSON["transparent"].bool_value()
 					);
 
-					child->LoadTexture(texture, j);
+					child->LoadTexture(texture, j, imageFile);
+					child->TextureScales[j] = Utils::ToVec2(textureJSON["scale"].array_items());
 				}
 			}
 		}
@@ -375,7 +393,7 @@ Skybox* SceneManager::LoadSkybox()
     return skybox;
 }
 
-Terrain* SceneManager::LoadTerrain(int size, float octaves, float redistribution)
+Terrain* SceneManager::LoadTerrain(int size, float octaves, float redistribution, bool streamed)
 {
 	std::vector<wxString> imageFiles;
 
@@ -385,7 +403,7 @@ Terrain* SceneManager::LoadTerrain(int size, float octaves, float redistribution
 	imageFiles.push_back(Utils::RESOURCE_IMAGES["bTexture"]);
 	imageFiles.push_back(Utils::RESOURCE_IMAGES["blendMap"]);
 
-	Terrain* terrain = new Terrain(imageFiles, size, octaves, redistribution);
+	Terrain* terrain = new Terrain(imageFiles, size, octaves, redistribution, streamed);
 
 	if ((terrain == nullptr) || !terrain->IsValid())
 		return nullptr;
@@ -458,9 +476,23 @@ void SceneManager::removeSelectedLightSource()
 	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++) {
 		if (SceneManager::SelectedComponent == SceneManager::LightSources[i]) {
 			_DELETEP(SceneManager::LightSources[i]);
-			break;
+
+			// THE FIRST CLUSTERED LIGHT TAKES THE FREE SHADOWED SLOT
+			if (!SceneManager::ClusteredLights.empty()) {
+				SceneManager::LightSources[i] = SceneManager::ClusteredLights.front();
+				SceneManager::ClusteredLights.erase(SceneManager::ClusteredLights.begin());
+			}
+
+			return;
 		}
 	}
+
+	auto light = std::find(SceneManager::ClusteredLights.begin(), SceneManager::ClusteredLights.end(), SceneManager::SelectedComponent);
+
+	if (light != SceneManager::ClusteredLights.end()) {
+		_DELETEP(*light);
+		SceneManager::ClusteredLights.erase(light);
+	}
 }
 
 int SceneManager::SaveScene(const wxString &file)
@@ -496,12 +528,12 @@ int SceneManager::SaveScene(const wxString &file)
 					texture = child->Textures[i];
 
 				textureJSON = json11::Json::object {
-					{ "image_file",  static_cast<std::string>(texture->ImageFile()) },
+					{ "image_file",  static_cast<std::string>(child->TextureFiles[i]) },
 					{ "srgb",        texture->SRGB() },
 					{ "repeat",      texture->Repeat() },
 					{ "flip",        texture->FlipY() },
 					{ "transparent", texture->Transparent() },
-					{ "scale",       Utils::ToJsonArray(texture->Scale) }
+					{ "scale",       Utils::ToJsonArray(child->TextureScales[i]) }
 				};
 
 				texturesJSON.push_back(textureJSON);
@@ -521,17 +553,17 @@ int SceneManager::SaveScene(const wxString &file)
 			}
 
 			childJSON = json11::Json::object {
-				{ "name",            static_cast<std::string>(child->Name) },
-				{ "position",        Utils::ToJsonArray(position) },
-				{ "scale",           Utils::ToJsonArray(scale) },
-				{ "rotation",        Utils::ToJsonArray(child->Rotation()) },
-				{ "auto_rotation",   Utils::ToJsonArray(child->AutoRotation) },
-				{ "auto_rotate",     child->AutoRotate },
-				{ "color",           Utils::ToJsonArray(child->ComponentMaterial.diffuse) },
-				{ "spec_intensity",  Utils::ToJsonArray(child->ComponentMaterial.specular.intensity) },
-				{ "spec_shininess",  child->ComponentMaterial.specular.shininess },
-				{ "bounding_box",    (boundingVolume != nullptr ? boundingVolume->VolumeType() : BOUNDING_VOLUME_NONE) },
-				{ "textures",        texturesJSON }
+				{ "name",                     static_cast<std::string>(child->Name) },
+				{ "position",                 Utils::ToJsonArray(position) },
+				{ "scale",                    Utils::ToJsonArray(scale) },
+				{ "rotation",                 Utils::ToJsonArray(child->Rotation()) },
+				{ "auto_rotation_per_second", Utils::ToJsonArray(child->AutoRotation) },
+				{ "auto_rotate",              child->AutoRotate },
+				{ "color",                    Utils::ToJsonArray(child->ComponentMaterial.diffuse) },
+				{ "spec_intensity",           Utils::ToJsonArray(child->ComponentMaterial.specular.intensity) },
+				{ "spec_shininess",           child->ComponentMaterial.specular.shininess },
+				{ "bounding_box",             (boundingVolume != nullptr ? boundingVolume->VolumeType() : BOUNDING_VOLUME_NONE) },
+				{ "textures",                 texturesJSON }
 			};
                 
 			childrenJSON.push_back(childJSON);
@@ -583,6 +615,7 @@ int SceneManager::SaveScene(const wxString &file)
 				{ "size",           dynamic_cast<Terrain*>(component)->Size() },
 				{ "octaves",        dynamic_cast<Terrain*>(component)->Octaves() },
 				{ "redistribution", dynamic_cast<Terrain*>(component)->Redistribution() },
+				{ "streamed",       dynamic_cast<Terrain*>(component)->IsStreamed() },
 				{ "children",       childrenJSON }
 			};
 			break;
@@ -11,14 +11,15 @@ public:
 	static glm::vec4    SelectColor;
 	static LightSource* LightSources[];
 
-	static std::vector<Component*> Components;
-	static FrameBuffer*            DepthMap2D;
-	static FrameBuffer*            DepthMapCube;
-	static Texture*                EmptyCubemap;
-	static Texture*                EmptyTexture;
-	static bool                    Ready;
-	static Component*              SelectedChild;
-	static Component*              SelectedComponent;
+	static std::vector<LightSource*> ClusteredLights;
+	static std::vector<Component*>   Components;
+	static FrameBuffer*              DepthMap2D;
+	static FrameBuffer*              DepthMapCube;
+	static Texture*                  EmptyCubemap;
+	static Texture*                  EmptyTexture;
+	static bool                      Ready;
+	static Component*                SelectedChild;
+	static Component*                SelectedComponent;
 
 private:
 	SceneManager()  {}
@@ -34,7 +35,7 @@ public:
 	static Model*       LoadModel(const wxString &file);
 	static int          LoadScene(const wxString &file);
 	static Skybox*      LoadSkybox();
-	static Terrain*     LoadTerrain(int size = 10, float octaves = 1.0f, float redistribution = 2.0f);
+	static Terrain*     LoadTerrain(int size = 10, float octaves = 1.0f, float redistribution = 2.0f, bool streamed = false);
 	static Water*       LoadWater();
 	static int          RemoveSelectedComponent();
 	static int          RemoveSelectedChild();
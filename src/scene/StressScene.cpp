@@ -0,0 +1,261 @@
+#include "StressScene.h"
+
+json11::Json StressSceneBenchmark::ToJSON() const
+{
+	return json11::Json::object {
+		{ "frames",            this->Frames },
+		{ "frame_time_avg_ms", this->FrameTimeAvgMS },
+		{ "frame_time_p50_ms", this->FrameTimeP50MS },
+		{ "frame_time_p95_ms", this->FrameTimeP95MS },
+		{ "frame_time_p99_ms", this->FrameTimeP99MS },
+		{ "frame_time_max_ms", this->FrameTimeMaxMS },
+		{ "draw_calls_avg",    this->DrawCallsAvg },
+		{ "draw_calls_max",    (double)this->DrawCallsMax },
+		{ "triangles_avg",     this->TrianglesAvg },
+		{ "triangles_max",     (double)this->TrianglesMax }
+	};
+}
+
+json11::Json StressScene::childJSON(const glm::vec3 &position, const glm::vec3 &scale, const glm::vec3 &rotation, const glm::vec4 &color)
+{
+	return json11::Json::object {
+		{ "name",           "Mesh" },
+		{ "position",       Utils::ToJsonArray(position) },
+		{ "scale",          Utils::ToJsonArray(scale) },
+		{ "rotation",       Utils::ToJsonArray(rotation) },
+		{ "auto_rotation",  Utils::ToJsonArray(glm::vec3(0.0f, 0.0f, 0.0f)) },
+		{ "auto_rotate",    false },
+		{ "color",          Utils::ToJsonArray(color) },
+		{ "spec_intensity", Utils::ToJsonArray(glm::vec3(0.6f, 0.6f, 0.6f)) },
+		{ "spec_shininess", 20.0f },
+		{ "bounding_box",   BOUNDING_VOLUME_NONE },
+		{ "textures",       json11::Json::array() }
+	};
+}
+
+// HALF THE WIDTH OF THE SQUARE HOLDING THE MODELS - KEEPS THE DENSITY CONSTANT AS THE MODEL COUNT GROWS
+float StressScene::extent(int models)
+{
+	return std::max(10.0f, (std::sqrt((float)models) * 2.0f));
+}
+
+// PLAYS A CLOSED CATMULL-ROM SPLINE THROUGH THE SCENE - THE SAME SEED GIVES THE SAME PATH
+StressSceneBenchmark StressScene::FlyThrough(int frames, uint32_t seed)
+{
+	StressSceneBenchmark result = {};
+
+	if ((RenderEngine::CameraMain == nullptr) || (frames < 1))
+		return result;
+
+	float extent = 10.0f;
+
+	for (auto component : SceneManager::Components)
+	{
+		if (component->Type() != COMPONENT_MODEL)
+			continue;
+
+		for (auto child : component->Children)
+			extent = std::max(extent, std::max(std::abs(child->Position().x), std::abs(child->Position().z)));
+	}
+
+	const int              NR_OF_POINTS = 8;
+	std::mt19937           generator(seed);
+	std::vector<glm::vec3> points;
+
+	for (int i = 0; i < NR_OF_POINTS; i++)
+	{
+		float angle  = (((float)i / (float)NR_OF_POINTS) * glm::two_pi<float>());
+		float radius = (extent * StressScene::random(generator, 0.4f, 0.9f));
+
+		points.push_back({ (std::cos(angle) * radius), StressScene::random(generator, 3.0f, 8.0f), (std::sin(angle) * radius) });
+	}
+
+	glm::vec3           position = RenderEngine::CameraMain->Position();
+	glm::vec3           rotation = RenderEngine::CameraMain->Rotation();
+	std::vector<double> times;
+	wxStopWatch         timer;
+
+	RenderThreadLock renderLock;
+
+	RenderEngine::Canvas.Window->SetStatusText("Measuring the stress scene fly-through ...");
+
+	for (int i = 0; i < frames; i++)
+	{
+		float     time        = ((float)i / (float)frames);
+		glm::vec3 newPosition = StressScene::spline(points, time);
+		glm::vec3 forward     = glm::normalize(StressScene::spline(points, (time + (1.0f / (float)frames))) - newPosition);
+
+		RenderEngine::CameraMain->MoveTo(newPosition);
+		RenderEngine::CameraMain->RotateTo({ (std::asin(forward.y) - 0.2f), std::atan2(forward.z, forward.x), 0.0f });
+
+		timer.Start();
+
+		TerrainStreamer::Update();
+		RenderEngine::Draw();
+
+		double         frameTime = ((double)timer.TimeInMicro().ToDouble() / 1000.0);
+		RenderCounters counters  = RenderStats::LastFrame().Total();
+
+		result.DrawCallsAvg   += (double)counters.DrawCalls;
+		result.DrawCallsMax    = std::max(result.DrawCallsMax, counters.DrawCalls);
+		result.FrameTimeAvgMS += frameTime;
+		result.FrameTimeMaxMS  = std::max(result.FrameTimeMaxMS, frameTime);
+		result.TrianglesAvg   += (double)counters.Triangles;
+		result.TrianglesMax    = std::max(result.TrianglesMax, counters.Triangles);
+
+		times.push_back(frameTime);
+	}
+
+	RenderEngine::CameraMain->MoveTo(position);
+	RenderEngine::CameraMain->RotateTo(rotation);
+
+	std::sort(times.begin(), times.end());
+
+	result.Frames          = frames;
+	result.DrawCallsAvg   /= (double)frames;
+	result.FrameTimeAvgMS /= (double)frames;
+	result.FrameTimeP50MS  = times[(size_t)((times.size() - 1) * 0.50)];
+	result.FrameTimeP95MS  = times[(size_t)((times.size() - 1) * 0.95)];
+	result.FrameTimeP99MS  = times[(size_t)((times.size() - 1) * 0.99)];
+	result.TrianglesAvg   /= (double)frames;
+
+	RenderEngine::Canvas.Window->SetStatusText("Measuring the stress scene fly-through ... OK");
+
+	return result;
+}
+
+// WRITES A SCENE FILE THAT SceneManager::LoadScene CAN OPEN - THE SAME SEED GIVES THE SAME SCENE
+int StressScene::Generate(const wxString &file, int models, int lights, uint32_t seed)
+{
+	if (file.empty() || (models < 0) || (lights < 0))
+		return -1;
+
+	RenderEngine::Canvas.Window->SetStatusText("Generating the stress scene '" + file + "' ...");
+
+	const IconType MODEL_TYPES[] = {
+		ID_ICON_CUBE, ID_ICON_UV_SPHERE, ID_ICON_ICO_SPHERE, ID_ICON_CYLINDER, ID_ICON_CONE, ID_ICON_TORUS, ID_ICON_MONKEY_HEAD
+	};
+
+	const IconType LIGHT_TYPES[] = {
+		ID_ICON_LIGHT_POINT, ID_ICON_LIGHT_SPOT
+	};
+
+	std::mt19937        generator(seed);
+	float               extent = StressScene::extent(models);
+	json11::Json::array componentsJSON;
+
+	// CAMERA
+	componentsJSON.push_back(json11::Json::object {
+		{ "type",     (int)COMPONENT_CAMERA },
+		{ "name",     "Camera" },
+		{ "position", Utils::ToJsonArray(glm::vec3(0.0f, 5.0f, extent)) },
+		{ "rotation", Utils::ToJsonArray(glm::vec3(-0.2f, -(glm::pi<float>() * 0.5f), 0.0f)) },
+		{ "children", json11::Json::array() }
+	});
+
+	// SKYBOX
+	componentsJSON.push_back(json11::Json::object {
+		{ "type",     (int)COMPONENT_SKYBOX },
+		{ "name",     "Skybox" },
+		{ "children", json11::Json::array() }
+	});
+
+	// TERRAIN
+	componentsJSON.push_back(json11::Json::object {
+		{ "type",           (int)COMPONENT_TERRAIN },
+		{ "name",           "Terrain" },
+		{ "size",           ((int)(extent * 2.0f) + 1) },
+		{ "octaves",        4 },
+		{ "redistribution", 2.0f },
+		{ "streamed",       false },
+		{ "children",       json11::Json::array() }
+	});
+
+	// WATER
+	componentsJSON.push_back(json11::Json::object {
+		{ "type",          (int)COMPONENT_WATER },
+		{ "name",          "Water" },
+		{ "speed",         0.03f },
+		{ "wave_strength", 0.02f },
+		{ "children",      json11::Json::array {
+			StressScene::childJSON({ 0.0f, 0.5f, 0.0f }, { extent, 1.0f, extent }, {}, { 0.0f, 0.0f, 1.0f, 1.0f })
+		}}
+	});
+
+	// MODELS
+	for (int i = 0; i < models; i++)
+	{
+		IconType  modelType = MODEL_TYPES[generator() % (sizeof(MODEL_TYPES) / sizeof(IconType))];
+		glm::vec3 position  = { StressScene::random(generator, -extent, extent), StressScene::random(generator, 1.5f, 4.0f), StressScene::random(generator, -extent, extent) };
+		float     scale     = StressScene::random(generator, 0.25f, 1.0f);
+		glm::vec3 rotation  = { 0.0f, StressScene::random(generator, 0.0f, glm::two_pi<float>()), 0.0f };
+		glm::vec4 color     = { StressScene::random(generator, 0.2f, 1.0f), StressScene::random(generator, 0.2f, 1.0f), StressScene::random(generator, 0.2f, 1.0f), 1.0f };
+
+		componentsJSON.push_back(json11::Json::object {
+			{ "type",       (int)COMPONENT_MODEL },
+			{ "name",       static_cast<std::string>(wxString::Format("Model %d", (i + 1))) },
+			{ "model_file", static_cast<std::string>(Utils::RESOURCE_MODELS[modelType]) },
+			{ "children",   json11::Json::array { StressScene::childJSON(position, glm::vec3(scale), rotation, color) } }
+		});
+	}
+
+	// LIGHT SOURCES - ONE DIRECTIONAL SUN PLUS POINT AND SPOT LIGHTS, THE LIGHTS AFTER THE SHADOWED SLOTS ARE CLUSTERED
+	for (int i = 0; i < lights; i++)
+	{
+		IconType  lightType = (i == 0 ? ID_ICON_LIGHT_DIRECTIONAL : LIGHT_TYPES[generator() % (sizeof(LIGHT_TYPES) / sizeof(IconType))]);
+		glm::vec3 position  = { StressScene::random(generator, -extent, extent), StressScene::random(generator, 4.0f, 8.0f), StressScene::random(generator, -extent, extent) };
+		glm::vec4 color     = { StressScene::random(generator, 0.5f, 1.0f), StressScene::random(generator, 0.5f, 1.0f), StressScene::random(generator, 0.5f, 1.0f), 1.0f };
+		glm::vec3 direction = (lightType == ID_ICON_LIGHT_DIRECTIONAL ? glm::vec3(0.5f, -1.0f, -0.2f) : glm::vec3(0.0f, -1.0f, 0.0f));
+
+		componentsJSON.push_back(json11::Json::object {
+			{ "type",           (int)COMPONENT_LIGHTSOURCE },
+			{ "name",           static_cast<std::string>(wxString::Format("Light Source %d", (i + 1))) },
+			{ "source_type",    (int)lightType },
+			{ "active",         true },
+			{ "position",       Utils::ToJsonArray(position) },
+			{ "ambient",        Utils::ToJsonArray(glm::vec3(0.2f, 0.2f, 0.2f)) },
+			{ "diffuse",        Utils::ToJsonArray(color) },
+			{ "spec_intensity", Utils::ToJsonArray(glm::vec3(0.6f, 0.6f, 0.6f)) },
+			{ "spec_shininess", 20.0f },
+			{ "direction",      Utils::ToJsonArray(direction) },
+			{ "att_linear",     0.09f },
+			{ "att_quadratic",  0.032f },
+			{ "inner_angle",    glm::radians(12.5f) },
+			{ "outer_angle",    glm::radians(17.5f) },
+			{ "children",       json11::Json::array() }
+		});
+	}
+
+	json11::Json sceneDataJSON = json11::Json::object {
+		{ "components", componentsJSON }
+	};
+
+	std::string          sceneData = sceneDataJSON.dump();
+	std::vector<uint8_t> outBuffer = Utils::Compress(std::vector<uint8_t>(sceneData.c_str(), sceneData.c_str() + sceneData.size()));
+	int                  result    = Utils::SaveDataToFile(outBuffer, file, sceneData.size());
+
+	RenderEngine::Canvas.Window->SetStatusText("Generating the stress scene '" + file + "' ... OK");
+
+	return result;
+}
+
+// MAPS THE RAW GENERATOR OUTPUT - THE STANDARD DISTRIBUTIONS ARE NOT REPRODUCIBLE ACROSS LIBRARIES
+float StressScene::random(std::mt19937 &generator, float min, float max)
+{
+	return (min + ((max - min) * (float)((double)generator() / (double)std::mt19937::max())));
+}
+
+glm::vec3 StressScene::spline(const std::vector<glm::vec3> &points, float time)
+{
+	int   count   = (int)points.size();
+	float segment = (std::fmod(time, 1.0f) * (float)count);
+	int   index   = (int)segment;
+	float t       = (segment - (float)index);
+
+	const glm::vec3 &p0 = points[(index - 1 + count) % count];
+	const glm::vec3 &p1 = points[index % count];
+	const glm::vec3 &p2 = points[(index + 1) % count];
+	const glm::vec3 &p3 = points[(index + 2) % count];
+
+	return (0.5f * ((2.0f * p1) + ((p2 - p0) * t) + (((2.0f * p0) - (5.0f * p1) + (4.0f * p2) - p3) * (t * t)) + (((3.0f * p1) - p0 - (3.0f * p2) + p3) * (t * t * t))));
+}
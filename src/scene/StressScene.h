@@ -0,0 +1,42 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_STRESSSCENE_H
+#define S3DE_STRESSSCENE_H
+
+struct StressSceneBenchmark
+{
+	double   DrawCallsAvg   = 0.0;
+	uint64_t DrawCallsMax   = 0;
+	int      Frames         = 0;
+	double   FrameTimeAvgMS = 0.0;
+	double   FrameTimeMaxMS = 0.0;
+	double   FrameTimeP50MS = 0.0;
+	double   FrameTimeP95MS = 0.0;
+	double   FrameTimeP99MS = 0.0;
+	double   TrianglesAvg   = 0.0;
+	uint64_t TrianglesMax   = 0;
+
+	json11::Json ToJSON() const;
+};
+
+class StressScene
+{
+private:
+	StressScene()  {}
+	~StressScene() {}
+
+public:
+	static StressSceneBenchmark FlyThrough(int frames, uint32_t seed);
+	static int                  Generate(const wxString &file, int models, int lights, uint32_t seed);
+
+private:
+	static json11::Json childJSON(const glm::vec3 &position, const glm::vec3 &scale, const glm::vec3 &rotation, const glm::vec4 &color);
+	static float        extent(int models);
+	static float        random(std::mt19937 &generator, float min, float max);
+	static glm::vec3    spline(const std::vector<glm::vec3> &points, float time);
+
+};
+
+#endif
@@ -1,12 +1,16 @@
 #include "Terrain.h"
 
-Terrain::Terrain(const std::vector<wxString> &textureImageFiles, int size, int octaves, float redistribution) : Component("Terrain")
+Terrain::Terrain(const std::vector<wxString> &textureImageFiles, int size, int octaves, float redistribution, bool streamed) : Component("Terrain")
 {
 	this->modelFile         = modelFile;
+	this->streamed          = streamed;
 	this->textureImageFiles = textureImageFiles;
 	this->type              = COMPONENT_TERRAIN;
 
-	this->create(size, octaves, redistribution);
+	if (this->streamed)
+		this->createStreamed(size, octaves, redistribution);
+	else
+		this->create(size, octaves, redistribution);
 }
 
 Terrain::Terrain()
@@ -14,17 +18,27 @@ Terrain::Terrain()
 	this->octaves        = 0.0f;
 	this->redistribution = 0.0f;
 	this->size           = 0.0f;
+	this->streamed       = false;
 	this->type           = COMPONENT_TERRAIN;
 }
 
+Terrain::~Terrain()
+{
+	if (this->streamed)
+		TerrainStreamer::Stop(this);
+}
+
 void Terrain::create(int size, int octaves, float redistribution)
 {
+	PROFILE_SCOPE("Terrain::create");
+
 	RenderEngine::Canvas.Window->SetStatusText("Loading the Terrain ...");
 
 	this->octaves        = octaves;
 	this->redistribution = redistribution;
 	this->size           = size;
 
+	std::vector<float>        heights(size * size);
 	std::vector<unsigned int> indices;
 	std::vector<float>        normals;
 	std::vector<float>        textureCoords;
@@ -32,11 +46,19 @@ void Terrain::create(int size, int octaves, float redistribution)
 	int                       offset = (size / 2);
 	float                     vertex1, vertex2, vertex3;
 
+	// HEIGHTS - ONE JOB PER RANGE OF ROWS
+	JobSystem::ParallelFor(size, 1, [&heights, size, octaves, redistribution](size_t begin, size_t end) {
+		for (int z = (int)begin; z < (int)end; z++) {
+		for (int x = 0; x < size; x++) {
+			heights[(z * size) + x] = Noise::Height(x, z, octaves, redistribution);
+		}}
+	});
+
 	for (int z = 0; z < size; z++) {
 	for (int x = 0; x < size; x++)
 	{
 		vertex1 = (float)((float)x - (float)offset);
-		vertex2 = Noise::Height(x, z, octaves, redistribution);
+		vertex2 = heights[(z * size) + x];
 		vertex3 = (float)((float)z - (float)offset);
 
 		vertices.push_back(vertex1);
@@ -90,16 +112,41 @@ void Terrain::create(int size, int octaves, float redistribution)
 	{
 		dynamic_cast<Mesh*>(this->Children[0])->LoadArrays(indices, normals, textureCoords, vertices);
 
-		Texture* texture;
+		// A RESIZE GETS THE SAME CACHED TEXTURES BACK INSTEAD OF UPLOADING THEM AGAIN
+		for (int i = 0; i < 5; i++) {
+			this->Children[0]->LoadTexture(TextureCache::Acquire(this->textureImageFiles[i], (i < 4), true), i, this->textureImageFiles[i]);
+			this->Children[0]->TextureScales[i] = glm::vec2(size, size);
+		}
 
-		for (int i = 0; i < 5; i++)
-		{
-			texture        = new Texture(this->textureImageFiles[i], (i < 4), true);
-			texture->Scale = glm::vec2(size, size);
+		RenderEngine::Canvas.Window->SetStatusText("Loading the Terrain ... OK");
+	} else {
+		wxMessageBox("ERROR: Failed to load the Terrain.", RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+		RenderEngine::Canvas.Window->SetStatusText("Loading the Terrain ... FAIL");
+	}
+}
 
-			this->Children[0]->LoadTexture(texture, i);
-		}
+void Terrain::createStreamed(int size, int octaves, float redistribution)
+{
+	PROFILE_SCOPE("Terrain::createStreamed");
 
+	RenderEngine::Canvas.Window->SetStatusText("Loading the Terrain ...");
+
+	this->octaves        = octaves;
+	this->redistribution = redistribution;
+	this->size           = size;
+
+	// THE TEXTURES ARE SHARED BY ALL THE STREAMED TILES
+	for (int i = 0; i < 5; i++)
+	{
+		if (this->Textures[i] == nullptr)
+			this->LoadTexture(TextureCache::Acquire(this->textureImageFiles[i], (i < 4), true), i, this->textureImageFiles[i]);
+
+		this->TextureScales[i] = glm::vec2((size - 1), (size - 1));
+	}
+
+	this->isValid = (TerrainStreamer::Start(this, size, octaves, redistribution) == 0);
+
+	if (this->isValid) {
 		RenderEngine::Canvas.Window->SetStatusText("Loading the Terrain ... OK");
 	} else {
 		wxMessageBox("ERROR: Failed to load the Terrain.", RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
@@ -107,6 +154,11 @@ void Terrain::create(int size, int octaves, float redistribution)
 	}
 }
 
+bool Terrain::IsStreamed()
+{
+	return this->streamed;
+}
+
 int Terrain::Octaves()
 {
     return this->octaves;
@@ -114,7 +166,10 @@ int Terrain::Octaves()
 
 void Terrain::Resize(int size, int octaves, float redistribution)
 {
-    this->create(size, octaves, redistribution);
+	if (this->streamed)
+		this->createStreamed(size, octaves, redistribution);
+	else
+		this->create(size, octaves, redistribution);
 }
 
 float Terrain::Redistribution()
@@ -8,20 +8,23 @@
 class Terrain : public Component
 {
 public:
-	Terrain(const std::vector<wxString> &textureImageFiles, int size, int octaves, float redistribution);
+	Terrain(const std::vector<wxString> &textureImageFiles, int size, int octaves, float redistribution, bool streamed = false);
 	Terrain();
-	~Terrain() {}
+	~Terrain();
 
 private:
 	int                   octaves;
 	float                 redistribution;
 	int                   size;
+	bool                  streamed;
 	std::vector<wxString> textureImageFiles;
 
 private:
 	void create(int size, int octaves, float redistribution);
+	void createStreamed(int size, int octaves, float redistribution);
 
 public:
+	bool  IsStreamed();
 	int   Octaves();
 	void  Resize(int size, int octaves, float redistribution);
 	float Redistribution();
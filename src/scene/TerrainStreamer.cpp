@@ -0,0 +1,465 @@
+#include "TerrainStreamer.h"
+
+size_t                          TerrainStreamer::MemoryCap      = (32 * 1024 * 1024);
+int                             TerrainStreamer::Radius         = 4;
+size_t                          TerrainStreamer::UploadBudget   = (1024 * 1024);
+uint64_t                        TerrainStreamer::frame          = 0;
+std::vector<JobHandle>          TerrainStreamer::jobs;
+std::mutex                      TerrainStreamer::mutex;
+int                             TerrainStreamer::octaves        = 0;
+std::deque<uint64_t>            TerrainStreamer::pending;
+std::deque<TerrainTileData*>    TerrainStreamer::ready;
+float                           TerrainStreamer::redistribution = 0.0f;
+std::set<uint64_t>              TerrainStreamer::requested;
+bool                            TerrainStreamer::running        = false;
+TerrainStreamerStats            TerrainStreamer::stats;
+Terrain*                        TerrainStreamer::terrain        = nullptr;
+std::map<uint64_t, TerrainTile> TerrainStreamer::tiles;
+int                             TerrainStreamer::tileSize       = 0;
+
+void TerrainStreamer::deleteTile(TerrainTile &tile)
+{
+	if (tile.TileMesh == nullptr)
+		return;
+
+	RenderEngine::RemoveMesh(tile.TileMesh);
+
+	// RELEASE THE TILE'S REFERENCES TO THE SHARED TERRAIN TEXTURES
+	for (uint32_t i = 0; i < MAX_TEXTURES; i++) {
+		TextureCache::Release(tile.TileMesh->Textures[i]);
+		tile.TileMesh->Textures[i] = nullptr;
+	}
+
+	_DELETEP(tile.TileMesh);
+
+	TerrainStreamer::stats.MemoryUsage -= std::min(tile.Bytes, TerrainStreamer::stats.MemoryUsage);
+}
+
+void TerrainStreamer::evictTiles(const std::set<uint64_t> &visible)
+{
+	for (auto &tile : TerrainStreamer::tiles) {
+		if (visible.find(tile.first) != visible.end())
+			tile.second.LastUsed = TerrainStreamer::frame;
+	}
+
+	if (TerrainStreamer::stats.MemoryUsage <= TerrainStreamer::MemoryCap)
+		return;
+
+	RenderThreadLock renderLock;
+
+	// LEAST RECENTLY USED - NEVER EVICT TILES INSIDE THE CURRENT RING
+	while (TerrainStreamer::stats.MemoryUsage > TerrainStreamer::MemoryCap)
+	{
+		auto lru = TerrainStreamer::tiles.end();
+
+		for (auto it = TerrainStreamer::tiles.begin(); it != TerrainStreamer::tiles.end(); it++) {
+			if ((it->second.LastUsed < TerrainStreamer::frame) && ((lru == TerrainStreamer::tiles.end()) || (it->second.LastUsed < lru->second.LastUsed)))
+				lru = it;
+		}
+
+		if (lru == TerrainStreamer::tiles.end())
+			break;
+
+		TerrainStreamer::deleteTile(lru->second);
+		TerrainStreamer::tiles.erase(lru);
+		TerrainStreamer::stats.TilesEvicted++;
+	}
+}
+
+TerrainFlyThrough TerrainStreamer::FlyThrough(int frames, float speed)
+{
+	TerrainFlyThrough result = {};
+
+	if ((TerrainStreamer::terrain == nullptr) || (RenderEngine::CameraMain == nullptr) || (frames < 1))
+		return result;
+
+	glm::vec3           position = RenderEngine::CameraMain->Position();
+	glm::vec3           start    = { 0.0f, 2.5f, 0.0f };
+	glm::ivec2          lastTile = TerrainStreamer::getTile(start);
+	std::vector<double> times;
+	wxStopWatch         timer;
+
+	RenderThreadLock renderLock;
+
+	RenderEngine::Canvas.Window->SetStatusText("Measuring the Terrain fly-through ...");
+
+	// FIXED PATH AND STEP SIZE - INDEPENDENT OF THE FRAME RATE
+	for (int i = 0; i < frames; i++)
+	{
+		glm::vec3 newPosition = (start + glm::vec3(0.0f, 0.0f, -(speed * (float)i)));
+
+		RenderEngine::CameraMain->MoveTo(newPosition);
+
+		timer.Start();
+
+		TerrainStreamer::Update();
+		RenderEngine::Draw();
+
+		double     frameTime = ((double)timer.TimeInMicro().ToDouble() / 1000.0);
+		glm::ivec2 tile      = TerrainStreamer::getTile(newPosition);
+
+		if (tile != lastTile) {
+			result.BoundaryCrossings++;
+			result.CrossingTimeMaxMS = std::max(result.CrossingTimeMaxMS, frameTime);
+			lastTile = tile;
+		}
+
+		result.FrameTimeAvgMS += frameTime;
+		result.FrameTimeMaxMS  = std::max(result.FrameTimeMaxMS, frameTime);
+
+		times.push_back(frameTime);
+	}
+
+	RenderEngine::CameraMain->MoveTo(position);
+
+	std::sort(times.begin(), times.end());
+
+	result.Frames          = frames;
+	result.FrameTimeAvgMS /= (double)frames;
+	result.FrameTimeP50MS  = times[(size_t)((times.size() - 1) * 0.50)];
+	result.FrameTimeP99MS  = times[(size_t)((times.size() - 1) * 0.99)];
+
+	// A SPIKE IS ANY FRAME TAKING MORE THAN TWICE THE MEDIAN
+	for (auto frameTime : times) {
+		if (frameTime > (2.0 * result.FrameTimeP50MS))
+			result.Spikes++;
+	}
+
+	RenderEngine::Canvas.Window->SetStatusText("Measuring the Terrain fly-through ... OK");
+
+	return result;
+}
+
+TerrainTileData* TerrainStreamer::generateTile(uint64_t key)
+{
+	glm::ivec2 coords = TerrainStreamer::getTileCoords(key);
+
+	return TerrainStreamer::GenerateTile(coords.x, coords.y, TerrainStreamer::tileSize, TerrainStreamer::octaves, TerrainStreamer::redistribution);
+}
+
+// CPU ONLY - SAFE TO CALL FROM ANY THREAD
+TerrainTileData* TerrainStreamer::GenerateTile(int tileX, int tileZ, int size, int octaves, float redistribution)
+{
+	PROFILE_SCOPE("TerrainStreamer::generateTile");
+
+	int                border = (size + 2);
+	int                units  = (size - 1);
+	int                startX = (tileX * units);
+	int                startZ = (tileZ * units);
+	std::vector<float> heights(border * border);
+	TerrainTileData*   tile   = new TerrainTileData();
+
+	tile->Key = TerrainStreamer::getTileKey(tileX, tileZ);
+
+	// HEIGHTS - INCLUDING A ONE VERTEX BORDER SHARED WITH THE NEIGHBOURING TILES
+	for (int z = 0; z < border; z++) {
+	for (int x = 0; x < border; x++) {
+		heights[(z * border) + x] = Noise::Height((startX + x - 1), (startZ + z - 1), octaves, redistribution);
+	}}
+
+	for (int z = 0; z < size; z++) {
+	for (int x = 0; x < size; x++)
+	{
+		int       index  = (((z + 1) * border) + (x + 1));
+		glm::vec3 normal = glm::normalize(glm::vec3(
+			(heights[index - 1]      - heights[index + 1]),
+			2.0f,
+			(heights[index - border] - heights[index + border])
+		));
+
+		tile->Vertices.push_back((float)(startX + x));
+		tile->Vertices.push_back(heights[index]);
+		tile->Vertices.push_back((float)(startZ + z));
+
+		tile->Normals.push_back(normal.x);
+		tile->Normals.push_back(normal.y);
+		tile->Normals.push_back(normal.z);
+
+		tile->TextureCoords.push_back((float)x / (float)units);
+		tile->TextureCoords.push_back((float)z / (float)units);
+	}}
+
+	for (int z = 0; z < units; z++)
+	{
+		for (int x = 0; x < units; x++)
+		{
+			int topLeft    = (((z + 0) * size) + x);   // CURRENT ROW
+			int bottomLeft = (((z + 1) * size) + x);   // NEXT ROW
+
+			// TRIANGLE 1
+			tile->Indices.push_back(topLeft    + 0);	// TOP-LEFT
+			tile->Indices.push_back(bottomLeft + 0);	// BOTTOM-LEFT
+			tile->Indices.push_back(topLeft    + 1);	// TOP-RIGHT
+
+			// TRIANGLE 2
+			tile->Indices.push_back(topLeft    + 1);	// TOP-RIGHT
+			tile->Indices.push_back(bottomLeft + 0);	// BOTTOM-LEFT
+			tile->Indices.push_back(bottomLeft + 1);	// BOTTOM-RIGHT
+		}
+	}
+
+	return tile;
+}
+
+glm::ivec2 TerrainStreamer::getTile(const glm::vec3 &position)
+{
+	float units = (float)std::max(TerrainStreamer::tileSize - 1, 1);
+
+	return glm::ivec2((int)std::floor(position.x / units), (int)std::floor(position.z / units));
+}
+
+uint64_t TerrainStreamer::getTileKey(int x, int z)
+{
+	return (((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)z);
+}
+
+glm::ivec2 TerrainStreamer::getTileCoords(uint64_t key)
+{
+	return glm::ivec2((int32_t)(uint32_t)(key >> 32), (int32_t)(uint32_t)(key & 0xFFFFFFFF));
+}
+
+bool TerrainStreamer::IsStreaming(Terrain* terrain)
+{
+	return ((terrain != nullptr) && (terrain == TerrainStreamer::terrain));
+}
+
+std::set<uint64_t> TerrainStreamer::requestTiles(const glm::ivec2 &center)
+{
+	std::vector<std::pair<int, uint64_t>> missing;
+	std::set<uint64_t>                    visible;
+	int                                   radius = TerrainStreamer::Radius;
+
+	for (int z = -radius; z <= radius; z++) {
+	for (int x = -radius; x <= radius; x++)
+	{
+		int distance = ((x * x) + (z * z));
+
+		if (distance > (radius * radius))
+			continue;
+
+		uint64_t key = TerrainStreamer::getTileKey((center.x + x), (center.y + z));
+
+		visible.insert(key);
+
+		if (TerrainStreamer::tiles.find(key) == TerrainStreamer::tiles.end())
+			missing.push_back({ distance, key });
+	}}
+
+	// NEAREST TILES FIRST
+	std::sort(missing.begin(), missing.end());
+
+	int newJobs = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+		// DROP QUEUED TILES THE CAMERA HAS ALREADY LEFT BEHIND - THEIR JOBS BUILD THE NEW TILES INSTEAD
+		for (auto key : TerrainStreamer::pending)
+			TerrainStreamer::requested.erase(key);
+
+		newJobs = -(int)TerrainStreamer::pending.size();
+
+		TerrainStreamer::pending.clear();
+
+		for (const auto &tile : missing)
+		{
+			if (TerrainStreamer::requested.find(tile.second) != TerrainStreamer::requested.end())
+				continue;
+
+			TerrainStreamer::pending.push_back(tile.second);
+			TerrainStreamer::requested.insert(tile.second);
+		}
+
+		newJobs += (int)TerrainStreamer::pending.size();
+	}
+
+	// THE JOBS TAKE THE LOCK, SO THEY ARE SUBMITTED AFTER RELEASING IT
+	TerrainStreamer::jobs.erase(std::remove_if(TerrainStreamer::jobs.begin(), TerrainStreamer::jobs.end(), JobSystem::IsDone), TerrainStreamer::jobs.end());
+
+	for (int i = 0; i < newJobs; i++)
+		TerrainStreamer::jobs.push_back(JobSystem::Run(TerrainStreamer::work));
+
+	return visible;
+}
+
+int TerrainStreamer::Start(Terrain* terrain, int tileSize, int octaves, float redistribution)
+{
+	if ((terrain == nullptr) || (tileSize < 2))
+		return -1;
+
+	if ((TerrainStreamer::terrain != nullptr) && (TerrainStreamer::terrain != terrain))
+		return -2;
+
+	TerrainStreamer::Stop(terrain);
+
+	TerrainStreamer::frame          = 0;
+	TerrainStreamer::octaves        = octaves;
+	TerrainStreamer::redistribution = redistribution;
+	TerrainStreamer::running        = true;
+	TerrainStreamer::stats          = {};
+	TerrainStreamer::terrain        = terrain;
+	TerrainStreamer::tileSize       = tileSize;
+
+	return 0;
+}
+
+TerrainStreamerStats TerrainStreamer::Stats()
+{
+	std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+	TerrainStreamerStats stats = TerrainStreamer::stats;
+
+	stats.TilesPending  = (int)TerrainStreamer::pending.size();
+	stats.TilesReady    = (int)TerrainStreamer::ready.size();
+	stats.TilesResident = (int)TerrainStreamer::tiles.size();
+
+	return stats;
+}
+
+void TerrainStreamer::Stop(Terrain* terrain)
+{
+	if ((terrain == nullptr) || (terrain != TerrainStreamer::terrain))
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+		TerrainStreamer::running = false;
+	}
+
+	// THE QUEUED JOBS RETURN WITHOUT BUILDING A TILE
+	for (const auto &job : TerrainStreamer::jobs)
+		JobSystem::Wait(job);
+
+	TerrainStreamer::jobs.clear();
+
+	for (auto tile : TerrainStreamer::ready)
+		_DELETEP(tile);
+
+	TerrainStreamer::pending.clear();
+	TerrainStreamer::ready.clear();
+	TerrainStreamer::requested.clear();
+
+	for (auto &tile : TerrainStreamer::tiles)
+		TerrainStreamer::deleteTile(tile.second);
+
+	TerrainStreamer::tiles.clear();
+
+	TerrainStreamer::terrain = nullptr;
+}
+
+void TerrainStreamer::Update()
+{
+	PROFILE_SCOPE("TerrainStreamer::Update");
+
+	if ((TerrainStreamer::terrain == nullptr) || (RenderEngine::CameraMain == nullptr))
+		return;
+
+	TerrainStreamer::frame++;
+
+	std::set<uint64_t> visible = TerrainStreamer::requestTiles(TerrainStreamer::getTile(RenderEngine::CameraMain->Position()));
+
+	TerrainStreamer::uploadTiles(visible);
+	TerrainStreamer::evictTiles(visible);
+}
+
+void TerrainStreamer::uploadTiles(const std::set<uint64_t> &visible)
+{
+	{
+		std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+		if (TerrainStreamer::ready.empty())
+			return;
+	}
+
+	// CREATING THE TILE MESHES NEEDS THE GL CONTEXT
+	RenderThreadLock renderLock;
+
+	size_t uploaded = 0;
+
+	// ALWAYS UPLOAD AT LEAST ONE TILE PER FRAME, EVEN IF IT EXCEEDS THE BUDGET
+	while (true)
+	{
+		TerrainTileData* data = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+			if (TerrainStreamer::ready.empty())
+				break;
+
+			if ((uploaded > 0) && ((uploaded + TerrainStreamer::ready.front()->Bytes()) > TerrainStreamer::UploadBudget))
+				break;
+
+			data = TerrainStreamer::ready.front();
+
+			TerrainStreamer::ready.pop_front();
+			TerrainStreamer::requested.erase(data->Key);
+		}
+
+		if (visible.find(data->Key) == visible.end()) {
+			_DELETEP(data);
+			continue;
+		}
+
+		glm::ivec2 coords = TerrainStreamer::getTileCoords(data->Key);
+		Mesh*      mesh   = new Mesh(TerrainStreamer::terrain, wxString::Format("Terrain Tile (%d, %d)", coords.x, coords.y));
+
+		// SHARE THE TERRAIN TEXTURES WITH ALL THE TILES
+		for (uint32_t i = 0; i < MAX_TEXTURES; i++) {
+			mesh->LoadTexture(TextureCache::AddRef(TerrainStreamer::terrain->Textures[i]), i, TerrainStreamer::terrain->TextureFiles[i]);
+			mesh->TextureScales[i] = TerrainStreamer::terrain->TextureScales[i];
+		}
+
+		TerrainTile tile = {};
+
+		tile.Bytes    = data->Bytes();
+		tile.LastUsed = TerrainStreamer::frame;
+		tile.TileMesh = mesh;
+
+		if (!mesh->LoadArrays(data->Indices, data->Normals, data->TextureCoords, data->Vertices, BOUNDING_VOLUME_NONE)) {
+			tile.Bytes = 0;
+			TerrainStreamer::deleteTile(tile);
+			_DELETEP(data);
+			continue;
+		}
+
+		TerrainStreamer::tiles[data->Key] = tile;
+		RenderEngine::Renderables.push_back(mesh);
+
+		TerrainStreamer::stats.MemoryUsage    += tile.Bytes;
+		TerrainStreamer::stats.MemoryUsagePeak = std::max(TerrainStreamer::stats.MemoryUsagePeak, TerrainStreamer::stats.MemoryUsage);
+		TerrainStreamer::stats.TilesUploaded++;
+
+		uploaded += tile.Bytes;
+
+		_DELETEP(data);
+	}
+}
+
+// ONE JOB PER PENDING TILE (JobSystem) - EACH JOB BUILDS THE NEAREST TILE STILL PENDING WHEN IT STARTS
+void TerrainStreamer::work()
+{
+	uint64_t key;
+
+	{
+		std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+		if (!TerrainStreamer::running || TerrainStreamer::pending.empty())
+			return;
+
+		key = TerrainStreamer::pending.front();
+		TerrainStreamer::pending.pop_front();
+	}
+
+	TerrainTileData* tile = TerrainStreamer::generateTile(key);
+
+	std::lock_guard<std::mutex> lock(TerrainStreamer::mutex);
+
+	if (!TerrainStreamer::running) {
+		_DELETEP(tile);
+		return;
+	}
+
+	TerrainStreamer::ready.push_back(tile);
+	TerrainStreamer::stats.TilesGenerated++;
+}
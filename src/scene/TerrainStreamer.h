@@ -0,0 +1,101 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_TERRAINSTREAMER_H
+#define S3DE_TERRAINSTREAMER_H
+
+struct TerrainFlyThrough
+{
+	int    BoundaryCrossings = 0;
+	double CrossingTimeMaxMS = 0.0;
+	int    Frames            = 0;
+	double FrameTimeAvgMS    = 0.0;
+	double FrameTimeMaxMS    = 0.0;
+	double FrameTimeP50MS    = 0.0;
+	double FrameTimeP99MS    = 0.0;
+	int    Spikes            = 0;
+};
+
+struct TerrainStreamerStats
+{
+	size_t   MemoryUsage     = 0;
+	size_t   MemoryUsagePeak = 0;
+	uint64_t TilesEvicted    = 0;
+	uint64_t TilesGenerated  = 0;
+	int      TilesPending    = 0;
+	int      TilesReady      = 0;
+	int      TilesResident   = 0;
+	uint64_t TilesUploaded   = 0;
+};
+
+struct TerrainTile
+{
+	size_t   Bytes    = 0;
+	uint64_t LastUsed = 0;
+	Mesh*    TileMesh = nullptr;
+};
+
+struct TerrainTileData
+{
+	std::vector<unsigned int> Indices;
+	uint64_t                  Key = 0;
+	std::vector<float>        Normals;
+	std::vector<float>        TextureCoords;
+	std::vector<float>        Vertices;
+
+	size_t Bytes()
+	{
+		return ((this->Indices.size() * sizeof(unsigned int)) + ((this->Normals.size() + this->TextureCoords.size() + this->Vertices.size()) * sizeof(float)));
+	}
+};
+
+class TerrainStreamer
+{
+private:
+	TerrainStreamer()  {}
+	~TerrainStreamer() {}
+
+public:
+	static size_t MemoryCap;
+	static int    Radius;
+	static size_t UploadBudget;
+
+private:
+	static uint64_t                        frame;
+	static std::vector<JobHandle>          jobs;
+	static std::mutex                      mutex;
+	static int                             octaves;
+	static std::deque<uint64_t>            pending;
+	static std::deque<TerrainTileData*>    ready;
+	static float                           redistribution;
+	static std::set<uint64_t>              requested;
+	static bool                            running;
+	static TerrainStreamerStats            stats;
+	static Terrain*                        terrain;
+	static std::map<uint64_t, TerrainTile> tiles;
+	static int                             tileSize;
+
+public:
+	static TerrainFlyThrough    FlyThrough(int frames, float speed);
+	static TerrainTileData*     GenerateTile(int tileX, int tileZ, int size, int octaves, float redistribution);
+	static bool                 IsStreaming(Terrain* terrain);
+	static int                  Start(Terrain* terrain, int tileSize, int octaves, float redistribution);
+	static TerrainStreamerStats Stats();
+	static void                 Stop(Terrain* terrain);
+	static void                 Update();
+
+private:
+	static void               deleteTile(TerrainTile &tile);
+	static void               evictTiles(const std::set<uint64_t> &visible);
+	static TerrainTileData*   generateTile(uint64_t key);
+	static glm::ivec2         getTile(const glm::vec3 &position);
+	static uint64_t           getTileKey(int x, int z);
+	static glm::ivec2         getTileCoords(uint64_t key);
+	static std::set<uint64_t> requestTiles(const glm::ivec2 &center);
+	static void               uploadTiles(const std::set<uint64_t> &visible);
+	static void               work();
+
+};
+
+#endif
@@ -1,13 +1,12 @@
 #include "Texture.h"
 
 // 2D TEXTURE FROM IMAGE
-Texture::Texture(wxImage* image, bool repeat, bool flipY, bool transparent, const glm::vec2 &scale)
+Texture::Texture(wxImage* image, bool repeat, bool flipY, bool transparent)
 {
 	if (image != nullptr)
 	{
 		this->flipY       = flipY;
 		this->repeat      = repeat;
-		this->Scale       = scale;
 		this->srgb        = false;
 		this->type        = TEXTURE_2D;
 		this->transparent = transparent;
@@ -32,9 +31,14 @@ Texture::Texture(wxImage* image, bool repeat, bool flipY, bool transparent, cons
 		case GRAPHICS_API_VULKAN:
 			this->loadTextureImagesVK({ image });
 			break;
+		case GRAPHICS_API_NULL:
+			this->loadTextureImagesNull({ image });
+			break;
 		default:
 			throw;
 		}
+
+		this->trackMemory(MEMORY_TAG_TEXTURES);
 	}
 	else
 	{
@@ -46,8 +50,24 @@ Texture::Texture(wxImage* image, bool repeat, bool flipY, bool transparent, cons
 }
 
 // 2D TEXTURE FROM IMAGE FILE
-Texture::Texture(const wxString &imageFile, bool srgb, bool repeat, bool flipY, bool transparent, const glm::vec2 &scale)
+Texture::Texture(const wxString &imageFile, bool srgb, bool repeat, bool flipY, bool transparent)
 {
+	this->flipY       = flipY;
+	this->imageFiles  = { imageFile };
+	this->repeat      = repeat;
+	this->srgb        = srgb;
+	this->type        = TEXTURE_2D;
+	this->transparent = transparent;
+
+	if (TextureStreamer::Enabled && !imageFile.empty() && this->loadStreamed())
+		return;
+
+	// BLOCK COMPRESSED MIP CHAIN FROM THE KTX2 CACHE - THE SOURCE IMAGE IS NOT DECODED
+	if (!imageFile.empty() && this->loadCompressedCache()) {
+		this->trackMemory(MEMORY_TAG_TEXTURES);
+		return;
+	}
+
 	wxImage* image = nullptr;
 
 	if (!imageFile.empty())
@@ -55,38 +75,38 @@ Texture::Texture(const wxString &imageFile, bool srgb, bool repeat, bool flipY,
 
 	if (image != nullptr)
 	{
-		this->flipY       = flipY;
-		this->imageFiles  = { imageFile };
-		this->repeat      = repeat;
-		this->Scale       = scale;
-		this->srgb        = srgb;
-		this->type        = TEXTURE_2D;
-		this->transparent = transparent;
-
-		switch (RenderEngine::SelectedGraphicsAPI) {
-		#if defined _WINDOWS
-		case GRAPHICS_API_DIRECTX11:
-		case GRAPHICS_API_DIRECTX12:
-			this->loadTextureImagesDX({ image });
-			break;
-		#endif
-		case GRAPHICS_API_OPENGL:
-			this->glType = GL_TEXTURE_2D;
-
-			glEnable(this->glType);
-			glCreateTextures(this->glType, 1, &this->id);
-
-			if (this->id > 0)
-				this->loadTextureImageGL(image);
-
-			break;
-		case GRAPHICS_API_VULKAN:
-			this->loadTextureImagesVK({ image });
-			break;
-		default:
-			throw;
+		if (!this->loadCompressedImages({ image }))
+		{
+			switch (RenderEngine::SelectedGraphicsAPI) {
+			#if defined _WINDOWS
+			case GRAPHICS_API_DIRECTX11:
+			case GRAPHICS_API_DIRECTX12:
+				this->loadTextureImagesDX({ image });
+				break;
+			#endif
+			case GRAPHICS_API_OPENGL:
+				this->glType = GL_TEXTURE_2D;
+
+				glEnable(this->glType);
+				glCreateTextures(this->glType, 1, &this->id);
+
+				if (this->id > 0)
+					this->loadTextureImageGL(image);
+
+				break;
+			case GRAPHICS_API_VULKAN:
+				this->loadTextureImagesVK({ image });
+				break;
+			case GRAPHICS_API_NULL:
+				this->loadTextureImagesNull({ image });
+				break;
+			default:
+				throw;
+			}
 		}
 
+		this->trackMemory(MEMORY_TAG_TEXTURES);
+
 		image->Destroy();
 	}
 	else
@@ -99,61 +119,103 @@ Texture::Texture(const wxString &imageFile, bool srgb, bool repeat, bool flipY,
 }
 
 // CUBEMAP TEXTURE FROM 6 IMAGE FILES
-Texture::Texture(const std::vector<wxString> &imageFiles, bool repeat, bool flipY, bool transparent, const glm::vec2 &scale)
+Texture::Texture(const std::vector<wxString> &imageFiles, bool repeat, bool flipY, bool transparent)
 {
-	wxImage*              image;
 	std::vector<wxImage*> images;
 
 	if ((int)imageFiles.size() != MAX_TEXTURES)
 		throw;
 
-	for (int i = 0; i < MAX_TEXTURES; i++) {
-		if ((image = Utils::LoadImageFile(imageFiles[i])) != nullptr)
+	this->flipY       = flipY;
+	this->imageFiles  = imageFiles;
+	this->srgb        = true;
+	this->type        = TEXTURE_CUBEMAP;
+	this->transparent = transparent;
+
+	// BLOCK COMPRESSED FACES FROM THE KTX2 CACHE - THE SOURCE IMAGES ARE NOT DECODED
+	if (this->loadCompressedCache()) {
+		this->trackMemory(MEMORY_TAG_TEXTURES);
+		return;
+	}
+
+	// THE 6 FACES ARE DECODED IN PARALLEL
+	for (auto image : ImageDecoder::Load(imageFiles)) {
+		if (image != nullptr)
 			images.push_back(image);
 	}
 
 	if ((int)images.size() != MAX_TEXTURES)
 		throw;
 
-	this->flipY       = flipY;
-	this->imageFiles  = imageFiles;
-	this->Scale       = scale;
-	this->srgb        = true;
-	this->type        = TEXTURE_CUBEMAP;
-	this->transparent = transparent;
+	if (!this->loadCompressedImages(images))
+	{
+		switch (RenderEngine::SelectedGraphicsAPI) {
+		#if defined _WINDOWS
+		case GRAPHICS_API_DIRECTX11:
+		case GRAPHICS_API_DIRECTX12:
+			this->loadTextureImagesDX(images);
+			break;
+		#endif
+		case GRAPHICS_API_OPENGL:
+			this->glType = GL_TEXTURE_CUBE_MAP;
 
-	switch (RenderEngine::SelectedGraphicsAPI) {
-	#if defined _WINDOWS
-	case GRAPHICS_API_DIRECTX11:
-	case GRAPHICS_API_DIRECTX12:
-		this->loadTextureImagesDX(images);
-		break;
-	#endif
-	case GRAPHICS_API_OPENGL:
-		this->glType = GL_TEXTURE_CUBE_MAP;
+			glEnable(this->glType);
+			glCreateTextures(this->glType, 1, &this->id);
 
-		glEnable(this->glType);
-		glCreateTextures(this->glType, 1, &this->id);
+			if (this->id > 0) {
+				for (int i = 0; i < MAX_TEXTURES; i++)
+					this->loadTextureImageGL(images[i], true, i);
+			}
 
-		if (this->id > 0) {
-			for (int i = 0; i < MAX_TEXTURES; i++)
-				this->loadTextureImageGL(images[i], true, i);
+			break;
+		case GRAPHICS_API_VULKAN:
+			this->loadTextureImagesVK(images);
+			break;
+		case GRAPHICS_API_NULL:
+			this->loadTextureImagesNull(images);
+			break;
+		default:
+			throw;
 		}
-
-		break;
-	case GRAPHICS_API_VULKAN:
-		this->loadTextureImagesVK(images);
-		break;
-	default:
-		throw;
 	}
 
+	this->trackMemory(MEMORY_TAG_TEXTURES);
+
 	for (auto img : images) {
 		if (img != nullptr)
 			img->Destroy();
 	}
 }
 
+// 2D TEXTURE FROM RGBA8 OR BLOCK COMPRESSED LEVELS - A SINGLE RGBA8 LEVEL CAN BE UPDATED IN PLACE (UpdatePixels)
+Texture::Texture(const CompressedImage &image, bool repeat, bool transparent)
+{
+	this->flipY       = false;
+	this->repeat      = repeat;
+	this->srgb        = image.SRGB;
+	this->type        = TEXTURE_2D;
+	this->transparent = transparent;
+
+	#if defined _WINDOWS
+		this->Resource11     = nullptr;
+		this->Resource12     = nullptr;
+		this->SamplerState11 = nullptr;
+		this->SRV11          = nullptr;
+	#endif
+
+	if (this->loadCompressed(image) < 0)
+	{
+		wxMessageBox(
+			"ERROR: Failed to create a texture from image levels.",
+			RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR
+		);
+
+		return;
+	}
+
+	this->trackMemory(MEMORY_TAG_TEXTURES);
+}
+
 // FRAMEBUFFER TEXTURE (DIRECTX)
 Texture::Texture(FBOType fboType, TextureType textureType, DXGI_FORMAT format, const wxSize &size)
 {
@@ -161,7 +223,6 @@ Texture::Texture(FBOType fboType, TextureType textureType, DXGI_FORMAT format, c
 	D3D11_SAMPLER_DESC samplerDesc11 = {};
 
 	this->repeat      = true;
-	this->Scale       = { 1.0f, 1.0f };
 	this->size        = size;
 	this->srgb        = false;
 	this->type        = textureType;
@@ -243,13 +304,14 @@ Texture::Texture(FBOType fboType, TextureType textureType, DXGI_FORMAT format, c
 	default:
 		throw;
 	}
+
+	this->trackMemory(MEMORY_TAG_FRAMEBUFFERS);
 }
 
 // FRAMEBUFFER TEXTURE (VULKAN)
 Texture::Texture(FBOType fboType, TextureType textureType, VkFormat imageFormat, const wxSize &size)
 {
 	this->repeat      = true;
-	this->Scale       = { 1.0f, 1.0f };
 	this->size        = size;
 	this->srgb        = false;
 	this->type        = textureType;
@@ -294,13 +356,14 @@ Texture::Texture(FBOType fboType, TextureType textureType, VkFormat imageFormat,
 
 	if (result < 0)
 		wxMessageBox("ERROR: Failed to create a texture frame buffer.", RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+
+	this->trackMemory(MEMORY_TAG_FRAMEBUFFERS);
 }
 
 // FRAMEBUFFER TEXTURE (OPENGL)
 Texture::Texture(GLint format, TextureType textureType, const wxSize &size)
 {
 	this->repeat      = true;
-	this->Scale       = { 1.0f, 1.0f };
 	this->size        = size;
 	this->srgb        = false;
 	this->transparent = false;
@@ -333,7 +396,7 @@ Texture::Texture(GLint format, TextureType textureType, const wxSize &size)
 
 		break;
 	case GL_TEXTURE_2D_ARRAY:
-		glTexStorage3D(this->glType, 1, format, width, height, MAX_LIGHT_SOURCES);
+		glTexStorage3D(this->glType, 1, format, width, height, MAX_DEPTH_LAYERS);
 
 		glTexParameteri(this->glType, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
 		glTexParameteri(this->glType, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
@@ -361,6 +424,21 @@ Texture::Texture(GLint format, TextureType textureType, const wxSize &size)
 	glTexParameteri(this->glType, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
 	glBindTexture(this->glType, 0);
+
+	this->trackMemory(MEMORY_TAG_FRAMEBUFFERS);
+}
+
+// FRAMEBUFFER TEXTURE (NULL)
+Texture::Texture(FBOType fboType, TextureType textureType, const wxSize &size)
+{
+	this->id          = 0;
+	this->repeat      = true;
+	this->size        = size;
+	this->srgb        = false;
+	this->transparent = false;
+	this->type        = textureType;
+
+	this->NullID = RenderEngine::Canvas.Null->CreateResource(this->trackMemory(MEMORY_TAG_FRAMEBUFFERS));
 }
 
 Texture::Texture()
@@ -375,7 +453,7 @@ Texture::Texture()
 		this->samplerState11 = nullptr;
 		this->SRV11          = nullptr;
 
-		for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (int i = 0; i < MAX_DEPTH_LAYERS; i++)
 			this->DepthBuffers11[i] = nullptr;
 
 		break;
@@ -383,7 +461,7 @@ Texture::Texture()
 		this->ColorBuffer12 = nullptr;
 		this->Resource12    = nullptr;
 
-		for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (int i = 0; i < MAX_DEPTH_LAYERS; i++)
 			this->DepthBuffers12[i] = nullptr;
 
 		break;
@@ -402,11 +480,14 @@ Texture::Texture()
 		this->Sampler     = nullptr;
 		this->SamplerInfo = {};
 
-		for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++) {
+		for (uint32_t i = 0; i < MAX_DEPTH_LAYERS; i++) {
 			this->DepthViews[i]   = nullptr;
 			this->DepthBuffers[i] = nullptr;
 		}
 
+		break;
+	case GRAPHICS_API_NULL:
+		this->id = 0;
 		break;
 	default:
 		throw;
@@ -415,33 +496,41 @@ Texture::Texture()
 
 Texture::~Texture()
 {
+	// ONLY STREAMED TEXTURES TOUCH THE STREAMER, THE OTHERS CAN BE DELETED ON THE RENDER THREAD
+	if (this->streamed)
+		TextureStreamer::Unregister(this);
+
 	#if defined _WINDOWS
 		_RELEASEP(this->ColorBuffer11);
 		_RELEASEP(this->Resource11);
 		_RELEASEP(this->samplerState11);
 		_RELEASEP(this->SRV11);
 
-		for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (int i = 0; i < MAX_DEPTH_LAYERS; i++)
 			_RELEASEP(this->DepthBuffers11[i]);
 
 		_RELEASEP(this->ColorBuffer12);
 		_RELEASEP(this->Resource12);
 
-		for (int i = 0; i < MAX_LIGHT_SOURCES; i++)
+		for (int i = 0; i < MAX_DEPTH_LAYERS; i++)
 			_RELEASEP(this->DepthBuffers12[i]);
 	#endif
 
 	if (this->id > 0)
 		glDeleteTextures(1, &this->id);
 
+	if ((this->NullID > 0) && (RenderEngine::Canvas.Null != nullptr))
+		RenderEngine::Canvas.Null->DestroyResource(this->NullID);
+
 	RenderEngine::Canvas.VK->DestroyTexture(&this->Image, &this->ImageMemory, &this->ImageView, &this->Sampler);
 	RenderEngine::Canvas.VK->DestroyFramebuffer(&this->BufferVK);
 
-	for (uint32_t i = 0; i < MAX_LIGHT_SOURCES; i++) {
+	for (uint32_t i = 0; i < MAX_DEPTH_LAYERS; i++) {
 		RenderEngine::Canvas.VK->DestroyTexture(nullptr, nullptr, &this->DepthViews[i], nullptr);
 		RenderEngine::Canvas.VK->DestroyFramebuffer(&this->DepthBuffers[i]);
 	}
 
+	MemoryTracker::Free(this);
 
 	this->imageFiles.clear();
 }
@@ -463,6 +552,11 @@ D3D12_VIEWPORT Texture::BufferViewPort12()
 }
 #endif
 
+TextureCompression Texture::Compression()
+{
+	return this->compression;
+}
+
 bool Texture::FlipY()
 {
 	return this->flipY;
@@ -496,6 +590,8 @@ bool Texture::IsOK()
 		return (this->id > 0);
 	case GRAPHICS_API_VULKAN:
 		return ((this->ImageView != nullptr) && (this->Sampler != nullptr));
+	case GRAPHICS_API_NULL:
+		return (this->NullID > 0);
 	default:
 		throw;
 	}
@@ -503,28 +599,253 @@ bool Texture::IsOK()
 	return false;
 }
 
+// UPLOADS THE MIP CHAIN AS IS - BLOCK COMPRESSED (OPENGL, VULKAN) OR RGBA8 (ALL APIS)
+int Texture::loadCompressed(const CompressedImage &image)
+{
+	if (image.Levels.empty())
+		return -1;
+
+	uint32_t mipLevels = (uint32_t)image.Levels.size();
+
+	this->mipLevels = mipLevels;
+	this->size      = wxSize(image.Width, image.Height);
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+	case GRAPHICS_API_DIRECTX12:
+	{
+		if (image.Format != TEXTURE_COMPRESSION_NONE)
+			return -5;
+
+		DXGI_FORMAT           format        = (image.SRGB ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM);
+		D3D11_SAMPLER_DESC    samplerDesc11 = {};
+		std::vector<uint8_t*> subresources;
+
+		// ONE PIXEL POINTER PER SUBRESOURCE, LAYER MAJOR
+		for (int layer = 0; layer < image.Layers; layer++) {
+			for (const auto &mipLevel : image.Levels)
+				subresources.push_back(const_cast<uint8_t*>(mipLevel.Data.data()) + (layer * (mipLevel.Data.size() / image.Layers)));
+		}
+
+		this->transparent = (this->transparent && image.HasAlpha());
+		this->type        = (image.Layers > 1 ? TEXTURE_CUBEMAP : TEXTURE_2D);
+
+		if (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_DIRECTX11)
+		{
+			this->setFilteringDX11(samplerDesc11);
+
+			if (this->type == TEXTURE_CUBEMAP)
+				this->setWrappingCubemapDX11(samplerDesc11);
+			else
+				this->setWrappingDX11(samplerDesc11);
+
+			if (RenderEngine::Canvas.DX->CreateTexture11(FBO_UNKNOWN, subresources, format, samplerDesc11, this) < 0)
+				return -6;
+		}
+		else
+		{
+			this->setFilteringDX12(this->SamplerDesc12);
+
+			if (this->type == TEXTURE_CUBEMAP)
+				this->setWrappingCubemapDX12(this->SamplerDesc12);
+			else
+				this->setWrappingDX12(this->SamplerDesc12);
+
+			if (RenderEngine::Canvas.DX->CreateTexture12(FBO_UNKNOWN, subresources, format, this) < 0)
+				return -6;
+		}
+
+		break;
+	}
+	#endif
+	case GRAPHICS_API_OPENGL:
+	{
+		GLenum format = TextureCompressor::ToGLFormat(image.Format, image.SRGB);
+
+		this->glType = (image.Layers > 1 ? GL_TEXTURE_CUBE_MAP : GL_TEXTURE_2D);
+
+		glEnable(this->glType);
+		glCreateTextures(this->glType, 1, &this->id);
+
+		if (this->id == 0)
+			return -2;
+
+		glBindTexture(this->glType, this->id);
+
+		glTexParameteri(this->glType, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(this->glType, GL_TEXTURE_MAX_LEVEL,  (mipLevels - 1));
+
+		glTexStorage2D(this->glType, mipLevels, format, image.Width, image.Height);
+
+		for (uint32_t level = 0; level < mipLevels; level++)
+		{
+			const CompressedLevel &mipLevel  = image.Levels[level];
+			GLsizei                layerSize = (GLsizei)(mipLevel.Data.size() / image.Layers);
+
+			for (int layer = 0; layer < image.Layers; layer++)
+			{
+				GLenum target = (image.Layers > 1 ? (GL_TEXTURE_CUBE_MAP_POSITIVE_X + layer) : this->glType);
+
+				if (image.Format == TEXTURE_COMPRESSION_NONE)
+				{
+					glTexSubImage2D(
+						target, level, 0, 0, mipLevel.Width, mipLevel.Height,
+						GL_RGBA, GL_UNSIGNED_BYTE, (mipLevel.Data.data() + (layer * layerSize))
+					);
+				}
+				else
+				{
+					glCompressedTexSubImage2D(
+						target, level, 0, 0, mipLevel.Width, mipLevel.Height,
+						format, layerSize, (mipLevel.Data.data() + (layer * layerSize))
+					);
+				}
+			}
+		}
+
+		if (glGetError() != GL_NO_ERROR) {
+			glBindTexture(this->glType, 0);
+			glDeleteTextures(1, &this->id);
+
+			this->id = 0;
+
+			return -3;
+		}
+
+		this->transparent = (this->transparent && image.HasAlpha());
+
+		if (image.Layers > 1)
+			this->setWrappingCubemapGL();
+		else
+			this->setWrappingGL();
+
+		this->setFilteringGL(mipLevels > 1);
+
+		glBindTexture(this->glType, 0);
+
+		break;
+	}
+	case GRAPHICS_API_VULKAN:
+		this->Image       = nullptr;
+		this->ImageMemory = nullptr;
+		this->ImageView   = nullptr;
+		this->Sampler     = nullptr;
+		this->transparent = (this->transparent && image.HasAlpha());
+
+		this->setFilteringVK(this->SamplerInfo);
+
+		if (image.Layers > 1)
+			this->setWrappingCubemapVK(this->SamplerInfo);
+		else
+			this->setWrappingVK(this->SamplerInfo);
+
+		if (RenderEngine::Canvas.VK->CreateTexture(image, this, TextureCompressor::ToVkFormat(image.Format, image.SRGB)) < 0) {
+			RenderEngine::Canvas.VK->DestroyTexture(&this->Image, &this->ImageMemory, &this->ImageView, &this->Sampler);
+			return -4;
+		}
+
+		break;
+	case GRAPHICS_API_NULL:
+		this->transparent = (this->transparent && image.HasAlpha());
+		this->NullID      = RenderEngine::Canvas.Null->CreateResource(image.Size());
+
+		break;
+	default:
+		return -7;
+	}
+
+	this->compression = image.Format;
+
+	RenderStats::AddBytesUploaded(image.Size());
+
+	return 0;
+}
+
+bool Texture::loadCompressedCache()
+{
+	CompressedImage image;
+
+	if (TextureCompressor::LoadCache(this->imageFiles, this->srgb, this->flipY, image) < 0)
+		return false;
+
+	return (this->loadCompressed(image) == 0);
+}
+
+// COMPRESSES THE DECODED IMAGES AND STORES THE RESULT IN THE KTX2 CACHE FOR THE NEXT LOAD
+bool Texture::loadCompressedImages(const std::vector<wxImage*> &images)
+{
+	if (images.empty() || this->imageFiles.empty() || (TextureCompressor::GetFormat(false) == TEXTURE_COMPRESSION_NONE))
+		return false;
+
+	int                   width  = images[0]->GetWidth();
+	int                   height = images[0]->GetHeight();
+	bool                  alpha  = false;
+	std::vector<uint8_t*> pixels2;
+
+	for (auto image : images)
+	{
+		if ((image->GetWidth() != width) || (image->GetHeight() != height))
+			break;
+
+		uint8_t* pixels = ImageDecoder::ToRGBA(*image, this->flipY);
+
+		if (pixels == nullptr)
+			break;
+
+		alpha = (alpha || TextureCompressor::HasAlpha(pixels, width, height));
+
+		pixels2.push_back(pixels);
+	}
+
+	CompressedImage compressed;
+	int             result = -1;
+
+	if (pixels2.size() == images.size())
+		result = TextureCompressor::Compress(pixels2, width, height, TextureCompressor::GetFormat(alpha), this->srgb, (this->type == TEXTURE_2D), compressed);
+
+	for (auto pixels : pixels2)
+		ImageDecoder::Release(pixels);
+
+	if ((result < 0) || (this->loadCompressed(compressed) < 0))
+		return false;
+
+	TextureCompressor::SaveCache(this->imageFiles, this->flipY, compressed);
+
+	return true;
+}
+
 #if defined _WINDOWS
 void Texture::loadTextureImagesDX(const std::vector<wxImage*> &images)
 {
-	std::vector<wxImage>  images2;
 	std::vector<uint8_t*> pixels2;
 
 	for (auto image : images)
 	{
-		wxImage image2 = (this->flipY ? image->Mirror(false) : *image);
-		images2.push_back(image2);
-		pixels2.push_back(Utils::ToRGBA(image2));
+		pixels2.push_back(ImageDecoder::ToRGBA(*image, this->flipY));
+
+		RenderStats::AddBytesUploaded((uint64_t)image->GetWidth() * (uint64_t)image->GetHeight() * 4);
 	}
 
-	if (!images2.empty())
+	if (!images.empty())
 	{
-		DXGI_FORMAT        format        = Utils::GetImageFormatDXGI(images2[0], this->srgb);
+		DXGI_FORMAT        format        = Utils::GetImageFormatDXGI(*images[0], this->srgb);
 		D3D11_SAMPLER_DESC samplerDesc11 = {};
 
-		this->size        = wxSize(images2[0].GetWidth(), images2[0].GetHeight());
-		this->mipLevels   = ((uint32_t)(std::floor(std::log2(std::max(this->size.GetWidth(), this->size.GetHeight())))) + 1);
-		this->type = (images.size() > 1 ? TEXTURE_CUBEMAP : TEXTURE_2D);
-		this->transparent = (this->transparent && images2[0].HasAlpha());
+		this->size        = wxSize(images[0]->GetWidth(), images[0]->GetHeight());
+		this->mipLevels   = MipGenerator::LevelCount(this->size.GetWidth(), this->size.GetHeight());
+		this->type        = (images.size() > 1 ? TEXTURE_CUBEMAP : TEXTURE_2D);
+		this->transparent = (this->transparent && images[0]->HasAlpha());
+
+		// ONE PIXEL POINTER PER SUBRESOURCE - THE CPU MIP CHAIN FOLLOWS THE BASE LEVEL OF 2D TEXTURES
+		std::vector<MipLevel> mipmaps;
+		std::vector<uint8_t*> subresources = pixels2;
+
+		if (this->type == TEXTURE_2D)
+			mipmaps = MipGenerator::Generate(pixels2[0], this->size.GetWidth(), this->size.GetHeight(), this->srgb, this->mipLevels);
+
+		for (auto &mipmap : mipmaps)
+			subresources.push_back(mipmap.Pixels.data());
 
 		switch (RenderEngine::SelectedGraphicsAPI) {
 		case GRAPHICS_API_DIRECTX11:
@@ -535,7 +856,7 @@ void Texture::loadTextureImagesDX(const std::vector<wxImage*> &images)
 			else
 				this->setWrappingDX11(samplerDesc11);
 
-			if (RenderEngine::Canvas.DX->CreateTexture11(FBO_UNKNOWN, pixels2, format, samplerDesc11, this) < 0)
+			if (RenderEngine::Canvas.DX->CreateTexture11(FBO_UNKNOWN, subresources, format, samplerDesc11, this) < 0)
 				wxMessageBox(("ERROR: Texture::loadTextureImagesDX11: Failed to create a texture from image files."), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
 
 			break;
@@ -547,7 +868,7 @@ void Texture::loadTextureImagesDX(const std::vector<wxImage*> &images)
 			else
 				this->setWrappingDX12(this->SamplerDesc12);
 
-			if (RenderEngine::Canvas.DX->CreateTexture12(FBO_UNKNOWN, pixels2, format, this) < 0)
+			if (RenderEngine::Canvas.DX->CreateTexture12(FBO_UNKNOWN, subresources, format, this) < 0)
 				wxMessageBox(("ERROR: Texture::loadTextureImagesDX12: Failed to create a texture from image files."), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
 
 			break;
@@ -557,27 +878,25 @@ void Texture::loadTextureImagesDX(const std::vector<wxImage*> &images)
 	}
 
 	for (auto pixels : pixels2)
-		std::free(pixels);
-
-	for (auto image : images2) {
-		if (this->flipY)
-			image.Destroy();
-	}
+		ImageDecoder::Release(pixels);
 }
 #endif
 
 void Texture::loadTextureImageGL(wxImage* image, bool cubemap, int index)
 {
-	wxImage  image2    = (this->flipY ? image->Mirror(false) : *image);
-	GLenum   formatIn  = Utils::GetImageFormat(image2, this->srgb, true);
-	GLenum   formatOut = Utils::GetImageFormat(image2, false, false);
-	uint8_t* pixels    = Utils::ToRGBA(image2);
+	GLenum   formatIn  = Utils::GetImageFormat(*image, this->srgb, true);
+	GLenum   formatOut = Utils::GetImageFormat(*image, false, false);
+	uint8_t* pixels    = ImageDecoder::ToRGBA(*image, this->flipY);
+	int      width     = image->GetWidth();
+	int      height    = image->GetHeight();
+
+	RenderStats::AddBytesUploaded((uint64_t)width * (uint64_t)height * 4);
 
 	glBindTexture(this->glType, this->id);
 
-	this->size        = wxSize(image2.GetWidth(), image2.GetHeight());
-	this->mipLevels   = ((uint32_t)(std::floor(std::log2(std::max(this->size.GetWidth(), this->size.GetHeight())))) + 1);
-	this->transparent = (this->transparent && image2.HasAlpha());
+	this->size        = wxSize(width, height);
+	this->mipLevels   = MipGenerator::LevelCount(width, height);
+	this->transparent = (this->transparent && image->HasAlpha());
 
 	if (this->transparent)
 		this->setAlphaBlendingGL(true);
@@ -589,7 +908,7 @@ void Texture::loadTextureImageGL(wxImage* image, bool cubemap, int index)
 
 		glTexImage2D(
 			(GL_TEXTURE_CUBE_MAP_POSITIVE_X + index), 0, formatIn,
-			image2.GetWidth(), image2.GetHeight(), 0, formatOut, GL_UNSIGNED_BYTE, pixels
+			width, height, 0, formatOut, GL_UNSIGNED_BYTE, pixels
 		);
 
 		this->setWrappingCubemapGL();
@@ -600,11 +919,13 @@ void Texture::loadTextureImageGL(wxImage* image, bool cubemap, int index)
 		glTexParameteri(this->glType, GL_TEXTURE_BASE_LEVEL, 0);
 		glTexParameteri(this->glType, GL_TEXTURE_MAX_LEVEL,  this->mipLevels - 1);
 
-		// https://www.khronos.org/opengl/wiki/Common_Mistakes#Automatic_mipmap_generation
-		glTexStorage2D(this->glType, this->mipLevels, formatIn, image2.GetWidth(), image2.GetHeight());
-		glTexSubImage2D(this->glType, 0, 0, 0, image2.GetWidth(), image2.GetHeight(), formatOut, GL_UNSIGNED_BYTE, pixels);
+		std::vector<MipLevel> mipmaps = MipGenerator::Generate(pixels, width, height, this->srgb, this->mipLevels);
+
+		glTexStorage2D(this->glType, this->mipLevels, formatIn, width, height);
+		glTexSubImage2D(this->glType, 0, 0, 0, width, height, formatOut, GL_UNSIGNED_BYTE, pixels);
 
-		glGenerateMipmap(this->glType);
+		for (size_t i = 0; i < mipmaps.size(); i++)
+			glTexSubImage2D(this->glType, (GLint)(i + 1), 0, 0, mipmaps[i].Width, mipmaps[i].Height, formatOut, GL_UNSIGNED_BYTE, mipmaps[i].Pixels.data());
 
 		this->setWrappingGL();
 		this->setFilteringGL(true);
@@ -615,31 +936,48 @@ void Texture::loadTextureImageGL(wxImage* image, bool cubemap, int index)
 
 	glBindTexture(this->glType, 0);
 
-	std::free(pixels);
+	ImageDecoder::Release(pixels);
+}
+
+// NO PIXELS ARE CONVERTED OR KEPT - ONLY THE SIZE THE UPLOAD WOULD HAVE HAD
+void Texture::loadTextureImagesNull(const std::vector<wxImage*> &images)
+{
+	this->id = 0;
+
+	if (images.empty())
+		return;
+
+	for (auto image : images)
+		RenderStats::AddBytesUploaded((uint64_t)image->GetWidth() * (uint64_t)image->GetHeight() * 4);
+
+	this->size        = wxSize(images[0]->GetWidth(), images[0]->GetHeight());
+	this->mipLevels   = MipGenerator::LevelCount(this->size.GetWidth(), this->size.GetHeight());
+	this->transparent = (this->transparent && images[0]->HasAlpha());
+
+	uint32_t layers    = (uint32_t)images.size();
+	uint32_t mipLevels = (layers == 1 ? this->mipLevels : 1);
 
-	if (this->flipY)
-		image2.Destroy();
+	this->NullID = RenderEngine::Canvas.Null->CreateResource(MemoryTracker::TextureSize(this->size.GetWidth(), this->size.GetHeight(), layers, mipLevels));
 }
 
 void Texture::loadTextureImagesVK(const std::vector<wxImage*> &images)
 {
-	std::vector<wxImage>  images2;
 	std::vector<uint8_t*> pixels2;
 
 	for (auto image : images)
 	{
-		wxImage image2 = (this->flipY ? image->Mirror(false) : *image);
-		images2.push_back(image2);
-		pixels2.push_back(Utils::ToRGBA(image2));
+		pixels2.push_back(ImageDecoder::ToRGBA(*image, this->flipY));
+
+		RenderStats::AddBytesUploaded((uint64_t)image->GetWidth() * (uint64_t)image->GetHeight() * 4);
 	}
 
-	if (!images2.empty())
+	if (!images.empty())
 	{
-		VkFormat format = Utils::GetImageFormatVK(images2[0], this->srgb);
+		VkFormat format = Utils::GetImageFormatVK(*images[0], this->srgb);
 
-		this->size        = wxSize(images2[0].GetWidth(), images2[0].GetHeight());
-		this->mipLevels   = ((uint32_t)(std::floor(std::log2(std::max(this->size.GetWidth(), this->size.GetHeight())))) + 1);
-		this->transparent = (this->transparent && images2[0].HasAlpha());
+		this->size        = wxSize(images[0]->GetWidth(), images[0]->GetHeight());
+		this->mipLevels   = MipGenerator::LevelCount(this->size.GetWidth(), this->size.GetHeight());
+		this->transparent = (this->transparent && images[0]->HasAlpha());
 
 		this->setFilteringVK(this->SamplerInfo);
 
@@ -648,17 +986,44 @@ void Texture::loadTextureImagesVK(const std::vector<wxImage*> &images)
 		else
 			this->setWrappingVK(this->SamplerInfo);
 
-		if (RenderEngine::Canvas.VK->CreateTexture(pixels2, this, format) < 0)
+		CompressedImage image;
+
+		int result = TextureCompressor::Compress(
+			pixels2, this->size.GetWidth(), this->size.GetHeight(), TEXTURE_COMPRESSION_NONE, this->srgb, (images.size() == 1), image
+		);
+
+		if ((result < 0) || (RenderEngine::Canvas.VK->CreateTexture(image, this, format) < 0))
 			wxMessageBox(("ERROR: Texture::loadTextureImagesVK: Failed to create a texture from image files."), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
 	}
 
 	for (auto pixels : pixels2)
-		std::free(pixels);
+		ImageDecoder::Release(pixels);
+}
+
+// ONLY THE LOW MIP LEVELS ARE UPLOADED - TextureStreamer LOADS THE REST WHEN A MESH USING THE TEXTURE NEEDS THEM
+bool Texture::loadStreamed()
+{
+	CompressedImage image;
+	CompressedImage tail;
+
+	if (TextureStreamer::Load(this->imageFiles, this->srgb, this->flipY, image) < 0)
+		return false;
+
+	this->streamed = (TextureStreamer::Register(this, image, tail) == 0);
+
+	if (this->loadCompressed(this->streamed ? tail : image) < 0)
+	{
+		if (this->streamed)
+			TextureStreamer::Unregister(this);
 
-	for (auto image : images2) {
-		if (this->flipY)
-			image.Destroy();
+		this->streamed = false;
+
+		return false;
 	}
+
+	this->trackMemory(MEMORY_TAG_TEXTURES);
+
+	return true;
 }
 
 uint32_t Texture::MipLevels()
@@ -666,15 +1031,90 @@ uint32_t Texture::MipLevels()
 	return this->mipLevels;
 }
 
+// THE GPU IMAGE OF AN IMAGE FILE TEXTURE
+void Texture::releaseImage()
+{
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+		_RELEASEP(this->SamplerState11);
+		_RELEASEP(this->SRV11);
+		_RELEASEP(this->Resource11);
+		break;
+	case GRAPHICS_API_DIRECTX12:
+		_RELEASEP(this->Resource12);
+		break;
+	#endif
+	case GRAPHICS_API_OPENGL:
+		if (this->id > 0)
+			glDeleteTextures(1, &this->id);
+
+		this->id = 0;
+
+		break;
+	case GRAPHICS_API_VULKAN:
+		RenderEngine::Canvas.VK->DestroyTexture(&this->Image, &this->ImageMemory, &this->ImageView, &this->Sampler);
+		break;
+	case GRAPHICS_API_NULL:
+		if ((this->NullID > 0) && (RenderEngine::Canvas.Null != nullptr))
+			RenderEngine::Canvas.Null->DestroyResource(this->NullID);
+
+		this->NullID = 0;
+
+		break;
+	default:
+		throw;
+	}
+
+	MemoryTracker::Free(this);
+}
+
 void Texture::reload()
 {
+	// STREAMED TEXTURES START OVER FROM THEIR LOW MIP LEVELS
+	if (this->streamed)
+	{
+		TextureStreamer::Unregister(this);
+
+		this->streamed = false;
+
+		this->releaseImage();
+
+		if (!this->loadStreamed())
+			wxMessageBox(("ERROR: Failed to reload the texture from image file: " + this->imageFiles[0]), RenderEngine::Canvas.Window->GetTitle().c_str(), wxOK | wxICON_ERROR);
+
+		return;
+	}
+
 	wxImage* image = nullptr;
 
 	if (!this->imageFiles.empty() && (this->id > 0))
 		image = Utils::LoadImageFile(this->imageFiles[0]);
 
-	if (image != nullptr) {
-		this->loadTextureImageGL(image);
+	if (image != nullptr)
+	{
+		// COMPRESSED STORAGE IS IMMUTABLE - CREATE THE TEXTURE AGAIN
+		if (this->compression != TEXTURE_COMPRESSION_NONE)
+		{
+			glDeleteTextures(1, &this->id);
+
+			this->id          = 0;
+			this->compression = TEXTURE_COMPRESSION_NONE;
+
+			if (!this->loadCompressedImages({ image })) {
+				glCreateTextures(this->glType, 1, &this->id);
+				this->loadTextureImageGL(image);
+			}
+		}
+		else
+		{
+			this->loadTextureImageGL(image);
+		}
+
+		// THE RELOADED IMAGE CAN HAVE ANOTHER FORMAT OR SIZE
+		MemoryTracker::Free(this);
+		this->trackMemory(MEMORY_TAG_TEXTURES);
+
 		image->Destroy();
 	}
 }
@@ -813,3 +1253,114 @@ GLenum Texture::TypeGL()
 {
     return this->glType;
 }
+
+// REPLACES THE RESIDENT MIP LEVELS OF A STREAMED TEXTURE. THE RENDER THREAD MUST BE PAUSED - EVERY
+// BACKEND WAITS FOR THE GPU WHEN PRESENTING, SO THE OLD IMAGE IS NO LONGER IN USE BETWEEN FRAMES.
+int Texture::UpdateLevels(const CompressedImage &image)
+{
+	if (image.Levels.empty())
+		return -1;
+
+	this->releaseImage();
+
+	int result = this->loadCompressed(image);
+
+	if (result == 0)
+		this->trackMemory(MEMORY_TAG_TEXTURES);
+
+	return result;
+}
+
+// UPLOADS A REGION OF A SINGLE LEVEL RGBA8 2D TEXTURE, THE PIXELS HOLD THE WHOLE LEVEL.
+// DIRECTX 12 HAS NO IN-PLACE UPLOAD PATH, SO THE WHOLE LEVEL IS RE-CREATED (SEE UpdateLevels).
+int Texture::UpdatePixels(const uint8_t* pixels, const wxRect &region)
+{
+	if ((pixels == nullptr) || (this->type != TEXTURE_2D) || (this->compression != TEXTURE_COMPRESSION_NONE) || (this->mipLevels != 1))
+		return -1;
+
+	wxRect rect = wxRect(this->size).Intersect(region);
+
+	if (rect.IsEmpty())
+		return 0;
+
+	int width = this->size.GetWidth();
+
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	#if defined _WINDOWS
+	case GRAPHICS_API_DIRECTX11:
+		if (RenderEngine::Canvas.DX->UpdateTexture11(this, pixels, rect) < 0)
+			return -2;
+
+		break;
+	case GRAPHICS_API_DIRECTX12:
+	{
+		CompressedImage image;
+
+		image.Height = this->size.GetHeight();
+		image.Layers = 1;
+		image.SRGB   = this->srgb;
+		image.Width  = width;
+
+		image.Levels.resize(1);
+		image.Levels[0].Data.assign(pixels, (pixels + ((size_t)width * (size_t)image.Height * 4)));
+		image.Levels[0].Height = image.Height;
+		image.Levels[0].Width  = width;
+
+		return this->UpdateLevels(image);
+	}
+	#endif
+	case GRAPHICS_API_OPENGL:
+		glBindTexture(GL_TEXTURE_2D, this->id);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+
+		glTexSubImage2D(
+			GL_TEXTURE_2D, 0, rect.GetX(), rect.GetY(), rect.GetWidth(), rect.GetHeight(),
+			GL_RGBA, GL_UNSIGNED_BYTE, (pixels + (((size_t)rect.GetY() * width + rect.GetX()) * 4))
+		);
+
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		if (glGetError() != GL_NO_ERROR)
+			return -3;
+
+		break;
+	case GRAPHICS_API_VULKAN:
+		if (RenderEngine::Canvas.VK->UpdateTexture(this, pixels, rect) < 0)
+			return -4;
+
+		break;
+	case GRAPHICS_API_NULL:
+		break;
+	default:
+		throw;
+	}
+
+	RenderStats::AddBytesUploaded((uint64_t)rect.GetWidth() * (uint64_t)rect.GetHeight() * 4);
+
+	return 0;
+}
+
+uint64_t Texture::trackMemory(MemoryTag tag)
+{
+	uint32_t layers = 1;
+
+	switch (this->type) {
+		case TEXTURE_2D:            layers = 1;                                  break;
+		case TEXTURE_2D_ARRAY:      layers = MAX_DEPTH_LAYERS;                   break;
+		case TEXTURE_CUBEMAP:       layers = MAX_TEXTURES;                       break;
+		case TEXTURE_CUBEMAP_ARRAY: layers = (MAX_LIGHT_SOURCES * MAX_TEXTURES); break;
+		default: throw;
+	}
+
+	// ONLY 2D IMAGE TEXTURES HAVE MIPMAPS
+	uint32_t mipLevels = ((tag == MEMORY_TAG_TEXTURES) && (this->type == TEXTURE_2D) ? this->mipLevels : 1);
+	uint64_t bytes     = (this->compression != TEXTURE_COMPRESSION_NONE ?
+		TextureCompressor::TextureSize(this->compression, this->size.GetWidth(), this->size.GetHeight(), layers, mipLevels) :
+		MemoryTracker::TextureSize(this->size.GetWidth(), this->size.GetHeight(), layers, mipLevels)
+	);
+
+	MemoryTracker::Allocate(this, tag, MEMORY_GPU, bytes, (!this->imageFiles.empty() ? this->imageFiles[0] : ""));
+
+	return bytes;
+}
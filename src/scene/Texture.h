@@ -8,11 +8,13 @@
 class Texture
 {
 public:
-	Texture(wxImage* image, bool repeat = false, bool flipY = false, bool transparent = false, const glm::vec2 &scale = { 1.0f, 1.0f });
-	Texture(const wxString &imageFile, bool srgb = false, bool repeat = false, bool flipY = false, bool transparent = false, const glm::vec2 &scale = { 1.0f, 1.0f });
-	Texture(const std::vector<wxString> &imageFiles, bool repeat = false, bool flipY = false, bool transparent = false, const glm::vec2 &scale = { 1.0f, 1.0f });
+	Texture(wxImage* image, bool repeat = false, bool flipY = false, bool transparent = false);
+	Texture(const wxString &imageFile, bool srgb = false, bool repeat = false, bool flipY = false, bool transparent = false);
+	Texture(const std::vector<wxString> &imageFiles, bool repeat = false, bool flipY = false, bool transparent = false);
+	Texture(const CompressedImage &image, bool repeat = false, bool transparent = false);
 	Texture(FBOType fboType, TextureType textureType, VkFormat imageFormat, const wxSize &size);
 	Texture(GLint format, TextureType textureType, const wxSize &size);
+	Texture(FBOType fboType, TextureType textureType, const wxSize &size);
 	Texture();
 	~Texture();
 
@@ -22,20 +24,20 @@ public:
 
 public:
 	VkFramebuffer       BufferVK;
-	VkFramebuffer       DepthBuffers[MAX_LIGHT_SOURCES];
-	VkImageView         DepthViews[MAX_LIGHT_SOURCES];
+	VkFramebuffer       DepthBuffers[MAX_DEPTH_LAYERS];
+	VkImageView         DepthViews[MAX_DEPTH_LAYERS];
 	VkImage             Image;
 	VkDeviceMemory      ImageMemory;
 	VkImageView         ImageView;
 	VkSampler           Sampler;
+	uint32_t            NullID = 0;
 	VkSamplerCreateInfo SamplerInfo;
-	glm::vec2           Scale;
 
 	#if defined _WINDOWS
 		ID3D11RenderTargetView*         ColorBuffer11;
-		ID3D11DepthStencilView*         DepthBuffers11[MAX_LIGHT_SOURCES];
+		ID3D11DepthStencilView*         DepthBuffers11[MAX_DEPTH_LAYERS];
 		ID3D12DescriptorHeap*           ColorBuffer12;
-		ID3D12DescriptorHeap*           DepthBuffers12[MAX_LIGHT_SOURCES];
+		ID3D12DescriptorHeap*           DepthBuffers12[MAX_DEPTH_LAYERS];
 		ID3D11Texture2D*                Resource11;
 		ID3D12Resource*                 Resource12;
 		D3D12_SAMPLER_DESC              SamplerDesc12;
@@ -46,6 +48,7 @@ public:
 
 private:
 	VkViewport            bufferViewPort;
+	TextureCompression    compression = TEXTURE_COMPRESSION_NONE;
 	bool                  flipY;
 	GLuint                id;
 	std::vector<wxString> imageFiles;
@@ -53,6 +56,7 @@ private:
 	bool                  repeat;
 	wxSize                size;
 	bool                  srgb;
+	bool                  streamed    = false;	// REGISTERED WITH TextureStreamer
 	TextureType           type;
 	bool                  transparent;
 	GLenum                glType;
@@ -64,21 +68,24 @@ private:
 	#endif
 
 public:
-	VkViewport  BufferViewPort();
-	bool        FlipY();
-	GLuint      ID();
-	wxString    ImageFile(int index = 0);
-	bool        IsOK();
-	uint32_t    MipLevels();
-	bool        Repeat();
-	void        SetFlipY(bool newFlipY);
-	void        SetRepeat(bool newRepeat);
-	void        SetTransparent(bool newTransparent);
-	wxSize      Size();
-	bool        SRGB();
-	bool        Transparent();
-	TextureType Type();
-	GLenum      TypeGL();
+	VkViewport         BufferViewPort();
+	TextureCompression Compression();
+	bool               FlipY();
+	GLuint             ID();
+	wxString           ImageFile(int index = 0);
+	bool               IsOK();
+	uint32_t           MipLevels();
+	bool               Repeat();
+	void               SetFlipY(bool newFlipY);
+	void               SetRepeat(bool newRepeat);
+	void               SetTransparent(bool newTransparent);
+	wxSize             Size();
+	bool               SRGB();
+	bool               Transparent();
+	TextureType        Type();
+	GLenum             TypeGL();
+	int                UpdateLevels(const CompressedImage &image);
+	int                UpdatePixels(const uint8_t* pixels, const wxRect &region);
 
 	#if defined _WINDOWS
 		D3D11_VIEWPORT BufferViewPort11();
@@ -86,16 +93,23 @@ public:
 	#endif
 
 private:
-	void loadTextureImageGL(wxImage* image, bool cubemap = false, int index = 0);
-	void loadTextureImagesVK(const std::vector<wxImage*> &images);
-	void reload();
-	void setAlphaBlendingGL(bool enable);
-	void setFilteringGL(bool mipmap = true);
-	void setFilteringVK(VkSamplerCreateInfo &samplerInfo);
-	void setWrappingGL();
-	void setWrappingVK(VkSamplerCreateInfo &samplerInfo);
-	void setWrappingCubemapGL();
-	void setWrappingCubemapVK(VkSamplerCreateInfo &samplerInfo);
+	int      loadCompressed(const CompressedImage &image);
+	bool     loadCompressedCache();
+	bool     loadCompressedImages(const std::vector<wxImage*> &images);
+	void     loadTextureImageGL(wxImage* image, bool cubemap = false, int index = 0);
+	void     loadTextureImagesNull(const std::vector<wxImage*> &images);
+	void     loadTextureImagesVK(const std::vector<wxImage*> &images);
+	bool     loadStreamed();
+	void     releaseImage();
+	void     reload();
+	void     setAlphaBlendingGL(bool enable);
+	void     setFilteringGL(bool mipmap = true);
+	void     setFilteringVK(VkSamplerCreateInfo &samplerInfo);
+	void     setWrappingGL();
+	void     setWrappingVK(VkSamplerCreateInfo &samplerInfo);
+	void     setWrappingCubemapGL();
+	void     setWrappingCubemapVK(VkSamplerCreateInfo &samplerInfo);
+	uint64_t trackMemory(MemoryTag tag);
 
 	#if defined _WINDOWS
 		void loadTextureImagesDX(const std::vector<wxImage*> &images);
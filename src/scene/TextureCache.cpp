@@ -0,0 +1,225 @@
+#include "TextureCache.h"
+
+std::unordered_map<std::string, TextureCacheEntry*> TextureCache::contents;
+std::unordered_map<std::string, TextureCacheEntry*> TextureCache::entries;
+std::mutex                                          TextureCache::mutex;
+TextureCacheStats                                   TextureCache::stats;
+std::unordered_map<Texture*, TextureCacheEntry*>    TextureCache::textures;
+
+// 2D TEXTURE
+Texture* TextureCache::Acquire(const wxString &imageFile, bool srgb, bool repeat, bool flipY, bool transparent)
+{
+	return TextureCache::acquire({ imageFile }, srgb, repeat, flipY, transparent, false);
+}
+
+// CUBEMAP TEXTURE
+Texture* TextureCache::Acquire(const std::vector<wxString> &imageFiles, bool repeat, bool flipY, bool transparent)
+{
+	return TextureCache::acquire(imageFiles, true, repeat, flipY, transparent, true);
+}
+
+Texture* TextureCache::acquire(const std::vector<wxString> &imageFiles, bool srgb, bool repeat, bool flipY, bool transparent, bool cubemap)
+{
+	std::lock_guard<std::mutex> lock(TextureCache::mutex);
+
+	std::string key   = wxString::Format("%d%d%d%d%d|", (int)cubemap, (int)srgb, (int)repeat, (int)flipY, (int)transparent).ToStdString();
+	std::string state = key;
+
+	for (const auto &file : imageFiles)
+		key.append(file.ToStdString()).append("|");
+
+	time_t modified = TextureCache::modified(imageFiles);
+	auto   entry    = TextureCache::entries.find(key);
+
+	// SAME PATH AND UNCHANGED ON DISK
+	if ((entry != TextureCache::entries.end()) && (entry->second->Modified == modified))
+	{
+		TextureCache::stats.Hits++;
+		entry->second->References++;
+
+		return entry->second->CachedTexture;
+	}
+
+	// UNREADABLE FILES ARE NOT CACHED - THE TEXTURE REPORTS THE ERROR AND IS OWNED BY THE CALLER
+	uint64_t hash = 0;
+
+	if (!TextureCache::hashFiles(imageFiles, hash))
+		return (cubemap ? new Texture(imageFiles, repeat, flipY, transparent) : new Texture(imageFiles[0], srgb, repeat, flipY, transparent));
+
+	if (entry != TextureCache::entries.end())
+	{
+		// TOUCHED BUT THE SAME CONTENT
+		if (entry->second->ContentHash == hash)
+		{
+			TextureCache::stats.Hits++;
+
+			entry->second->Modified = modified;
+			entry->second->References++;
+
+			return entry->second->CachedTexture;
+		}
+
+		// CHANGED ON DISK - THE CURRENT USERS KEEP THE OLD TEXTURE
+		auto &keys = entry->second->Keys;
+		keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+
+		TextureCache::entries.erase(entry);
+	}
+
+	// SAME CONTENT AS A TEXTURE LOADED FROM ANOTHER PATH
+	std::string contentKey = (state + wxString::Format("%016llx", (unsigned long long)hash).ToStdString());
+	auto        content    = TextureCache::contents.find(contentKey);
+
+	if (content != TextureCache::contents.end())
+	{
+		TextureCache::stats.Deduplicated++;
+
+		content->second->Keys.push_back(key);
+		content->second->References++;
+
+		TextureCache::entries[key] = content->second;
+
+		return content->second->CachedTexture;
+	}
+
+	TextureCache::stats.Misses++;
+
+	TextureCacheEntry* newEntry = new TextureCacheEntry();
+
+	newEntry->CachedTexture = (cubemap ? new Texture(imageFiles, repeat, flipY, transparent) : new Texture(imageFiles[0], srgb, repeat, flipY, transparent));
+	newEntry->ContentHash   = hash;
+	newEntry->ContentKey    = contentKey;
+	newEntry->Keys          = { key };
+	newEntry->Modified      = modified;
+	newEntry->References    = 1;
+
+	TextureCache::contents[contentKey]              = newEntry;
+	TextureCache::entries[key]                      = newEntry;
+	TextureCache::textures[newEntry->CachedTexture] = newEntry;
+
+	return newEntry->CachedTexture;
+}
+
+// SHARES A CACHED TEXTURE WITH ANOTHER OWNER
+Texture* TextureCache::AddRef(Texture* texture)
+{
+	std::lock_guard<std::mutex> lock(TextureCache::mutex);
+
+	auto entry = TextureCache::textures.find(texture);
+
+	if (entry != TextureCache::textures.end())
+		entry->second->References++;
+
+	return texture;
+}
+
+void TextureCache::Close()
+{
+	std::lock_guard<std::mutex>     lock(TextureCache::mutex);
+	std::vector<TextureCacheEntry*> remaining;
+
+	for (const auto &entry : TextureCache::textures)
+		remaining.push_back(entry.second);
+
+	for (auto entry : remaining)
+		TextureCache::destroy(entry);
+
+	TextureCache::contents.clear();
+	TextureCache::entries.clear();
+	TextureCache::textures.clear();
+
+	TextureCache::stats = {};
+}
+
+void TextureCache::destroy(TextureCacheEntry* entry)
+{
+	for (const auto &key : entry->Keys)
+	{
+		auto keyEntry = TextureCache::entries.find(key);
+
+		if ((keyEntry != TextureCache::entries.end()) && (keyEntry->second == entry))
+			TextureCache::entries.erase(keyEntry);
+	}
+
+	auto content = TextureCache::contents.find(entry->ContentKey);
+
+	if ((content != TextureCache::contents.end()) && (content->second == entry))
+		TextureCache::contents.erase(content);
+
+	TextureCache::textures.erase(entry->CachedTexture);
+
+	_DELETEP(entry->CachedTexture);
+	_DELETEP(entry);
+}
+
+// FNV-1a OVER THE FILE CONTENTS
+bool TextureCache::hashFiles(const std::vector<wxString> &imageFiles, uint64_t &hash)
+{
+	std::vector<char> buffer(BUFFER_SIZE * 64);
+
+	hash = 14695981039346656037ULL;
+
+	for (const auto &file : imageFiles)
+	{
+		std::ifstream fileStream(file.wc_str(), std::ios::binary);
+
+		if (file.empty() || !fileStream.good())
+			return false;
+
+		while (fileStream.read(buffer.data(), buffer.size()) || (fileStream.gcount() > 0))
+		{
+			std::streamsize size = fileStream.gcount();
+
+			for (std::streamsize i = 0; i < size; i++)
+				hash = ((hash ^ (uint8_t)buffer[i]) * 1099511628211ULL);
+		}
+	}
+
+	return true;
+}
+
+bool TextureCache::IsCached(Texture* texture)
+{
+	std::lock_guard<std::mutex> lock(TextureCache::mutex);
+
+	return (TextureCache::textures.find(texture) != TextureCache::textures.end());
+}
+
+time_t TextureCache::modified(const std::vector<wxString> &imageFiles)
+{
+	time_t modified = 0;
+
+	for (const auto &file : imageFiles) {
+		if (wxFileExists(file))
+			modified = std::max(modified, wxFileModificationTime(file));
+	}
+
+	return modified;
+}
+
+// RETURNS FALSE IF THE TEXTURE IS NOT CACHED (NULL, EMPTY, FRAME BUFFER AND HUD TEXTURES)
+bool TextureCache::Release(Texture* texture)
+{
+	std::lock_guard<std::mutex> lock(TextureCache::mutex);
+
+	auto entry = TextureCache::textures.find(texture);
+
+	if (entry == TextureCache::textures.end())
+		return false;
+
+	if (--entry->second->References <= 0)
+		TextureCache::destroy(entry->second);
+
+	return true;
+}
+
+TextureCacheStats TextureCache::Stats()
+{
+	std::lock_guard<std::mutex> lock(TextureCache::mutex);
+
+	TextureCacheStats stats = TextureCache::stats;
+
+	stats.Textures = (int)TextureCache::textures.size();
+
+	return stats;
+}
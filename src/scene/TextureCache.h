@@ -0,0 +1,60 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_TEXTURECACHE_H
+#define S3DE_TEXTURECACHE_H
+
+struct TextureCacheEntry
+{
+	uint64_t                 ContentHash   = 0;
+	std::string              ContentKey    = "";
+	Texture*                 CachedTexture = nullptr;
+	std::vector<std::string> Keys;
+	time_t                   Modified      = 0;
+	int                      References    = 0;
+};
+
+struct TextureCacheStats
+{
+	uint64_t Deduplicated = 0;
+	uint64_t Hits         = 0;
+	uint64_t Misses       = 0;
+	int      Textures     = 0;
+};
+
+// TEXTURES ARE SHARED BY PATH + SAMPLER STATE + SRGB, AND BY CONTENT HASH WHEN DIFFERENT PATHS HOLD THE SAME IMAGE.
+// EVERY Component::Textures[] SLOT HOLDING A CACHED TEXTURE OWNS ONE REFERENCE, THE LAST RELEASE FREES THE GPU MEMORY.
+// MAIN THREAD ONLY - Acquire AND Release CREATE AND DELETE GRAPHICS OBJECTS, SO THEY RUN WITH THE RENDER THREAD PAUSED (RenderThreadLock).
+// THE MUTEX ONLY KEEPS THE MAPS CONSISTENT FOR Stats/IsCached READERS, IT DOES NOT MAKE Acquire OR Release SAFE ON OTHER THREADS.
+class TextureCache
+{
+private:
+	TextureCache()  {}
+	~TextureCache() {}
+
+private:
+	static std::unordered_map<std::string, TextureCacheEntry*> contents;
+	static std::unordered_map<std::string, TextureCacheEntry*> entries;
+	static std::mutex                                          mutex;
+	static TextureCacheStats                                   stats;
+	static std::unordered_map<Texture*, TextureCacheEntry*>    textures;
+
+public:
+	static Texture*          Acquire(const wxString &imageFile, bool srgb = false, bool repeat = false, bool flipY = false, bool transparent = false);
+	static Texture*          Acquire(const std::vector<wxString> &imageFiles, bool repeat = false, bool flipY = false, bool transparent = false);
+	static Texture*          AddRef(Texture* texture);
+	static void              Close();
+	static bool              IsCached(Texture* texture);
+	static bool              Release(Texture* texture);
+	static TextureCacheStats Stats();
+
+private:
+	static Texture* acquire(const std::vector<wxString> &imageFiles, bool srgb, bool repeat, bool flipY, bool transparent, bool cubemap);
+	static void     destroy(TextureCacheEntry* entry);
+	static bool     hashFiles(const std::vector<wxString> &imageFiles, uint64_t &hash);
+	static time_t   modified(const std::vector<wxString> &imageFiles);
+
+};
+
+#endif
@@ -0,0 +1,492 @@
+#include "TextureStreamer.h"
+
+uint64_t                                      TextureStreamer::Budget       = (256 * 1024 * 1024);
+bool                                          TextureStreamer::Enabled      = false;
+int                                           TextureStreamer::MaxLoads     = 4;
+int                                           TextureStreamer::TailSize     = 64;
+uint64_t                                      TextureStreamer::UploadBudget = (32 * 1024 * 1024);
+uint64_t                                      TextureStreamer::frame        = 0;
+std::vector<JobHandle>                        TextureStreamer::jobs;
+std::mutex                                    TextureStreamer::mutex;
+uint64_t                                      TextureStreamer::nextID       = 0;
+std::deque<TextureStreamResult*>              TextureStreamer::ready;
+TextureStreamerStats                          TextureStreamer::stats;
+std::unordered_map<Texture*, StreamedTexture> TextureStreamer::textures;
+
+void TextureStreamer::Close()
+{
+	for (const auto &job : TextureStreamer::jobs)
+		JobSystem::Wait(job);
+
+	TextureStreamer::jobs.clear();
+
+	{
+		std::lock_guard<std::mutex> lock(TextureStreamer::mutex);
+
+		for (auto result : TextureStreamer::ready)
+			_DELETEP(result);
+
+		TextureStreamer::ready.clear();
+	}
+
+	TextureStreamer::textures.clear();
+
+	TextureStreamer::frame = 0;
+	TextureStreamer::stats = {};
+}
+
+// DROPS THE HIGH LEVELS - THE TEXTURE FALLS BACK TO ITS TAIL
+void TextureStreamer::evict(Texture* texture, StreamedTexture &streamed)
+{
+	RenderThreadLock renderLock;
+
+	if (texture->UpdateLevels(streamed.Tail) < 0)
+		streamed.Failed = true;
+
+	streamed.Bytes       = streamed.Tail.Size();
+	streamed.ResidentMip = streamed.TailMip;
+
+	TextureStreamer::stats.Evictions++;
+}
+
+bool TextureStreamer::IsStreamed(Texture* texture)
+{
+	return (TextureStreamer::textures.find(texture) != TextureStreamer::textures.end());
+}
+
+// CPU ONLY - SAFE TO CALL FROM ANY THREAD
+int TextureStreamer::Load(const std::vector<wxString> &imageFiles, bool srgb, bool flipY, CompressedImage &result)
+{
+	PROFILE_SCOPE("TextureStreamer::Load");
+
+	if (imageFiles.empty() || imageFiles[0].empty())
+		return -1;
+
+	// BLOCK COMPRESSED MIP CHAIN FROM THE KTX2 CACHE - THE SOURCE IMAGE IS NOT DECODED
+	if (TextureCompressor::LoadCache(imageFiles, srgb, flipY, result) >= 0)
+		return 0;
+
+	wxImage* image = Utils::LoadImageFile(imageFiles[0]);
+
+	if (image == nullptr)
+		return -2;
+
+	int      width  = image->GetWidth();
+	int      height = image->GetHeight();
+	uint8_t* pixels = ImageDecoder::ToRGBA(*image, flipY);
+
+	_DELETEP(image);
+
+	if (pixels == nullptr)
+		return -3;
+
+	TextureCompression format = TextureCompressor::GetFormat(TextureCompressor::HasAlpha(pixels, width, height));
+	int                status = TextureCompressor::Compress({ pixels }, width, height, format, srgb, true, result);
+
+	ImageDecoder::Release(pixels);
+
+	if (status < 0)
+		return -4;
+
+	if (format != TEXTURE_COMPRESSION_NONE)
+		TextureCompressor::SaveCache(imageFiles, flipY, result);
+
+	return 0;
+}
+
+// EVICTS THE LEAST RECENTLY USED TEXTURES UNTIL bytes MORE FIT IN THE BUDGET - NEVER TEXTURES USED THIS FRAME
+bool TextureStreamer::makeRoom(uint64_t bytes, Texture* keep)
+{
+	uint64_t resident = 0;
+
+	for (const auto &texture : TextureStreamer::textures)
+		resident += (texture.second.Bytes + texture.second.Reserved);
+
+	while ((resident + bytes) > TextureStreamer::Budget)
+	{
+		auto lru = TextureStreamer::textures.end();
+
+		for (auto it = TextureStreamer::textures.begin(); it != TextureStreamer::textures.end(); it++)
+		{
+			const StreamedTexture &streamed = it->second;
+
+			if ((it->first == keep) || streamed.Pending || (streamed.ResidentMip >= streamed.TailMip) || (streamed.LastUsed >= TextureStreamer::frame))
+				continue;
+
+			if ((lru == TextureStreamer::textures.end()) || (streamed.LastUsed < lru->second.LastUsed))
+				lru = it;
+		}
+
+		if (lru == TextureStreamer::textures.end())
+			return false;
+
+		uint64_t evicted = lru->second.Bytes;
+
+		TextureStreamer::evict(lru->first, lru->second);
+
+		resident -= std::min((evicted - lru->second.Bytes), resident);
+	}
+
+	return true;
+}
+
+// THE LOW LEVELS OF THE FULL CHAIN ARE KEPT AS THE TAIL, WHICH IS WHAT THE TEXTURE UPLOADS FIRST.
+// RETURNS -1 FOR IMAGES THAT ARE TOO SMALL (OR LAYERED) TO STREAM - THE WHOLE CHAIN IS UPLOADED INSTEAD.
+int TextureStreamer::Register(Texture* texture, const CompressedImage &image, CompressedImage &tail)
+{
+	if ((texture == nullptr) || image.Levels.empty() || (image.Layers != 1))
+		return -1;
+
+	StreamedTexture streamed;
+
+	streamed.Format    = image.Format;
+	streamed.Height    = image.Height;
+	streamed.MipLevels = (uint32_t)image.Levels.size();
+	streamed.Width     = image.Width;
+
+	// THE FIRST LEVEL NO LARGER THAN TailSize
+	while (((streamed.TailMip + 1) < streamed.MipLevels) && (std::max(image.Levels[streamed.TailMip].Width, image.Levels[streamed.TailMip].Height) > TextureStreamer::TailSize))
+		streamed.TailMip++;
+
+	if (streamed.TailMip == 0)
+		return -1;
+
+	streamed.ID          = ++TextureStreamer::nextID;
+	streamed.LastUsed    = TextureStreamer::frame;
+	streamed.ResidentMip = streamed.TailMip;
+	streamed.Tail        = TextureStreamer::slice(image, streamed.TailMip);
+	streamed.Bytes       = streamed.Tail.Size();
+	streamed.WantedMip   = streamed.TailMip;
+
+	tail = streamed.Tail;
+
+	TextureStreamer::textures[texture] = std::move(streamed);
+
+	return 0;
+}
+
+void TextureStreamer::requestLevels()
+{
+	std::vector<std::pair<uint32_t, Texture*>> requests;
+	int                                        pending = 0;
+
+	for (const auto &texture : TextureStreamer::textures)
+	{
+		const StreamedTexture &streamed = texture.second;
+
+		if (streamed.Pending)
+			pending++;
+		else if (!streamed.Failed && (streamed.WantedMip < streamed.ResidentMip))
+			requests.push_back({ (streamed.ResidentMip - streamed.WantedMip), texture.first });
+	}
+
+	// MOST MISSING LEVELS FIRST
+	std::sort(requests.begin(), requests.end(), [](const std::pair<uint32_t, Texture*> &a, const std::pair<uint32_t, Texture*> &b) {
+		return (a.first > b.first);
+	});
+
+	for (const auto &request : requests)
+	{
+		if (pending >= TextureStreamer::MaxLoads)
+			break;
+
+		Texture*         texture  = request.second;
+		StreamedTexture &streamed = TextureStreamer::textures[texture];
+		uint32_t         mip      = streamed.WantedMip;
+
+		// THE FINEST LEVEL THAT FITS IN THE BUDGET
+		while ((mip < streamed.ResidentMip) && !TextureStreamer::makeRoom((TextureStreamer::residentBytes(streamed, mip) - streamed.Bytes), texture))
+			mip++;
+
+		if (mip >= streamed.ResidentMip)
+			continue;
+
+		streamed.Pending  = true;
+		streamed.Reserved = (TextureStreamer::residentBytes(streamed, mip) - streamed.Bytes);
+
+		pending++;
+
+		std::vector<wxString> imageFiles = { texture->ImageFile() };
+		bool                  srgb       = texture->SRGB();
+		bool                  flipY      = texture->FlipY();
+		uint64_t              id         = streamed.ID;
+
+		TextureStreamer::jobs.push_back(JobSystem::Run([imageFiles, srgb, flipY, mip, id, texture]()
+		{
+			TextureStreamResult* result = new TextureStreamResult();
+			CompressedImage      image;
+
+			result->ID     = id;
+			result->Mip    = mip;
+			result->Result = TextureStreamer::Load(imageFiles, srgb, flipY, image);
+			result->Target = texture;
+
+			if ((result->Result == 0) && (mip < (uint32_t)image.Levels.size()))
+				result->Image = TextureStreamer::slice(image, mip);
+
+			std::lock_guard<std::mutex> lock(TextureStreamer::mutex);
+			TextureStreamer::ready.push_back(result);
+		}));
+	}
+}
+
+uint64_t TextureStreamer::residentBytes(const StreamedTexture &streamed, uint32_t mip)
+{
+	return TextureCompressor::TextureSize(
+		streamed.Format, std::max((streamed.Width >> mip), 1), std::max((streamed.Height >> mip), 1), 1, (streamed.MipLevels - mip)
+	);
+}
+
+std::vector<TextureResidency> TextureStreamer::Residency()
+{
+	std::vector<TextureResidency> residency;
+
+	for (const auto &texture : TextureStreamer::textures)
+	{
+		const StreamedTexture &streamed = texture.second;
+		TextureResidency       entry    = {};
+
+		entry.Bytes       = streamed.Bytes;
+		entry.File        = texture.first->ImageFile();
+		entry.Height      = streamed.Height;
+		entry.LastUsed    = streamed.LastUsed;
+		entry.MipLevels   = streamed.MipLevels;
+		entry.Pending     = streamed.Pending;
+		entry.ResidentMip = streamed.ResidentMip;
+		entry.TailMip     = streamed.TailMip;
+		entry.WantedMip   = streamed.WantedMip;
+		entry.Width       = streamed.Width;
+
+		residency.push_back(entry);
+	}
+
+	// LARGEST FIRST
+	std::sort(residency.begin(), residency.end(), [](const TextureResidency &a, const TextureResidency &b) {
+		return (a.Bytes > b.Bytes);
+	});
+
+	return residency;
+}
+
+// LEVELS mip TO THE END OF THE CHAIN, AS AN IMAGE OF ITS OWN
+CompressedImage TextureStreamer::slice(const CompressedImage &image, uint32_t mip)
+{
+	CompressedImage result;
+
+	mip = std::min(mip, (uint32_t)(image.Levels.size() - 1));
+
+	result.Format = image.Format;
+	result.Height = image.Levels[mip].Height;
+	result.Layers = image.Layers;
+	result.SRGB   = image.SRGB;
+	result.Width  = image.Levels[mip].Width;
+
+	result.Levels.assign((image.Levels.begin() + mip), image.Levels.end());
+
+	return result;
+}
+
+TextureStreamerStats TextureStreamer::Stats()
+{
+	TextureStreamerStats stats = TextureStreamer::stats;
+
+	stats.Budget   = TextureStreamer::Budget;
+	stats.Textures = (int)TextureStreamer::textures.size();
+
+	for (const auto &texture : TextureStreamer::textures)
+	{
+		const StreamedTexture &streamed = texture.second;
+
+		stats.BytesPending  += streamed.Reserved;
+		stats.BytesResident += streamed.Bytes;
+		stats.BytesWanted   += TextureStreamer::residentBytes(streamed, streamed.WantedMip);
+
+		if (streamed.Pending)
+			stats.Pending++;
+
+		if (streamed.ResidentMip == 0)
+			stats.TexturesFull++;
+		else if (streamed.ResidentMip == streamed.TailMip)
+			stats.TexturesTail++;
+	}
+
+	return stats;
+}
+
+json11::Json TextureStreamer::ToJSON()
+{
+	TextureStreamerStats stats = TextureStreamer::Stats();
+	json11::Json::array  textures;
+
+	for (const auto &texture : TextureStreamer::Residency())
+	{
+		textures.push_back(json11::Json::object {
+			{ "file",         texture.File.ToStdString() },
+			{ "width",        texture.Width },
+			{ "height",       texture.Height },
+			{ "mip_levels",   (int)texture.MipLevels },
+			{ "resident_mip", (int)texture.ResidentMip },
+			{ "wanted_mip",   (int)texture.WantedMip },
+			{ "tail_mip",     (int)texture.TailMip },
+			{ "pending",      texture.Pending },
+			{ "bytes",        (double)texture.Bytes },
+			{ "last_used",    (double)texture.LastUsed }
+		});
+	}
+
+	return json11::Json::object {
+		{ "budget",         (double)stats.Budget },
+		{ "bytes_resident", (double)stats.BytesResident },
+		{ "bytes_pending",  (double)stats.BytesPending },
+		{ "bytes_wanted",   (double)stats.BytesWanted },
+		{ "textures",       stats.Textures },
+		{ "textures_full",  stats.TexturesFull },
+		{ "textures_tail",  stats.TexturesTail },
+		{ "pending",        stats.Pending },
+		{ "uploads",        (double)stats.Uploads },
+		{ "evictions",      (double)stats.Evictions },
+		{ "loads_failed",   (double)stats.LoadsFailed },
+		{ "residency",      textures }
+	};
+}
+
+void TextureStreamer::Unregister(Texture* texture)
+{
+	TextureStreamer::textures.erase(texture);
+}
+
+void TextureStreamer::Update()
+{
+	PROFILE_SCOPE("TextureStreamer::Update");
+
+	if (!TextureStreamer::Enabled)
+		return;
+
+	TextureStreamer::frame++;
+
+	TextureStreamer::jobs.erase(std::remove_if(TextureStreamer::jobs.begin(), TextureStreamer::jobs.end(), [](const JobHandle &job) {
+		return JobSystem::IsDone(job);
+	}), TextureStreamer::jobs.end());
+
+	if (TextureStreamer::textures.empty())
+		return;
+
+	TextureStreamer::updateWanted();
+	TextureStreamer::uploadLevels();
+
+	// OVER BUDGET - FOR EXAMPLE AFTER THE BUDGET WAS LOWERED
+	TextureStreamer::makeRoom(0, nullptr);
+
+	TextureStreamer::requestLevels();
+}
+
+// THE MIP LEVEL WITH ABOUT ONE TEXEL PER PIXEL, FOR THE NEAREST MESH USING THE TEXTURE
+void TextureStreamer::updateWanted()
+{
+	for (auto &texture : TextureStreamer::textures)
+		texture.second.WantedMip = texture.second.TailMip;
+
+	for (auto component : RenderEngine::Renderables)
+	{
+		Mesh* mesh = dynamic_cast<Mesh*>(component);
+
+		// MESHES OUTSIDE THE VIEW DON'T KEEP THEIR TEXTURES RESIDENT OR RAISE THE WANTED LEVELS
+		if (!RenderEngine::IsInFrustum(mesh))
+			continue;
+
+		float screenSize = RenderEngine::GetScreenSize(mesh);
+
+		if (screenSize <= 0.0f)
+			continue;
+
+		for (int i = 0; i < MAX_TEXTURES; i++)
+		{
+			auto texture = TextureStreamer::textures.find(mesh->Textures[i]);
+
+			if (texture == TextureStreamer::textures.end())
+				continue;
+
+			StreamedTexture &streamed = texture->second;
+
+			// REPEATING TEXTURES ARE SAMPLED TextureScales TIMES ACROSS THE MESH
+			float    scale  = std::max(std::max(mesh->TextureScales[i].x, mesh->TextureScales[i].y), 1.0f);
+			float    texels = ((float)std::max(streamed.Width, streamed.Height) * scale);
+			uint32_t mip    = (texels > screenSize ? (uint32_t)std::floor(std::log2(texels / screenSize)) : 0);
+
+			streamed.LastUsed  = TextureStreamer::frame;
+			streamed.WantedMip = std::min(streamed.WantedMip, mip);
+		}
+	}
+}
+
+void TextureStreamer::uploadLevels()
+{
+	{
+		std::lock_guard<std::mutex> lock(TextureStreamer::mutex);
+
+		if (TextureStreamer::ready.empty())
+			return;
+	}
+
+	// CREATING THE TEXTURES NEEDS THE GL CONTEXT
+	RenderThreadLock renderLock;
+
+	uint64_t uploaded = 0;
+
+	// ALWAYS UPLOAD AT LEAST ONE TEXTURE PER FRAME, EVEN IF IT EXCEEDS THE BUDGET
+	while (true)
+	{
+		TextureStreamResult* result = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(TextureStreamer::mutex);
+
+			if (TextureStreamer::ready.empty())
+				break;
+
+			if ((uploaded > 0) && ((uploaded + TextureStreamer::ready.front()->Image.Size()) > TextureStreamer::UploadBudget))
+				break;
+
+			result = TextureStreamer::ready.front();
+
+			TextureStreamer::ready.pop_front();
+		}
+
+		// THE TEXTURE WAS DELETED OR RELOADED WHILE LOADING
+		auto texture = TextureStreamer::textures.find(result->Target);
+
+		if ((texture == TextureStreamer::textures.end()) || (texture->second.ID != result->ID)) {
+			_DELETEP(result);
+			continue;
+		}
+
+		StreamedTexture &streamed = texture->second;
+
+		streamed.Pending  = false;
+		streamed.Reserved = 0;
+
+		// THE SOURCE CHANGED ON DISK SINCE THE TEXTURE WAS CREATED
+		bool valid = ((result->Result == 0) && (result->Image.Format == streamed.Format) && ((uint32_t)result->Image.Levels.size() == (streamed.MipLevels - result->Mip)));
+
+		if (valid && (texture->first->UpdateLevels(result->Image) == 0))
+		{
+			streamed.Bytes       = result->Image.Size();
+			streamed.ResidentMip = result->Mip;
+
+			uploaded += streamed.Bytes;
+
+			TextureStreamer::stats.Uploads++;
+		}
+		else
+		{
+			streamed.Failed = true;
+
+			TextureStreamer::stats.LoadsFailed++;
+
+			if (valid)
+				TextureStreamer::evict(texture->first, streamed);
+		}
+
+		_DELETEP(result);
+	}
+}
@@ -0,0 +1,112 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_TEXTURESTREAMER_H
+#define S3DE_TEXTURESTREAMER_H
+
+struct StreamedTexture
+{
+	uint64_t           Bytes       = 0;	// RESIDENT GPU BYTES
+	bool               Failed      = false;
+	TextureCompression Format      = TEXTURE_COMPRESSION_NONE;
+	int                Height      = 0;	// LEVEL 0 OF THE FULL CHAIN
+	uint64_t           ID          = 0;
+	uint64_t           LastUsed    = 0;
+	uint32_t           MipLevels   = 0;	// FULL CHAIN
+	bool               Pending     = false;
+	uint64_t           Reserved    = 0;	// EXTRA BYTES OF THE PENDING LOAD
+	uint32_t           ResidentMip = 0;	// FIRST RESIDENT LEVEL OF THE FULL CHAIN
+	CompressedImage    Tail;				// THE LOW LEVELS - ALWAYS RESIDENT, EVICTION FALLS BACK TO THEM
+	uint32_t           TailMip     = 0;
+	uint32_t           WantedMip   = 0;
+	int                Width       = 0;
+};
+
+struct TextureStreamerStats
+{
+	uint64_t Budget        = 0;
+	uint64_t BytesPending  = 0;
+	uint64_t BytesResident = 0;
+	uint64_t BytesWanted   = 0;
+	uint64_t Evictions     = 0;
+	uint64_t LoadsFailed   = 0;
+	int      Pending       = 0;
+	int      Textures      = 0;
+	int      TexturesFull  = 0;
+	int      TexturesTail  = 0;
+	uint64_t Uploads       = 0;
+};
+
+struct TextureResidency
+{
+	uint64_t Bytes       = 0;
+	wxString File        = "";
+	int      Height      = 0;
+	uint64_t LastUsed    = 0;
+	uint32_t MipLevels   = 0;
+	bool     Pending     = false;
+	uint32_t ResidentMip = 0;
+	uint32_t TailMip     = 0;
+	uint32_t WantedMip   = 0;
+	int      Width       = 0;
+};
+
+struct TextureStreamResult
+{
+	uint64_t        ID     = 0;
+	CompressedImage Image;	// LEVELS Mip TO THE END OF THE CHAIN
+	uint32_t        Mip    = 0;
+	int             Result = 0;
+	Texture*        Target = nullptr;
+};
+
+// ONLY THE LOW MIP LEVELS OF 2D IMAGE TEXTURES ARE RESIDENT AFTER LOADING. THE HIGHER LEVELS ARE LOADED
+// ON THE JOB SYSTEM WHEN THE SCREEN SIZE OF THE MESHES USING THE TEXTURE NEEDS THEM, AND THE LEAST
+// RECENTLY USED TEXTURES FALL BACK TO THEIR LOW LEVELS WHEN THE RESIDENT BYTES EXCEED THE BUDGET.
+// MAIN THREAD ONLY, EXCEPT Load AND THE ready QUEUE (mutex) - STREAMED TEXTURES ARE CREATED AND DELETED BY TextureCache.
+class TextureStreamer
+{
+private:
+	TextureStreamer()  {}
+	~TextureStreamer() {}
+
+public:
+	static uint64_t Budget;
+	static bool     Enabled;
+	static int      MaxLoads;
+	static int      TailSize;
+	static uint64_t UploadBudget;
+
+private:
+	static uint64_t                                      frame;
+	static std::vector<JobHandle>                        jobs;
+	static std::mutex                                    mutex;
+	static uint64_t                                      nextID;
+	static std::deque<TextureStreamResult*>              ready;
+	static TextureStreamerStats                          stats;
+	static std::unordered_map<Texture*, StreamedTexture> textures;
+
+public:
+	static void                          Close();
+	static bool                          IsStreamed(Texture* texture);
+	static int                           Load(const std::vector<wxString> &imageFiles, bool srgb, bool flipY, CompressedImage &result);
+	static int                           Register(Texture* texture, const CompressedImage &image, CompressedImage &tail);
+	static std::vector<TextureResidency> Residency();
+	static TextureStreamerStats          Stats();
+	static json11::Json                  ToJSON();
+	static void                          Unregister(Texture* texture);
+	static void                          Update();
+
+private:
+	static void            evict(Texture* texture, StreamedTexture &streamed);
+	static bool            makeRoom(uint64_t bytes, Texture* keep);
+	static uint64_t        residentBytes(const StreamedTexture &streamed, uint32_t mip);
+	static void            requestLevels();
+	static CompressedImage slice(const CompressedImage &image, uint32_t mip);
+	static void            updateWanted();
+	static void            uploadLevels();
+
+};
+
+#endif
@@ -15,7 +15,7 @@ Water::Water(const wxString &modelFile, const std::vector<wxString> &textureImag
 		this->Children[0]->Name = "Water";
 
 		for (int i = 0; i < MAX_TEXTURES; i++)
-			this->Children[0]->LoadTexture(this->fbo->Textures[i], i);
+			this->Children[0]->LoadTexture(TextureCache::AddRef(this->fbo->Textures[i]), i, ((i == 2) || (i == 3) ? textureImageFiles[i - 2] : ""));
 
 		RenderEngine::Canvas.Window->SetStatusText("Loading Water ... OK");
 	} else {
@@ -25,8 +25,8 @@ WaterFBO::WaterFBO(const std::vector<wxString> &textureImageFiles)
     // TEXTURES
 	this->Textures[0] = this->reflectionFBO->GetTexture();
 	this->Textures[1] = this->refractionFBO->GetTexture();
-	this->Textures[2] = new Texture(textureImageFiles[0], false, true);
-	this->Textures[3] = new Texture(textureImageFiles[1], false, true);
+	this->Textures[2] = TextureCache::Acquire(textureImageFiles[0], false, true);
+	this->Textures[3] = TextureCache::Acquire(textureImageFiles[1], false, true);
 
 	for (int i = 4; i < MAX_TEXTURES; i++)
 		this->Textures[i] = SceneManager::EmptyTexture;
@@ -54,8 +54,8 @@ WaterFBO::~WaterFBO()
 	{
 		_DELETEP(this->reflectionFBO);
 		_DELETEP(this->refractionFBO);
-		_DELETEP(this->Textures[2]);
-		_DELETEP(this->Textures[3]);
+		TextureCache::Release(this->Textures[2]);
+		TextureCache::Release(this->Textures[3]);
 	}
 
 	for (int i = 0; i < MAX_TEXTURES; i++)
@@ -0,0 +1,350 @@
+#include "ImageDecoder.h"
+
+std::unordered_map<uint8_t*, size_t> ImageDecoder::buffers;
+std::mutex                           ImageDecoder::mutex;
+std::multimap<size_t, uint8_t*>      ImageDecoder::pool;
+size_t                               ImageDecoder::poolBytes = 0;
+
+static const size_t BUFFER_ALIGNMENT = 64;
+static const size_t POOL_MAX_BYTES   = (256ull << 20);
+static const size_t ROWS_PER_JOB     = 64;
+
+json11::Json ImageDecodeBenchmark::ToJSON() const
+{
+	return json11::Json::object {
+		{ "width",            this->Width },
+		{ "height",           this->Height },
+		{ "runs",             this->Runs },
+		{ "legacy_ms",        this->LegacyMS },
+		{ "to_rgba_ms",       this->ToRGBAMS },
+		{ "to_rgba_speedup",  (this->ToRGBAMS > 0.0 ? (this->LegacyMS / this->ToRGBAMS) : 0.0) },
+		{ "files",            this->Files },
+		{ "load_ms",          this->LoadMS },
+		{ "load_parallel_ms", this->LoadParallelMS }
+	};
+}
+
+// REUSES A POOLED BUFFER OF AT MOST TWICE THE REQUESTED SIZE
+uint8_t* ImageDecoder::Acquire(size_t size)
+{
+	if (size == 0)
+		return nullptr;
+
+	size = (((size + BUFFER_ALIGNMENT - 1) / BUFFER_ALIGNMENT) * BUFFER_ALIGNMENT);
+
+	{
+		std::lock_guard<std::mutex> lock(ImageDecoder::mutex);
+
+		auto pooled = ImageDecoder::pool.lower_bound(size);
+
+		if ((pooled != ImageDecoder::pool.end()) && (pooled->first <= (size * 2)))
+		{
+			uint8_t* buffer = pooled->second;
+
+			ImageDecoder::poolBytes -= pooled->first;
+			ImageDecoder::pool.erase(pooled);
+
+			return buffer;
+		}
+	}
+
+	#if defined _WINDOWS
+		uint8_t* buffer = static_cast<uint8_t*>(_aligned_malloc(size, BUFFER_ALIGNMENT));
+	#else
+		uint8_t* buffer = static_cast<uint8_t*>(std::aligned_alloc(BUFFER_ALIGNMENT, size));
+	#endif
+
+	if (buffer == nullptr)
+		return nullptr;
+
+	MemoryTracker::Allocate(buffer, MEMORY_TAG_TEXTURES, MEMORY_CPU, size);
+
+	std::lock_guard<std::mutex> lock(ImageDecoder::mutex);
+
+	ImageDecoder::buffers[buffer] = size;
+
+	return buffer;
+}
+
+void ImageDecoder::Close()
+{
+	std::lock_guard<std::mutex> lock(ImageDecoder::mutex);
+
+	for (const auto &pooled : ImageDecoder::pool)
+		ImageDecoder::freeBuffer(pooled.second);
+
+	ImageDecoder::pool.clear();
+
+	ImageDecoder::poolBytes = 0;
+}
+
+void ImageDecoder::expandRows(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY, uint8_t* result, int begin, int end)
+{
+	for (int y = begin; y < end; y++)
+	{
+		size_t         row         = (size_t)(flipY ? (height - 1 - y) : y);
+		const uint8_t* sourceRGB   = (rgb + (row * (size_t)width * 3));
+		const uint8_t* sourceAlpha = (alpha != nullptr ? (alpha + (row * (size_t)width)) : nullptr);
+		uint8_t*       output      = (result + ((size_t)y * (size_t)width * 4));
+
+		for (int x = 0; x < width; x++)
+		{
+			output[(x * 4) + 0] = sourceRGB[(x * 3) + 0];
+			output[(x * 4) + 1] = sourceRGB[(x * 3) + 1];
+			output[(x * 4) + 2] = sourceRGB[(x * 3) + 2];
+			output[(x * 4) + 3] = (sourceAlpha != nullptr ? sourceAlpha[x] : 0xFF);
+		}
+	}
+}
+
+#if defined S3DE_SSE2
+// 16 PIXELS PER ITERATION: 4 x (12 RGB BYTES -> 16 RGBA BYTES), THE ALPHA PLANE IS SHUFFLED INTO EVERY 4TH BYTE
+S3DE_TARGET_SSSE3 void ImageDecoder::expandRowsSSSE3(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY, uint8_t* result, int begin, int end)
+{
+	const __m128i opaque    = _mm_set1_epi32((int)0xFF000000);
+	const __m128i rgbToRGBA = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+
+	const __m128i alphaToRGBA[4] = {
+		_mm_setr_epi8(-1, -1, -1, 0,  -1, -1, -1, 1,  -1, -1, -1, 2,  -1, -1, -1, 3),
+		_mm_setr_epi8(-1, -1, -1, 4,  -1, -1, -1, 5,  -1, -1, -1, 6,  -1, -1, -1, 7),
+		_mm_setr_epi8(-1, -1, -1, 8,  -1, -1, -1, 9,  -1, -1, -1, 10, -1, -1, -1, 11),
+		_mm_setr_epi8(-1, -1, -1, 12, -1, -1, -1, 13, -1, -1, -1, 14, -1, -1, -1, 15)
+	};
+
+	for (int y = begin; y < end; y++)
+	{
+		size_t         row         = (size_t)(flipY ? (height - 1 - y) : y);
+		const uint8_t* sourceRGB   = (rgb + (row * (size_t)width * 3));
+		const uint8_t* sourceAlpha = (alpha != nullptr ? (alpha + (row * (size_t)width)) : nullptr);
+		uint8_t*       output      = (result + ((size_t)y * (size_t)width * 4));
+		int            x           = 0;
+
+		// THE LAST 16-BYTE RGB LOAD READS 4 BYTES PAST THE 16TH PIXEL
+		for (; (x + 18) <= width; x += 16)
+		{
+			__m128i alpha16 = (sourceAlpha != nullptr ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceAlpha + x)) : _mm_setzero_si128());
+
+			for (int i = 0; i < 4; i++)
+			{
+				__m128i pixels = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRGB + ((x + (i * 4)) * 3))), rgbToRGBA);
+
+				pixels = _mm_or_si128(pixels, (sourceAlpha != nullptr ? _mm_shuffle_epi8(alpha16, alphaToRGBA[i]) : opaque));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + ((x + (i * 4)) * 4)), pixels);
+			}
+		}
+
+		for (; x < width; x++)
+		{
+			output[(x * 4) + 0] = sourceRGB[(x * 3) + 0];
+			output[(x * 4) + 1] = sourceRGB[(x * 3) + 1];
+			output[(x * 4) + 2] = sourceRGB[(x * 3) + 2];
+			output[(x * 4) + 3] = (sourceAlpha != nullptr ? sourceAlpha[x] : 0xFF);
+		}
+	}
+}
+#else
+void ImageDecoder::expandRowsSSSE3(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY, uint8_t* result, int begin, int end)
+{
+	ImageDecoder::expandRows(rgb, alpha, width, height, flipY, result, begin, end);
+}
+#endif
+
+void ImageDecoder::freeBuffer(uint8_t* buffer)
+{
+	MemoryTracker::Free(buffer);
+
+	ImageDecoder::buffers.erase(buffer);
+
+	#if defined _WINDOWS
+		_aligned_free(buffer);
+	#else
+		std::free(buffer);
+	#endif
+}
+
+bool ImageDecoder::hasSSSE3()
+{
+	static const bool ssse3 = []()
+	{
+		#if defined S3DE_SSE2 && defined __GNUC__
+			unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+			return ((__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_SSSE3) != 0));
+		#elif defined S3DE_SSE2
+			int info[4] = {};
+			__cpuid(info, 1);
+			return ((info[2] & (1 << 9)) != 0);
+		#else
+			return false;
+		#endif
+	}();
+
+	return ssse3;
+}
+
+// BUFFERS OVER THE POOL LIMIT ARE FREED IMMEDIATELY
+void ImageDecoder::Release(uint8_t* buffer)
+{
+	if (buffer == nullptr)
+		return;
+
+	std::lock_guard<std::mutex> lock(ImageDecoder::mutex);
+
+	auto entry = ImageDecoder::buffers.find(buffer);
+
+	if (entry == ImageDecoder::buffers.end())
+		return;
+
+	if ((ImageDecoder::poolBytes + entry->second) > POOL_MAX_BYTES) {
+		ImageDecoder::freeBuffer(buffer);
+		return;
+	}
+
+	ImageDecoder::poolBytes += entry->second;
+	ImageDecoder::pool.insert({ entry->second, buffer });
+}
+
+// FLIPS VERTICALLY WHILE EXPANDING, INSTEAD OF MIRRORING THE IMAGE FIRST
+uint8_t* ImageDecoder::ToRGBA(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY)
+{
+	if ((rgb == nullptr) || (width < 1) || (height < 1))
+		return nullptr;
+
+	uint8_t* rgba = ImageDecoder::Acquire((size_t)width * (size_t)height * 4);
+
+	if (rgba == nullptr)
+		return nullptr;
+
+	bool ssse3 = ImageDecoder::hasSSSE3();
+
+	JobSystem::ParallelFor((size_t)height, ROWS_PER_JOB, [rgb, alpha, width, height, flipY, rgba, ssse3](size_t begin, size_t end)
+	{
+		if (ssse3)
+			ImageDecoder::expandRowsSSSE3(rgb, alpha, width, height, flipY, rgba, (int)begin, (int)end);
+		else
+			ImageDecoder::expandRows(rgb, alpha, width, height, flipY, rgba, (int)begin, (int)end);
+	});
+
+	return rgba;
+}
+
+// THE wxWidgets PARTS ARE LEFT OUT OF THE CPU-ONLY BENCHMARK TARGET
+#if !defined S3DE_CPU_ONLY
+// LEGACY: MIRROR + BYTE BY BYTE INTERLEAVE, NEW: SSSE3 SHUFFLE WITH THE FLIP IN THE ROW ORDER, OVER THE JOB SYSTEM
+ImageDecodeBenchmark ImageDecoder::Benchmark(int runs)
+{
+	using Clock = std::chrono::steady_clock;
+
+	const int WIDTH  = 4096;
+	const int HEIGHT = 4096;
+	const int FILES  = MAX_TEXTURES;
+
+	ImageDecodeBenchmark result = {};
+	wxImage              image(WIDTH, HEIGHT, false);
+
+	if (runs < 1)
+		return result;
+
+	image.InitAlpha();
+
+	uint8_t* rgb   = image.GetData();
+	uint8_t* alpha = image.GetAlpha();
+
+	for (int y = 0; y < HEIGHT; y++)
+	{
+		for (int x = 0; x < WIDTH; x++)
+		{
+			int i = (y * WIDTH + x);
+
+			rgb[(i * 3) + 0] = (uint8_t)x;
+			rgb[(i * 3) + 1] = (uint8_t)y;
+			rgb[(i * 3) + 2] = (uint8_t)(x ^ y);
+			alpha[i]         = (uint8_t)(x + y);
+		}
+	}
+
+	result.Files  = FILES;
+	result.Height = HEIGHT;
+	result.Runs   = runs;
+	result.Width  = WIDTH;
+
+	for (int i = 0; i < runs; i++)
+	{
+		auto start = Clock::now();
+
+		wxImage  mirrored = image.Mirror(false);
+		size_t   size     = ((size_t)WIDTH * (size_t)HEIGHT * 4);
+		uint8_t* legacy   = static_cast<uint8_t*>(std::malloc(size));
+
+		for (size_t p = 0, r = 0, a = 0; p < size; p += 4, r += 3, a++)
+		{
+			legacy[p + 0] = mirrored.GetData()[r + 0];
+			legacy[p + 1] = mirrored.GetData()[r + 1];
+			legacy[p + 2] = mirrored.GetData()[r + 2];
+			legacy[p + 3] = mirrored.GetAlpha()[a];
+		}
+
+		std::free(legacy);
+
+		result.LegacyMS += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		start = Clock::now();
+
+		ImageDecoder::Release(ImageDecoder::ToRGBA(image, true));
+
+		result.ToRGBAMS += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	result.LegacyMS /= (double)runs;
+	result.ToRGBAMS /= (double)runs;
+
+	// FILE DECODE - ONE CUBEMAP OF PNG FILES ON THE CALLING THREAD VS ON THE JOB SYSTEM
+	wxString file = "decode-benchmark.png";
+
+	if (!image.SaveFile(file, wxBITMAP_TYPE_PNG))
+		return result;
+
+	std::vector<wxString> files(FILES, file);
+
+	auto start = Clock::now();
+
+	for (const auto &imageFile : files) {
+		wxImage* loaded = Utils::LoadImageFile(imageFile);
+		_DELETEP(loaded);
+	}
+
+	result.LoadMS = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	start = Clock::now();
+
+	for (auto loaded : ImageDecoder::Load(files)) {
+		_DELETEP(loaded);
+	}
+
+	result.LoadParallelMS = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	wxRemoveFile(file);
+
+	return result;
+}
+
+// DECODES THE FILES ON THE JOB SYSTEM, wxImage (NOT wxBitmap) IS SAFE TO USE OUTSIDE THE UI THREAD
+std::vector<wxImage*> ImageDecoder::Load(const std::vector<wxString> &files)
+{
+	PROFILE_SCOPE("ImageDecoder::Load");
+
+	std::vector<wxImage*> images(files.size(), nullptr);
+
+	JobSystem::ParallelFor(files.size(), 1, [&files, &images](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++)
+			images[i] = Utils::LoadImageFile(files[i]);
+	});
+
+	return images;
+}
+
+uint8_t* ImageDecoder::ToRGBA(const wxImage &image, bool flipY)
+{
+	return ImageDecoder::ToRGBA(image.GetData(), image.GetAlpha(), image.GetWidth(), image.GetHeight(), flipY);
+}
+#endif
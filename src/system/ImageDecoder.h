@@ -0,0 +1,56 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_IMAGEDECODER_H
+#define S3DE_IMAGEDECODER_H
+
+struct ImageDecodeBenchmark
+{
+	int    Files          = 0;
+	int    Height         = 0;
+	double LegacyMS       = 0.0;
+	double LoadMS         = 0.0;
+	double LoadParallelMS = 0.0;
+	int    Runs           = 0;
+	double ToRGBAMS       = 0.0;
+	int    Width          = 0;
+
+	json11::Json ToJSON() const;
+};
+
+// DECODES IMAGE FILES ON THE JOB SYSTEM AND EXPANDS THEM TO RGBA8 (SSSE3 WHEN AVAILABLE).
+// THE RGBA8 BUFFERS ARE 64-BYTE ALIGNED AND POOLED - RETURN THEM WITH Release, NOT free.
+class ImageDecoder
+{
+private:
+	ImageDecoder()  {}
+	~ImageDecoder() {}
+
+private:
+	static std::unordered_map<uint8_t*, size_t> buffers;
+	static std::mutex                           mutex;
+	static std::multimap<size_t, uint8_t*>      pool;
+	static size_t                               poolBytes;
+
+public:
+	static uint8_t*              Acquire(size_t size);
+	static void                  Close();
+	static void                  Release(uint8_t* buffer);
+	static uint8_t*              ToRGBA(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY = false);
+
+#if !defined S3DE_CPU_ONLY
+	static ImageDecodeBenchmark  Benchmark(int runs = 5);
+	static std::vector<wxImage*> Load(const std::vector<wxString> &files);
+	static uint8_t*              ToRGBA(const wxImage &image, bool flipY = false);
+#endif
+
+private:
+	static void expandRows(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY, uint8_t* result, int begin, int end);
+	static void expandRowsSSSE3(const uint8_t* rgb, const uint8_t* alpha, int width, int height, bool flipY, uint8_t* result, int begin, int end);
+	static void freeBuffer(uint8_t* buffer);
+	static bool hasSSSE3();
+
+};
+
+#endif
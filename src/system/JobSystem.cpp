@@ -0,0 +1,291 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+
+std::condition_variable  JobSystem::condition;
+std::mutex               JobSystem::mutex;
+std::atomic<int>         JobSystem::queued(0);
+std::vector<JobQueue*>   JobSystem::queues;
+std::atomic<bool>        JobSystem::running(false);
+thread_local int         JobSystem::threadIndex = 0;
+std::vector<std::thread> JobSystem::workers;
+
+JobBenchmark JobSystem::Benchmark(int jobs)
+{
+	using Clock = std::chrono::steady_clock;
+
+	JobBenchmark result = {};
+
+	if (!JobSystem::running || (jobs < 1))
+		return result;
+
+	result.Jobs    = jobs;
+	result.Threads = JobSystem::NrOfThreads();
+
+	// THROUGHPUT - EMPTY CHILD JOBS OF A SINGLE ROOT
+	auto start = Clock::now();
+	auto root  = JobSystem::Create(nullptr);
+
+	for (int i = 0; i < jobs; i++)
+		JobSystem::Run([]() {}, root);
+
+	JobSystem::finish(root);
+	JobSystem::Wait(root);
+
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	result.ThroughputJobsPerSec = (seconds > 0.0 ? ((double)jobs / seconds) : 0.0);
+
+	// LATENCY - TIME FROM SUBMITTING A JOB UNTIL A WORKER STARTS IT
+	const int           samples = 1000;
+	std::vector<double> latencies(samples);
+
+	for (int i = 0; i < samples; i++)
+	{
+		auto submitted = Clock::now();
+		auto job       = JobSystem::Run([&latencies, i, submitted]() {
+			latencies[i] = std::chrono::duration<double, std::micro>(Clock::now() - submitted).count();
+		});
+
+		while (!JobSystem::IsDone(job))
+			std::this_thread::yield();
+	}
+
+	for (auto latency : latencies) {
+		result.LatencyAvgUS += latency;
+		result.LatencyMaxUS  = std::max(result.LatencyMaxUS, latency);
+	}
+
+	result.LatencyAvgUS /= (double)samples;
+
+	// PARALLEL FOR - SERIAL VS PARALLEL OVER THE SAME WORK
+	const size_t       count = (1 << 22);
+	std::vector<float> values(count);
+
+	auto work = [&values](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; i++)
+			values[i] = std::sqrt((float)i) * std::sin((float)i);
+	};
+
+	start = Clock::now();
+	work(0, count);
+	result.ParallelForSerialMS = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	start = Clock::now();
+	JobSystem::ParallelFor(count, 0, work);
+	result.ParallelForMS = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+	result.ParallelForSpeedup = (result.ParallelForMS > 0.0 ? (result.ParallelForSerialMS / result.ParallelForMS) : 0.0);
+
+	return result;
+}
+
+void JobSystem::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(JobSystem::mutex);
+		JobSystem::running = false;
+	}
+
+	JobSystem::condition.notify_all();
+
+	for (auto &worker : JobSystem::workers) {
+		if (worker.joinable())
+			worker.join();
+	}
+
+	JobSystem::workers.clear();
+
+	for (auto queue : JobSystem::queues)
+		delete queue;
+
+	JobSystem::queues.clear();
+	JobSystem::queued = 0;
+}
+
+JobHandle JobSystem::Create(const std::function<void()> &task, const JobHandle &parent)
+{
+	if (parent != nullptr)
+		parent->Unfinished++;
+
+	return std::make_shared<Job>(task, parent);
+}
+
+void JobSystem::execute(const JobHandle &job)
+{
+	if (job->Task)
+		job->Task();
+
+	JobSystem::finish(job);
+}
+
+void JobSystem::finish(const JobHandle &job)
+{
+	if ((--job->Unfinished == 0) && (job->Parent != nullptr))
+		JobSystem::finish(job->Parent);
+}
+
+JobHandle JobSystem::getJob()
+{
+	if (JobSystem::queued <= 0)
+		return nullptr;
+
+	int index = JobSystem::threadIndex;
+	int count = (int)JobSystem::queues.size();
+
+	// OWN QUEUE - NEWEST FIRST
+	{
+		JobQueue* queue = JobSystem::queues[index];
+
+		std::lock_guard<std::mutex> lock(queue->Mutex);
+
+		if (!queue->Jobs.empty()) {
+			JobHandle job = queue->Jobs.back();
+			queue->Jobs.pop_back();
+			JobSystem::queued--;
+
+			return job;
+		}
+	}
+
+	// STEAL FROM THE OTHER QUEUES - OLDEST FIRST
+	for (int i = 1; i < count; i++)
+	{
+		JobQueue* queue = JobSystem::queues[(index + i) % count];
+
+		std::lock_guard<std::mutex> lock(queue->Mutex);
+
+		if (!queue->Jobs.empty()) {
+			JobHandle job = queue->Jobs.front();
+			queue->Jobs.pop_front();
+			JobSystem::queued--;
+
+			return job;
+		}
+	}
+
+	return nullptr;
+}
+
+int JobSystem::Init(int nrOfThreads)
+{
+	if (JobSystem::running)
+		JobSystem::Close();
+
+	if (nrOfThreads < 1)
+		nrOfThreads = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+
+	// QUEUE 0 IS SHARED BY THE MAIN THREAD AND ANY THREAD OUTSIDE THE POOL
+	for (int i = 0; i <= nrOfThreads; i++)
+		JobSystem::queues.push_back(new JobQueue());
+
+	JobSystem::running = true;
+
+	for (int i = 1; i <= nrOfThreads; i++)
+		JobSystem::workers.push_back(std::thread(JobSystem::work, i));
+
+	return 0;
+}
+
+bool JobSystem::IsDone(const JobHandle &job)
+{
+	return ((job == nullptr) || (job->Unfinished <= 0));
+}
+
+int JobSystem::NrOfThreads()
+{
+	return ((int)JobSystem::workers.size() + 1);
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain, const std::function<void(size_t begin, size_t end)> &task)
+{
+	if (count == 0)
+		return;
+
+	if (!JobSystem::running) {
+		task(0, count);
+		return;
+	}
+
+	if (grain == 0)
+		grain = std::max(count / ((size_t)JobSystem::NrOfThreads() * 4), (size_t)1);
+
+	auto root = JobSystem::Create(nullptr);
+
+	for (size_t begin = 0; begin < count; begin += grain)
+	{
+		size_t end = std::min((begin + grain), count);
+		JobSystem::Run([&task, begin, end]() { task(begin, end); }, root);
+	}
+
+	JobSystem::finish(root);
+	JobSystem::Wait(root);
+}
+
+void JobSystem::Run(const JobHandle &job)
+{
+	if (job == nullptr)
+		return;
+
+	// NOT INITIALIZED - RUN THE JOB IMMEDIATELY ON THE CALLING THREAD
+	if (!JobSystem::running) {
+		JobSystem::execute(job);
+		return;
+	}
+
+	JobQueue* queue = JobSystem::queues[JobSystem::threadIndex];
+
+	{
+		std::lock_guard<std::mutex> lock(queue->Mutex);
+
+		queue->Jobs.push_back(job);
+		JobSystem::queued++;
+	}
+
+	JobSystem::condition.notify_one();
+}
+
+JobHandle JobSystem::Run(const std::function<void()> &task, const JobHandle &parent)
+{
+	JobHandle job = JobSystem::Create(task, parent);
+
+	JobSystem::Run(job);
+
+	return job;
+}
+
+void JobSystem::Wait(const JobHandle &job)
+{
+	// KEEP THE WAITING THREAD BUSY WITH OTHER JOBS INSTEAD OF BLOCKING IT
+	while (!JobSystem::IsDone(job))
+	{
+		JobHandle next = JobSystem::getJob();
+
+		if (next != nullptr)
+			JobSystem::execute(next);
+		else
+			std::this_thread::yield();
+	}
+}
+
+void JobSystem::work(int index)
+{
+	JobSystem::threadIndex = index;
+
+	PROFILE_THREAD("Job Worker " + std::to_string(index));
+
+	while (JobSystem::running)
+	{
+		JobHandle job = JobSystem::getJob();
+
+		if (job != nullptr) {
+			JobSystem::execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(JobSystem::mutex);
+
+		JobSystem::condition.wait_for(lock, std::chrono::milliseconds(1), []() {
+			return ((JobSystem::queued > 0) || !JobSystem::running);
+		});
+	}
+}
@@ -0,0 +1,88 @@
+#ifndef S3DE_JOBSYSTEM_H
+#define S3DE_JOBSYSTEM_H
+
+// THE JOB SYSTEM ONLY DEPENDS ON THE C++ STANDARD LIBRARY (NO WXWIDGETS)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct Job;
+
+using JobHandle = std::shared_ptr<Job>;
+
+struct Job
+{
+	JobHandle             Parent;
+	std::function<void()> Task;
+	std::atomic<int>      Unfinished;
+
+	Job(const std::function<void()> &task, const JobHandle &parent)
+	{
+		this->Parent     = parent;
+		this->Task       = task;
+		this->Unfinished = 1;
+	}
+};
+
+struct JobBenchmark
+{
+	int    Jobs                 = 0;
+	double LatencyAvgUS         = 0.0;
+	double LatencyMaxUS         = 0.0;
+	double ParallelForSerialMS  = 0.0;
+	double ParallelForMS        = 0.0;
+	double ParallelForSpeedup   = 0.0;
+	double ThroughputJobsPerSec = 0.0;
+	int    Threads              = 0;
+};
+
+struct JobQueue
+{
+	std::deque<JobHandle> Jobs;
+	std::mutex            Mutex;
+};
+
+class JobSystem
+{
+private:
+	JobSystem()  {}
+	~JobSystem() {}
+
+private:
+	static std::condition_variable  condition;
+	static std::mutex               mutex;
+	static std::atomic<int>         queued;
+	static std::vector<JobQueue*>   queues;
+	static std::atomic<bool>        running;
+	static thread_local int         threadIndex;
+	static std::vector<std::thread> workers;
+
+public:
+	static JobBenchmark Benchmark(int jobs = 100000);
+	static void         Close();
+	static JobHandle    Create(const std::function<void()> &task, const JobHandle &parent = nullptr);
+	static int          Init(int nrOfThreads = 0);
+	static bool         IsDone(const JobHandle &job);
+	static int          NrOfThreads();
+	static void         ParallelFor(size_t count, size_t grain, const std::function<void(size_t begin, size_t end)> &task);
+	static void         Run(const JobHandle &job);
+	static JobHandle    Run(const std::function<void()> &task, const JobHandle &parent = nullptr);
+	static void         Wait(const JobHandle &job);
+
+private:
+	static void      execute(const JobHandle &job);
+	static void      finish(const JobHandle &job);
+	static JobHandle getJob();
+	static void      work(int index);
+
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include "MemoryTracker.h"
+
+std::unordered_map<const void*, std::vector<MemoryAllocation>> MemoryTracker::allocations;
+std::map<wxString, MemoryAsset>                                 MemoryTracker::assets;
+wxString                                                        MemoryTracker::logFile     = "";
+long                                                            MemoryTracker::logInterval = 0;
+long                                                            MemoryTracker::logTime     = 0;
+std::mutex                                                      MemoryTracker::mutex;
+MemoryUsage                                                     MemoryTracker::totals[NR_OF_MEMORY_DOMAINS];
+MemoryUsage                                                     MemoryTracker::usage[NR_OF_MEMORY_TAGS][NR_OF_MEMORY_DOMAINS];
+
+void MemoryTracker::Allocate(const void* owner, MemoryTag tag, MemoryDomain domain, uint64_t bytes, const wxString &asset)
+{
+	if ((owner == nullptr) || (bytes == 0))
+		return;
+
+	MemoryAllocation allocation = {};
+
+	allocation.Asset  = asset;
+	allocation.Bytes  = bytes;
+	allocation.Domain = domain;
+	allocation.Tag    = tag;
+
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	MemoryTracker::allocations[owner].push_back(allocation);
+
+	MemoryUsage &tagUsage   = MemoryTracker::usage[tag][domain];
+	MemoryUsage &totalUsage = MemoryTracker::totals[domain];
+
+	tagUsage.Current   += bytes;
+	tagUsage.Peak       = std::max(tagUsage.Peak, tagUsage.Current);
+	totalUsage.Current += bytes;
+	totalUsage.Peak     = std::max(totalUsage.Peak, totalUsage.Current);
+
+	if (!asset.empty())
+		MemoryTracker::assets[asset].Bytes[domain] += bytes;
+}
+
+std::map<wxString, MemoryAsset> MemoryTracker::Assets()
+{
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	return MemoryTracker::assets;
+}
+
+// RELEASES EVERYTHING ALLOCATED BY THE OWNER
+void MemoryTracker::Free(const void* owner)
+{
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	auto owned = MemoryTracker::allocations.find(owner);
+
+	if (owned == MemoryTracker::allocations.end())
+		return;
+
+	for (const auto &allocation : owned->second)
+	{
+		MemoryTracker::usage[allocation.Tag][allocation.Domain].Current -= allocation.Bytes;
+		MemoryTracker::totals[allocation.Domain].Current                -= allocation.Bytes;
+
+		if (allocation.Asset.empty())
+			continue;
+
+		auto asset = MemoryTracker::assets.find(allocation.Asset);
+
+		if (asset == MemoryTracker::assets.end())
+			continue;
+
+		asset->second.Bytes[allocation.Domain] -= allocation.Bytes;
+
+		if ((asset->second.Bytes[MEMORY_CPU] == 0) && (asset->second.Bytes[MEMORY_GPU] == 0))
+			MemoryTracker::assets.erase(asset);
+	}
+
+	MemoryTracker::allocations.erase(owned);
+}
+
+void MemoryTracker::StartLog(const wxString &file, long intervalMS)
+{
+	MemoryTracker::logFile     = file;
+	MemoryTracker::logInterval = intervalMS;
+	MemoryTracker::logTime     = 0;
+
+	// TRUNCATE THE LOG FROM ANY PREVIOUS RUN
+	std::wofstream fileStream(file.wc_str(), std::ios::trunc);
+}
+
+wxString MemoryTracker::TagName(MemoryTag tag)
+{
+	switch (tag) {
+		case MEMORY_TAG_MESHES:       return "meshes";
+		case MEMORY_TAG_TEXTURES:     return "textures";
+		case MEMORY_TAG_FRAMEBUFFERS: return "framebuffers";
+		case MEMORY_TAG_UNIFORMS:     return "uniforms";
+		case MEMORY_TAG_SCENE:        return "scene";
+		default: throw;
+	}
+
+	return "";
+}
+
+// 4 BYTES PER TEXEL, INCLUDING THE FULL MIP CHAIN
+uint64_t MemoryTracker::TextureSize(int width, int height, uint32_t layers, uint32_t mipLevels)
+{
+	uint64_t bytes = 0;
+
+	for (uint32_t i = 0; i < std::max(mipLevels, 1u); i++)
+	{
+		bytes += ((uint64_t)width * (uint64_t)height * 4);
+
+		width  = std::max((width  / 2), 1);
+		height = std::max((height / 2), 1);
+	}
+
+	return (bytes * layers);
+}
+
+json11::Json MemoryTracker::ToJSON()
+{
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	json11::Json::object tagsJSON;
+	json11::Json::object assetsJSON;
+
+	for (int i = 0; i < NR_OF_MEMORY_TAGS; i++)
+	{
+		tagsJSON[MemoryTracker::TagName((MemoryTag)i).ToStdString()] = json11::Json::object {
+			{ "cpu_bytes",      (double)MemoryTracker::usage[i][MEMORY_CPU].Current },
+			{ "cpu_peak_bytes", (double)MemoryTracker::usage[i][MEMORY_CPU].Peak },
+			{ "gpu_bytes",      (double)MemoryTracker::usage[i][MEMORY_GPU].Current },
+			{ "gpu_peak_bytes", (double)MemoryTracker::usage[i][MEMORY_GPU].Peak }
+		};
+	}
+
+	for (const auto &asset : MemoryTracker::assets)
+	{
+		assetsJSON[asset.first.ToStdString()] = json11::Json::object {
+			{ "cpu_bytes", (double)asset.second.Bytes[MEMORY_CPU] },
+			{ "gpu_bytes", (double)asset.second.Bytes[MEMORY_GPU] }
+		};
+	}
+
+	return json11::Json::object {
+		{ "cpu_bytes",      (double)MemoryTracker::totals[MEMORY_CPU].Current },
+		{ "cpu_peak_bytes", (double)MemoryTracker::totals[MEMORY_CPU].Peak },
+		{ "gpu_bytes",      (double)MemoryTracker::totals[MEMORY_GPU].Current },
+		{ "gpu_peak_bytes", (double)MemoryTracker::totals[MEMORY_GPU].Peak },
+		{ "tags",           tagsJSON },
+		{ "assets",         assetsJSON }
+	};
+}
+
+MemoryUsage MemoryTracker::Total(MemoryDomain domain)
+{
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	return MemoryTracker::totals[domain];
+}
+
+// APPENDS A LINE TO THE LOG FILE EVERY LOG INTERVAL
+void MemoryTracker::Update()
+{
+	if (MemoryTracker::logFile.empty() || (MemoryTracker::logInterval <= 0))
+		return;
+
+	long now = TimeManager::TimeElapsedMS();
+
+	if ((MemoryTracker::logTime > 0) && ((now - MemoryTracker::logTime) < MemoryTracker::logInterval))
+		return;
+
+	MemoryTracker::logTime = std::max(now, 1L);
+
+	wxString line = wxString::Format("%.1f s", ((double)now / 1000.0));
+
+	{
+		std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+		line.append(wxString::Format(
+			" | total cpu %.2f MB (peak %.2f MB) gpu %.2f MB (peak %.2f MB)",
+			((double)MemoryTracker::totals[MEMORY_CPU].Current / 1048576.0), ((double)MemoryTracker::totals[MEMORY_CPU].Peak / 1048576.0),
+			((double)MemoryTracker::totals[MEMORY_GPU].Current / 1048576.0), ((double)MemoryTracker::totals[MEMORY_GPU].Peak / 1048576.0)
+		));
+
+		for (int i = 0; i < NR_OF_MEMORY_TAGS; i++)
+		{
+			line.append(wxString::Format(
+				" | %s cpu %.2f MB gpu %.2f MB", MemoryTracker::TagName((MemoryTag)i),
+				((double)MemoryTracker::usage[i][MEMORY_CPU].Current / 1048576.0), ((double)MemoryTracker::usage[i][MEMORY_GPU].Current / 1048576.0)
+			));
+		}
+	}
+
+	std::wofstream fileStream(MemoryTracker::logFile.wc_str(), std::ios::app);
+
+	if (fileStream.good())
+		fileStream << line.wc_str() << std::endl;
+}
+
+MemoryUsage MemoryTracker::Usage(MemoryTag tag, MemoryDomain domain)
+{
+	std::lock_guard<std::mutex> lock(MemoryTracker::mutex);
+
+	return MemoryTracker::usage[tag][domain];
+}
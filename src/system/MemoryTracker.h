@@ -0,0 +1,67 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_MEMORYTRACKER_H
+#define S3DE_MEMORYTRACKER_H
+
+enum MemoryTag
+{
+	MEMORY_TAG_MESHES, MEMORY_TAG_TEXTURES, MEMORY_TAG_FRAMEBUFFERS, MEMORY_TAG_UNIFORMS, MEMORY_TAG_SCENE, NR_OF_MEMORY_TAGS
+};
+
+enum MemoryDomain
+{
+	MEMORY_CPU, MEMORY_GPU, NR_OF_MEMORY_DOMAINS
+};
+
+struct MemoryAllocation
+{
+	wxString     Asset  = "";
+	uint64_t     Bytes  = 0;
+	MemoryDomain Domain = MEMORY_CPU;
+	MemoryTag    Tag    = MEMORY_TAG_SCENE;
+};
+
+struct MemoryAsset
+{
+	uint64_t Bytes[NR_OF_MEMORY_DOMAINS] = {};
+};
+
+struct MemoryUsage
+{
+	uint64_t Current = 0;
+	uint64_t Peak    = 0;
+};
+
+class MemoryTracker
+{
+private:
+	MemoryTracker()  {}
+	~MemoryTracker() {}
+
+private:
+	static std::unordered_map<const void*, std::vector<MemoryAllocation>> allocations;
+	static std::map<wxString, MemoryAsset>                                 assets;
+	static wxString                                                        logFile;
+	static long                                                            logInterval;
+	static long                                                            logTime;
+	static std::mutex                                                      mutex;
+	static MemoryUsage                                                     totals[NR_OF_MEMORY_DOMAINS];
+	static MemoryUsage                                                     usage[NR_OF_MEMORY_TAGS][NR_OF_MEMORY_DOMAINS];
+
+public:
+	static void                            Allocate(const void* owner, MemoryTag tag, MemoryDomain domain, uint64_t bytes, const wxString &asset = "");
+	static std::map<wxString, MemoryAsset> Assets();
+	static void                            Free(const void* owner);
+	static void                            StartLog(const wxString &file, long intervalMS);
+	static wxString                        TagName(MemoryTag tag);
+	static uint64_t                        TextureSize(int width, int height, uint32_t layers, uint32_t mipLevels);
+	static json11::Json                    ToJSON();
+	static MemoryUsage                     Total(MemoryDomain domain);
+	static void                            Update();
+	static MemoryUsage                     Usage(MemoryTag tag, MemoryDomain domain);
+
+};
+
+#endif
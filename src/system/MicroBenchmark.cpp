@@ -0,0 +1,306 @@
+#include "MicroBenchmark.h"
+
+double          MicroBenchmark::MinTimeMS = 100.0;
+volatile double MicroBenchmark::sink      = 0.0;
+
+#if !defined S3DE_CPU_ONLY
+// EXPOSES THE PROTECTED ASSIMP CONVERSION WITHOUT UPLOADING ANY GPU BUFFERS
+class BenchmarkMesh : public Mesh
+{
+public:
+	using Mesh::loadModelData;
+
+	size_t Size() { return (this->indices.size() + this->normals.size() + this->textureCoords.size() + this->vertices.size()); }
+};
+#endif
+
+// MARKS RESULTS SLOWER THAN THE BASELINE BY MORE THAN THE THRESHOLD AS REGRESSIONS
+int MicroBenchmark::Compare(std::vector<MicroBenchmarkResult> &results, const std::string &baselineFile, double thresholdPct)
+{
+	std::ifstream fileStream(baselineFile);
+
+	if (!fileStream.good())
+		return -1;
+
+	std::string  baselineText((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+	std::string  error;
+	json11::Json baselineJSON = json11::Json::parse(baselineText, error);
+
+	if (!error.empty() || !baselineJSON["benchmarks"].is_array())
+		return -2;
+
+	int regressions = 0;
+
+	for (auto &result : results)
+	{
+		for (const auto &baseline : baselineJSON["benchmarks"].array_items())
+		{
+			if ((baseline["name"].string_value() != result.Name) || (baseline["ns_per_op"].number_value() <= 0.0))
+				continue;
+
+			result.BaselineNS = baseline["ns_per_op"].number_value();
+			result.ChangePct  = (((result.NsPerOp - result.BaselineNS) / result.BaselineNS) * 100.0);
+			result.Regression = (result.ChangePct > thresholdPct);
+
+			if (result.Regression)
+				regressions++;
+
+			break;
+		}
+	}
+
+	return regressions;
+}
+
+std::vector<MicroBenchmarkResult> MicroBenchmark::Run()
+{
+	std::vector<MicroBenchmarkResult> results;
+
+	// THE CPU-ONLY TARGET (CMakeLists.txt) ONLY BUILDS THE IMAGE DECODER, MIP GENERATOR, TEXTURE COMPRESSOR AND JOB SYSTEM
+#if !defined S3DE_CPU_ONLY
+	// SCENE DATA - THERE IS NO WINDOW OR GRAPHICS DEVICE, SO THE BENCHMARKS SET UP THEIR OWN CANVAS SIZE AND CAMERA
+	RenderEngine::Canvas.Size = wxSize(1280, 720);
+
+	Camera camera;
+	RenderEngine::CameraMain = &camera;
+
+	// NOISE
+	int noiseX = 0;
+
+	results.push_back(MicroBenchmark::run("noise_height", [&noiseX]() {
+		noiseX++;
+		return (double)Noise::Height(noiseX, (noiseX / 7), 4, 2.0f);
+	}));
+
+	// TERRAIN
+	int tileX = 0;
+
+	results.push_back(MicroBenchmark::run("terrain_generate_tile_33", [&tileX]() {
+		TerrainTileData* tile   = TerrainStreamer::GenerateTile(tileX++, 0, 33, 4, 2.0f);
+		double           result = (double)tile->Vertices.size();
+
+		_DELETEP(tile);
+
+		return result;
+	}));
+
+	// MESH DATA
+	const unsigned int GRID = 64;
+
+	aiMesh* aiGrid = new aiMesh();
+
+	aiGrid->mNumVertices      = (GRID * GRID);
+	aiGrid->mVertices         = new aiVector3D[aiGrid->mNumVertices];
+	aiGrid->mNormals          = new aiVector3D[aiGrid->mNumVertices];
+	aiGrid->mTextureCoords[0] = new aiVector3D[aiGrid->mNumVertices];
+	aiGrid->mNumFaces         = ((GRID - 1) * (GRID - 1) * 2);
+	aiGrid->mFaces            = new aiFace[aiGrid->mNumFaces];
+
+	for (unsigned int z = 0; z < GRID; z++) {
+		for (unsigned int x = 0; x < GRID; x++) {
+			aiGrid->mVertices[z * GRID + x]         = aiVector3D((float)x, 0.0f, (float)z);
+			aiGrid->mNormals[z * GRID + x]          = aiVector3D(0.0f, 1.0f, 0.0f);
+			aiGrid->mTextureCoords[0][z * GRID + x] = aiVector3D(((float)x / (float)GRID), ((float)z / (float)GRID), 0.0f);
+		}
+	}
+
+	for (unsigned int z = 0, face = 0; z < (GRID - 1); z++) {
+		for (unsigned int x = 0; x < (GRID - 1); x++, face += 2) {
+			unsigned int topLeft = (z * GRID + x);
+
+			aiGrid->mFaces[face].mNumIndices     = 3;
+			aiGrid->mFaces[face].mIndices        = new unsigned int[3] { topLeft, (topLeft + GRID), (topLeft + 1) };
+			aiGrid->mFaces[face + 1].mNumIndices = 3;
+			aiGrid->mFaces[face + 1].mIndices    = new unsigned int[3] { (topLeft + 1), (topLeft + GRID), (topLeft + GRID + 1) };
+		}
+	}
+
+	results.push_back(MicroBenchmark::run("mesh_load_model_data_64x64", [aiGrid]() {
+		BenchmarkMesh mesh;
+		mesh.loadModelData(aiGrid);
+		return (double)mesh.Size();
+	}));
+
+	_DELETEP(aiGrid);
+
+	// VERTEX BUFFER DATA
+	std::vector<float> vertices, normals, texCoords;
+
+	for (unsigned int i = 0; i < (GRID * GRID); i++)
+	{
+		vertices.insert(vertices.end(),   { (float)(i % GRID), 0.0f, (float)(i / GRID) });
+		normals.insert(normals.end(),     { 0.0f, 1.0f, 0.0f });
+		texCoords.insert(texCoords.end(), { ((float)(i % GRID) / (float)GRID), ((float)(i / GRID) / (float)GRID) });
+	}
+
+	results.push_back(MicroBenchmark::run("utils_to_vertex_buffer_data_64x64", [&vertices, &normals, &texCoords]() {
+		return (double)Utils::ToVertexBufferData(vertices, normals, texCoords).size();
+	}));
+
+#endif
+
+	// IMAGE CONVERSION
+	std::vector<uint8_t> imageRGB(512 * 512 * 3);
+	std::vector<uint8_t> imageAlpha(512 * 512);
+
+	for (int y = 0; y < 512; y++) {
+		for (int x = 0; x < 512; x++) {
+			int i = (y * 512 + x);
+
+			imageRGB[(i * 3) + 0] = (uint8_t)(x & 0xFF);
+			imageRGB[(i * 3) + 1] = (uint8_t)(y & 0xFF);
+			imageRGB[(i * 3) + 2] = (uint8_t)((x ^ y) & 0xFF);
+			imageAlpha[i]         = (uint8_t)((x + y) & 0xFF);
+		}
+	}
+
+	results.push_back(MicroBenchmark::run("image_decoder_to_rgba_512x512", [&imageRGB, &imageAlpha]() {
+		uint8_t* rgba   = ImageDecoder::ToRGBA(imageRGB.data(), imageAlpha.data(), 512, 512, true);
+		double   result = (rgba != nullptr ? (double)rgba[0] : 0.0);
+
+		ImageDecoder::Release(rgba);
+
+		return result;
+	}));
+
+	// MIP CHAIN AND BLOCK COMPRESSION
+	uint8_t* rgba = ImageDecoder::ToRGBA(imageRGB.data(), imageAlpha.data(), 512, 512);
+
+	if (rgba != nullptr)
+	{
+		const TextureCompression formats[]     = { TEXTURE_COMPRESSION_BC1, TEXTURE_COMPRESSION_BC7, TEXTURE_COMPRESSION_ETC2_RGBA };
+		const char*              formatNames[] = { "bc1", "bc7", "etc2_rgba" };
+
+		for (int i = 0; i < 3; i++)
+		{
+			TextureCompression format = formats[i];
+
+			results.push_back(MicroBenchmark::run(std::string("texture_compress_").append(formatNames[i]).append("_512x512"), [rgba, format]() {
+				CompressedImage result;
+				TextureCompressor::Compress({ rgba }, 512, 512, format, false, false, result);
+				return (double)result.Size();
+			}));
+		}
+
+		results.push_back(MicroBenchmark::run("mip_generate_srgb_512x512", [rgba]() {
+			return (double)MipGenerator::Generate(rgba, 512, 512, true, MipGenerator::LevelCount(512, 512)).size();
+		}));
+
+		ImageDecoder::Release(rgba);
+	}
+
+#if !defined S3DE_CPU_ONLY
+	// COMPRESSION
+	std::vector<uint8_t> data(65536);
+
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = (uint8_t)((i * 31) ^ (i >> 5));
+
+	std::vector<uint8_t> compressed = Utils::Compress(data);
+
+	results.push_back(MicroBenchmark::run("utils_compress_64kb", [&data]() {
+		return (double)Utils::Compress(data).size();
+	}));
+
+	results.push_back(MicroBenchmark::run("utils_decompress_64kb", [&compressed]() {
+		return (double)Utils::Decompress(compressed).size();
+	}));
+
+	// RAY CASTING - THROUGH THE CENTER OF THE CANVAS
+	RayCast ray((RenderEngine::Canvas.Size.GetWidth() / 2), (RenderEngine::Canvas.Size.GetHeight() / 2));
+
+	results.push_back(MicroBenchmark::run("raycast_intersect_aabb", [&ray]() {
+		return (double)ray.RayIntersectAABB(glm::vec3(-1.0f), glm::vec3(1.0f));
+	}));
+
+	results.push_back(MicroBenchmark::run("raycast_intersect_sphere", [&ray]() {
+		return (double)ray.RayIntersectSphere(glm::vec3(-1.0f), glm::vec3(1.0f));
+	}));
+
+	// COMPONENT TRANSFORMS
+	BenchmarkMesh mesh;
+
+	results.push_back(MicroBenchmark::run("component_update_matrix", [&mesh]() {
+		mesh.RotateBy(glm::vec3(0.01f, 0.02f, 0.0f));
+		return (double)mesh.Matrix()[0][0];
+	}));
+
+	// CONSTANT BUFFERS
+	results.push_back(MicroBenchmark::run("cb_matrix", [&mesh]() {
+		return (double)CBMatrix(&mesh, false).MVP[0][0];
+	}));
+
+	DrawProperties properties = {};
+
+	results.push_back(MicroBenchmark::run("cb_default", [&mesh, &properties]() {
+		return (double)CBDefault(&mesh, properties).MeshDiffuse.r;
+	}));
+
+	RenderEngine::CameraMain = nullptr;
+#endif
+
+	return results;
+}
+
+// DOUBLES THE ITERATIONS UNTIL A BATCH RUNS FOR AT LEAST THE MINIMUM TIME
+MicroBenchmarkResult MicroBenchmark::run(const std::string &name, const std::function<double()> &function)
+{
+	MicroBenchmarkResult result = {};
+	double               sum    = function();
+
+	result.Name = name;
+
+	for (uint64_t iterations = 1; ; iterations *= 2)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (uint64_t i = 0; i < iterations; i++)
+			sum += function();
+
+		double timeNS = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+		if ((timeNS >= (MicroBenchmark::MinTimeMS * 1000000.0)) || (iterations >= (1ull << 32)))
+		{
+			result.Iterations = iterations;
+			result.NsPerOp    = (timeNS / (double)iterations);
+
+			break;
+		}
+	}
+
+	MicroBenchmark::sink = sum;
+
+	return result;
+}
+
+json11::Json MicroBenchmark::ToJSON(const std::vector<MicroBenchmarkResult> &results, double thresholdPct)
+{
+	json11::Json::array benchmarksJSON;
+	int                 regressions = 0;
+
+	for (const auto &result : results)
+	{
+		json11::Json::object resultJSON = {
+			{ "name",       result.Name },
+			{ "iterations", (double)result.Iterations },
+			{ "ns_per_op",  result.NsPerOp }
+		};
+
+		if (result.BaselineNS > 0.0) {
+			resultJSON["baseline_ns_per_op"] = result.BaselineNS;
+			resultJSON["change_pct"]         = result.ChangePct;
+			resultJSON["regression"]         = result.Regression;
+		}
+
+		if (result.Regression)
+			regressions++;
+
+		benchmarksJSON.push_back(resultJSON);
+	}
+
+	return json11::Json::object {
+		{ "threshold_pct", thresholdPct },
+		{ "regressions",   regressions },
+		{ "benchmarks",    benchmarksJSON }
+	};
+}
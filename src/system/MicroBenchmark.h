@@ -0,0 +1,42 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_MICROBENCHMARK_H
+#define S3DE_MICROBENCHMARK_H
+
+struct MicroBenchmarkResult
+{
+	double      BaselineNS = 0.0;
+	double      ChangePct  = 0.0;
+	uint64_t    Iterations = 0;
+	std::string Name       = "";
+	double      NsPerOp    = 0.0;
+	bool        Regression = false;
+};
+
+// RUN BY THE STANDALONE Simple3DEngineBench CONSOLE TARGET (src/bench/main.cpp) - CPU ONLY, WITHOUT A WINDOW OR A GRAPHICS DEVICE.
+// CMakeLists.txt BUILDS A REDUCED S3DE_CPU_ONLY VERSION WITHOUT wxWidgets, WITH ONLY THE IMAGE AND TEXTURE BENCHMARKS.
+class MicroBenchmark
+{
+private:
+	MicroBenchmark()  {}
+	~MicroBenchmark() {}
+
+public:
+	static double MinTimeMS;
+
+private:
+	static volatile double sink;
+
+public:
+	static int                               Compare(std::vector<MicroBenchmarkResult> &results, const std::string &baselineFile, double thresholdPct);
+	static std::vector<MicroBenchmarkResult> Run();
+	static json11::Json                      ToJSON(const std::vector<MicroBenchmarkResult> &results, double thresholdPct);
+
+private:
+	static MicroBenchmarkResult run(const std::string &name, const std::function<double()> &function);
+
+};
+
+#endif
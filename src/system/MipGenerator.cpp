@@ -0,0 +1,272 @@
+#include "MipGenerator.h"
+
+float MipGenerator::AlphaCutoff = 0.5f;
+
+// AT MOST THIS FRACTION OF PARTIALLY TRANSPARENT TEXELS IN A CUTOUT, MORE MEANS ALPHA BLENDING
+static const float CUTOUT_MAX_PARTIAL = 0.1f;
+
+// ROWS PER JOB, SMALLER LEVELS ARE FILTERED ON THE CALLING THREAD
+static const size_t MIP_ROWS_PER_JOB = 32;
+
+// 12-BIT LINEAR TO SRGB TABLE
+static const int SRGB_TABLE_SIZE = 4096;
+
+float MipGenerator::coverage(const uint8_t* pixels, int width, int height, float scale)
+{
+	size_t count   = ((size_t)width * (size_t)height);
+	size_t covered = 0;
+	float  cutoff  = (MipGenerator::AlphaCutoff * 255.0f);
+
+	for (size_t i = 0; i < count; i++) {
+		if (((float)pixels[(i * 4) + 3] * scale) > cutoff)
+			covered++;
+	}
+
+	return ((float)covered / (float)count);
+}
+
+// 2x2 BOX FILTER, THE LAST ROW/COLUMN IS REPEATED FOR ODD SIZES
+MipLevel MipGenerator::downsample(const uint8_t* pixels, int width, int height, bool srgb)
+{
+	MipLevel level;
+
+	level.Width  = std::max((width  / 2), 1);
+	level.Height = std::max((height / 2), 1);
+
+	level.Pixels.resize((size_t)level.Width * (size_t)level.Height * 4);
+
+	uint8_t* result   = level.Pixels.data();
+	int      mipWidth = level.Width;
+
+	JobSystem::ParallelFor((size_t)level.Height, MIP_ROWS_PER_JOB, [pixels, width, height, srgb, result, mipWidth](size_t begin, size_t end)
+	{
+		if (srgb)
+			MipGenerator::downsampleRowsSRGB(pixels, width, height, result, mipWidth, (int)begin, (int)end);
+		else
+			MipGenerator::downsampleRows(pixels, width, height, result, mipWidth, (int)begin, (int)end);
+	});
+
+	return level;
+}
+
+void MipGenerator::downsampleRows(const uint8_t* pixels, int width, int height, uint8_t* result, int mipWidth, int begin, int end)
+{
+	for (int y = begin; y < end; y++)
+	{
+		const uint8_t* row0   = (pixels + ((size_t)std::min((y * 2),     (height - 1)) * (size_t)width * 4));
+		const uint8_t* row1   = (pixels + ((size_t)std::min((y * 2 + 1), (height - 1)) * (size_t)width * 4));
+		uint8_t*       output = (result + ((size_t)y * (size_t)mipWidth * 4));
+		int            x      = 0;
+
+		#if defined S3DE_SSE2
+		const __m128i zero  = _mm_setzero_si128();
+		const __m128i round = _mm_set1_epi16(2);
+
+		// 2 OUTPUT PIXELS FROM 4x2 SOURCE PIXELS, 16-BIT SUMS
+		for (; ((x * 2) + 3) < width; x += 2)
+		{
+			__m128i top    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + (x * 8)));
+			__m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + (x * 8)));
+			__m128i left   = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+			__m128i right  = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+
+			left  = _mm_add_epi16(left,  _mm_srli_si128(left,  8));
+			right = _mm_add_epi16(right, _mm_srli_si128(right, 8));
+
+			__m128i sum = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(left, right), round), 2);
+
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + (x * 4)), _mm_packus_epi16(sum, zero));
+		}
+		#endif
+
+		for (; x < mipWidth; x++)
+		{
+			int x0 = (std::min((x * 2),     (width - 1)) * 4);
+			int x1 = (std::min((x * 2 + 1), (width - 1)) * 4);
+
+			for (int c = 0; c < 4; c++)
+				output[(x * 4) + c] = (uint8_t)((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
+		}
+	}
+}
+
+// THE COLOR IS AVERAGED IN LINEAR SPACE, ALPHA IS ALWAYS LINEAR
+void MipGenerator::downsampleRowsSRGB(const uint8_t* pixels, int width, int height, uint8_t* result, int mipWidth, int begin, int end)
+{
+	const float*   toLinear = MipGenerator::srgbToLinear();
+	const uint8_t* toSRGB   = MipGenerator::linearToSRGB();
+
+	for (int y = begin; y < end; y++)
+	{
+		const uint8_t* row0   = (pixels + ((size_t)std::min((y * 2),     (height - 1)) * (size_t)width * 4));
+		const uint8_t* row1   = (pixels + ((size_t)std::min((y * 2 + 1), (height - 1)) * (size_t)width * 4));
+		uint8_t*       output = (result + ((size_t)y * (size_t)mipWidth * 4));
+
+		for (int x = 0; x < mipWidth; x++)
+		{
+			int            x0        = (std::min((x * 2),     (width - 1)) * 4);
+			int            x1        = (std::min((x * 2 + 1), (width - 1)) * 4);
+			const uint8_t* source[4] = { (row0 + x0), (row0 + x1), (row1 + x0), (row1 + x1) };
+			float          average[4];
+
+			#if defined S3DE_SSE2
+			__m128 sum = _mm_setzero_ps();
+
+			for (int i = 0; i < 4; i++)
+				sum = _mm_add_ps(sum, _mm_set_ps((float)source[i][3], toLinear[source[i][2]], toLinear[source[i][1]], toLinear[source[i][0]]));
+
+			_mm_storeu_ps(average, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+			#else
+			for (int c = 0; c < 4; c++)
+				average[c] = 0.0f;
+
+			for (int i = 0; i < 4; i++) {
+				for (int c = 0; c < 3; c++)
+					average[c] += toLinear[source[i][c]];
+
+				average[3] += (float)source[i][3];
+			}
+
+			for (int c = 0; c < 4; c++)
+				average[c] *= 0.25f;
+			#endif
+
+			for (int c = 0; c < 3; c++)
+				output[(x * 4) + c] = toSRGB[(int)((average[c] * (float)(SRGB_TABLE_SIZE - 1)) + 0.5f)];
+
+			output[(x * 4) + 3] = (uint8_t)(average[3] + 0.5f);
+		}
+	}
+}
+
+// RETURNS LEVEL 1 TO (mipLevels - 1), LEVEL 0 IS THE SOURCE IMAGE
+std::vector<MipLevel> MipGenerator::Generate(const uint8_t* pixels, int width, int height, bool srgb, uint32_t mipLevels)
+{
+	std::vector<MipLevel> levels;
+
+	if ((pixels == nullptr) || (width < 1) || (height < 1) || (mipLevels < 2))
+		return levels;
+
+	bool  cutout   = MipGenerator::IsCutout(pixels, width, height);
+	float coverage = (cutout ? MipGenerator::coverage(pixels, width, height, 1.0f) : 0.0f);
+
+	// CUTOUT LEVELS ARE FILTERED FROM THE UNSCALED PREVIOUS LEVEL, SO THE ALPHA SCALE DOES NOT ACCUMULATE
+	const uint8_t*       source = pixels;
+	std::vector<uint8_t> unscaled;
+
+	levels.reserve(mipLevels - 1);
+
+	for (uint32_t i = 1; i < mipLevels; i++)
+	{
+		MipLevel level = MipGenerator::downsample(source, width, height, srgb);
+
+		width  = level.Width;
+		height = level.Height;
+
+		if (cutout) {
+			unscaled = level.Pixels;
+			MipGenerator::scaleAlpha(level, coverage);
+		}
+
+		levels.push_back(std::move(level));
+
+		source = (cutout ? unscaled.data() : levels.back().Pixels.data());
+	}
+
+	return levels;
+}
+
+// MOSTLY FULLY OPAQUE AND FULLY TRANSPARENT TEXELS, WITH SOME OF EACH
+bool MipGenerator::IsCutout(const uint8_t* pixels, int width, int height)
+{
+	if (pixels == nullptr)
+		return false;
+
+	size_t count       = ((size_t)width * (size_t)height);
+	size_t opaque      = 0;
+	size_t transparent = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		uint8_t alpha = pixels[(i * 4) + 3];
+
+		if (alpha >= 0xF0)
+			opaque++;
+		else if (alpha <= 0x0F)
+			transparent++;
+	}
+
+	size_t partial = (count - opaque - transparent);
+
+	return ((opaque > 0) && (transparent > 0) && ((float)partial <= ((float)count * CUTOUT_MAX_PARTIAL)));
+}
+
+uint32_t MipGenerator::LevelCount(int width, int height)
+{
+	if ((width < 1) || (height < 1))
+		return 1;
+
+	return ((uint32_t)(std::floor(std::log2(std::max(width, height)))) + 1);
+}
+
+const uint8_t* MipGenerator::linearToSRGB()
+{
+	static const std::vector<uint8_t> table = []()
+	{
+		std::vector<uint8_t> values(SRGB_TABLE_SIZE);
+
+		for (int i = 0; i < SRGB_TABLE_SIZE; i++)
+		{
+			float linear = ((float)i / (float)(SRGB_TABLE_SIZE - 1));
+			float srgb   = (linear <= 0.0031308f ? (linear * 12.92f) : ((1.055f * std::pow(linear, (1.0f / 2.4f))) - 0.055f));
+
+			values[i] = (uint8_t)((std::min(std::max(srgb, 0.0f), 1.0f) * 255.0f) + 0.5f);
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
+
+// BINARY SEARCH FOR THE ALPHA SCALE THAT GIVES THE LEVEL THE SAME COVERAGE AS THE BASE LEVEL
+void MipGenerator::scaleAlpha(MipLevel &level, float coverage)
+{
+	float maxScale = 4.0f;
+	float minScale = 0.0f;
+	float scale    = 1.0f;
+
+	for (int i = 0; i < 10; i++)
+	{
+		float current = MipGenerator::coverage(level.Pixels.data(), level.Width, level.Height, scale);
+
+		if (current < coverage)
+			minScale = scale;
+		else if (current > coverage)
+			maxScale = scale;
+		else
+			break;
+
+		scale = ((minScale + maxScale) * 0.5f);
+	}
+
+	for (size_t i = 3; i < level.Pixels.size(); i += 4)
+		level.Pixels[i] = (uint8_t)std::min((((float)level.Pixels[i] * scale) + 0.5f), 255.0f);
+}
+
+const float* MipGenerator::srgbToLinear()
+{
+	static const std::vector<float> table = []()
+	{
+		std::vector<float> values(256);
+
+		for (int i = 0; i < 256; i++) {
+			float srgb = ((float)i / 255.0f);
+			values[i]  = (srgb <= 0.04045f ? (srgb / 12.92f) : std::pow(((srgb + 0.055f) / 1.055f), 2.4f));
+		}
+
+		return values;
+	}();
+
+	return table.data();
+}
@@ -0,0 +1,42 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_MIPGENERATOR_H
+#define S3DE_MIPGENERATOR_H
+
+struct MipLevel
+{
+	int                  Height = 0;
+	std::vector<uint8_t> Pixels;	// RGBA8
+	int                  Width  = 0;
+};
+
+// BUILDS THE MIP CHAIN OF AN RGBA8 IMAGE ON THE CPU, SO ALL GRAPHICS APIS SAMPLE THE SAME LEVELS.
+// SRGB IMAGES ARE AVERAGED IN LINEAR SPACE, CUTOUTS KEEP THE ALPHA TEST COVERAGE OF THE BASE LEVEL.
+class MipGenerator
+{
+private:
+	MipGenerator()  {}
+	~MipGenerator() {}
+
+public:
+	static float AlphaCutoff;
+
+public:
+	static std::vector<MipLevel> Generate(const uint8_t* pixels, int width, int height, bool srgb, uint32_t mipLevels);
+	static bool                  IsCutout(const uint8_t* pixels, int width, int height);
+	static uint32_t              LevelCount(int width, int height);
+
+private:
+	static float          coverage(const uint8_t* pixels, int width, int height, float scale);
+	static MipLevel       downsample(const uint8_t* pixels, int width, int height, bool srgb);
+	static void           downsampleRows(const uint8_t* pixels, int width, int height, uint8_t* result, int mipWidth, int begin, int end);
+	static void           downsampleRowsSRGB(const uint8_t* pixels, int width, int height, uint8_t* result, int mipWidth, int begin, int end);
+	static const uint8_t* linearToSRGB();
+	static void           scaleAlpha(MipLevel &level, float coverage);
+	static const float*   srgbToLinear();
+
+};
+
+#endif
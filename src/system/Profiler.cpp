@@ -0,0 +1,135 @@
+#include "Profiler.h"
+
+std::vector<ProfileBuffer*>           Profiler::buffers;
+std::atomic<bool>                     Profiler::enabled(false);
+std::chrono::steady_clock::time_point Profiler::startTime;
+int64_t                               Profiler::startTicks = 0;
+std::chrono::steady_clock::time_point Profiler::stopTime;
+int64_t                               Profiler::stopTicks  = 0;
+std::mutex                            Profiler::mutex;
+thread_local ProfileBuffer*           Profiler::threadBuffer = nullptr;
+
+// THE OWNING THREADS KEEP WRITING THE HEAD, SO CLEARING ONLY MOVES THE TAIL UP TO IT
+void Profiler::Clear()
+{
+	std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+	for (auto buffer : Profiler::buffers)
+		buffer->Tail = buffer->Head.load(std::memory_order_acquire);
+}
+
+ProfileBuffer* Profiler::GetBuffer()
+{
+	if (Profiler::threadBuffer != nullptr)
+		return Profiler::threadBuffer;
+
+	// BUFFERS ARE NEVER FREED - THEY ARE OWNED BY THE PROFILER FOR THE LIFETIME OF THE PROCESS
+	ProfileBuffer* buffer = new ProfileBuffer();
+
+	{
+		std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+		buffer->ThreadID = (uint32_t)Profiler::buffers.size();
+		Profiler::buffers.push_back(buffer);
+	}
+
+	Profiler::threadBuffer = buffer;
+
+	return buffer;
+}
+
+bool Profiler::IsEnabled()
+{
+	return Profiler::enabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetThreadName(const std::string &name)
+{
+	ProfileBuffer* buffer = Profiler::GetBuffer();
+
+	std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+	buffer->Name = name;
+}
+
+void Profiler::Start()
+{
+	Profiler::Clear();
+
+	{
+		std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+		Profiler::startTicks = Profiler::Now();
+		Profiler::startTime  = std::chrono::steady_clock::now();
+	}
+
+	Profiler::enabled = true;
+}
+
+void Profiler::Stop()
+{
+	Profiler::enabled = false;
+
+	std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+	Profiler::stopTicks = Profiler::Now();
+	Profiler::stopTime  = std::chrono::steady_clock::now();
+}
+
+// CHROME TRACE EVENT FORMAT - OPEN IN chrome://tracing OR https://ui.perfetto.dev
+std::string Profiler::ToJSON()
+{
+	if (Profiler::enabled)
+		Profiler::Stop();
+
+	std::lock_guard<std::mutex> lock(Profiler::mutex);
+
+	// CONVERT THE MARKER TICKS TO MICROSECONDS
+	double      elapsedUS = std::chrono::duration<double, std::micro>(Profiler::stopTime - Profiler::startTime).count();
+	int64_t     ticks     = (Profiler::stopTicks - Profiler::startTicks);
+	double      ticksToUS = (ticks > 0 ? (elapsedUS / (double)ticks) : 0.0);
+	std::string json      = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool        first     = true;
+	char        line[512];
+
+	for (auto buffer : Profiler::buffers)
+	{
+		if (!buffer->Name.empty())
+		{
+			std::snprintf(
+				line, sizeof(line),
+				"%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+				(first ? "" : ","), buffer->ThreadID, buffer->Name.c_str()
+			);
+
+			json.append(line);
+			first = false;
+		}
+
+		uint64_t head  = buffer->Head.load(std::memory_order_acquire);
+		uint64_t count = std::min((head - std::min(buffer->Tail, head)), (uint64_t)PROFILE_BUFFER_SIZE);
+
+		for (uint64_t i = (head - count); i < head; i++)
+		{
+			const ProfileEvent &event = buffer->Events[i % PROFILE_BUFFER_SIZE];
+
+			int length = std::snprintf(
+				line, sizeof(line),
+				"%s{\"name\":\"%s\",\"cat\":\"S3DE\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%d",
+				(first ? "" : ","), event.Name, buffer->ThreadID, ((double)(event.Start - Profiler::startTicks) * ticksToUS), ((double)(event.End - event.Start) * ticksToUS), event.Depth
+			);
+
+			if (event.Index >= 0)
+				std::snprintf((line + length), (sizeof(line) - length), ",\"index\":%d", event.Index);
+
+			json.append(line);
+			json.append("}}");
+
+			first = false;
+		}
+	}
+
+	json.append("]}");
+
+	return json;
+}
@@ -0,0 +1,140 @@
+#ifndef S3DE_PROFILER_H
+#define S3DE_PROFILER_H
+
+// THE PROFILER ONLY DEPENDS ON THE C++ STANDARD LIBRARY (NO WXWIDGETS)
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined _MSC_VER
+	#include <intrin.h>
+#elif defined __x86_64__ || defined __i386__
+	#include <x86intrin.h>
+#endif
+
+// REMOVE S3DE_PROFILE FROM THE PREPROCESSOR DEFINITIONS TO COMPILE ALL MARKERS OUT
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b)       PROFILE_CONCAT_INNER(a, b)
+
+#if defined S3DE_PROFILE
+	#define PROFILE_SCOPE(...)       ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(__VA_ARGS__)
+	#define PROFILE_THREAD(name)     Profiler::SetThreadName(name)
+#else
+	#define PROFILE_SCOPE(...)
+	#define PROFILE_THREAD(name)
+#endif
+
+const uint32_t PROFILE_BUFFER_SIZE = (1 << 15);
+
+struct ProfileEvent
+{
+	int32_t     Depth;
+	int64_t     End;
+	int32_t     Index;
+	const char* Name;
+	int64_t     Start;
+};
+
+// SINGLE PRODUCER RING BUFFER - ONLY THE OWNING THREAD WRITES, OLDEST EVENTS ARE OVERWRITTEN
+struct ProfileBuffer
+{
+	int32_t               Depth = 0;
+	ProfileEvent          Events[PROFILE_BUFFER_SIZE];
+	std::atomic<uint64_t> Head;
+	std::string           Name;
+	uint64_t              Tail     = 0;	// FIRST EVENT AFTER THE LAST CLEAR - ONLY ACCESSED UNDER THE PROFILER MUTEX
+	uint32_t              ThreadID = 0;
+
+	ProfileBuffer() : Head(0) {}
+};
+
+class Profiler
+{
+private:
+	Profiler()  {}
+	~Profiler() {}
+
+private:
+	static std::vector<ProfileBuffer*>           buffers;
+	static std::atomic<bool>                     enabled;
+	static std::chrono::steady_clock::time_point startTime;
+	static int64_t                               startTicks;
+	static std::chrono::steady_clock::time_point stopTime;
+	static int64_t                               stopTicks;
+	static std::mutex                            mutex;
+	static thread_local ProfileBuffer*           threadBuffer;
+
+public:
+	static void        Clear();
+	static bool        IsEnabled();
+	static int64_t     Now()
+	{
+		// CPU TIMESTAMP COUNTER WHERE AVAILABLE - CALIBRATED AGAINST THE STEADY CLOCK WHEN EXPORTING
+		#if defined _M_X64 || defined _M_IX86 || defined __x86_64__ || defined __i386__
+			return (int64_t)__rdtsc();
+		#else
+			return (int64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+		#endif
+	}
+	static void        SetThreadName(const std::string &name);
+	static void        Start();
+	static void        Stop();
+	static std::string ToJSON();
+
+	static ProfileBuffer* GetBuffer();
+
+};
+
+// RAII MARKER - RECORDS THE TIME BETWEEN CONSTRUCTION AND DESTRUCTION
+class ProfileScope
+{
+public:
+	ProfileScope(const char* name, int index = -1)
+	{
+		if (!Profiler::IsEnabled()) {
+			this->buffer = nullptr;
+			return;
+		}
+
+		this->buffer = Profiler::GetBuffer();
+		this->index  = index;
+		this->name   = name;
+		this->depth  = this->buffer->Depth++;
+		this->start  = Profiler::Now();
+	}
+
+	~ProfileScope()
+	{
+		if (this->buffer == nullptr)
+			return;
+
+		int64_t  end  = Profiler::Now();
+		uint64_t head = this->buffer->Head.load(std::memory_order_relaxed);
+
+		ProfileEvent &event = this->buffer->Events[head % PROFILE_BUFFER_SIZE];
+
+		event.Depth = this->depth;
+		event.End   = end;
+		event.Index = this->index;
+		event.Name  = this->name;
+		event.Start = this->start;
+
+		this->buffer->Depth--;
+		this->buffer->Head.store((head + 1), std::memory_order_release);
+	}
+
+private:
+	ProfileBuffer* buffer;
+	int32_t        depth;
+	int32_t        index;
+	const char*    name;
+	int64_t        start;
+
+};
+
+#endif
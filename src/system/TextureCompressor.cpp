@@ -0,0 +1,1219 @@
+#include "TextureCompressor.h"
+
+bool TextureCompressor::Enabled = true;
+
+// BUMP WHEN THE ENCODERS OR MIP FILTERS CHANGE TO INVALIDATE THE CACHED FILES
+static const uint32_t KTX2_CACHE_VERSION = 2;
+static const uint8_t  KTX2_ID[12]        = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+static const size_t   KTX2_HEADER_SIZE   = 80;
+static const size_t   KTX2_LEVEL_SIZE    = 24;
+
+static const int BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static const int EAC_MODIFIERS[16][8] = {
+	{ -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+	{ -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9,  -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+	{ -2, -6, -8, -10, 1, 5, 7, 9 },  { -2, -5, -8,  -10, 1, 4, 7, 9 },  { -2, -4, -8, -10, 1, 3, 7, 9 },  { -2, -5, -7, -10, 1, 4, 6, 9 },
+	{ -3, -4, -7, -10, 2, 3, 6, 9 },  { -1, -2, -3,  -10, 0, 1, 2, 9 },  { -4, -6, -8, -9,  3, 5, 7, 8 },  { -3, -5, -7, -9,  2, 4, 6, 8 }
+};
+
+// PIXEL INDEX 0: +SMALL, 1: +LARGE, 2: -SMALL, 3: -LARGE
+static const int ETC_MODIFIERS[8][4] = {
+	{ 2, 8, -2, -8 },     { 5, 17, -5, -17 },   { 9, 29, -9, -29 },   { 13, 42, -13, -42 },
+	{ 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+bool CompressedImage::HasAlpha() const
+{
+	if ((this->Format == TEXTURE_COMPRESSION_NONE) && !this->Levels.empty())
+		return TextureCompressor::HasAlpha(this->Levels[0].Data.data(), this->Levels[0].Width, this->Levels[0].Height);
+
+	return ((this->Format == TEXTURE_COMPRESSION_BC3) || (this->Format == TEXTURE_COMPRESSION_BC7) || (this->Format == TEXTURE_COMPRESSION_ETC2_RGBA));
+}
+
+uint64_t CompressedImage::Size() const
+{
+	uint64_t size = 0;
+
+	for (const auto &level : this->Levels)
+		size += level.Data.size();
+
+	return size;
+}
+
+uint32_t TextureCompressor::BlockBytes(TextureCompression format)
+{
+	switch (format) {
+		case TEXTURE_COMPRESSION_BC1:       return 8;
+		case TEXTURE_COMPRESSION_BC3:       return 16;
+		case TEXTURE_COMPRESSION_BC5:       return 16;
+		case TEXTURE_COMPRESSION_BC7:       return 16;
+		case TEXTURE_COMPRESSION_ETC2_RGB:  return 8;
+		case TEXTURE_COMPRESSION_ETC2_RGBA: return 16;
+		default: break;
+	}
+
+	return 0;
+}
+
+// TEXTURE_COMPRESSION_NONE KEEPS THE RGBA8 LEVELS, SO EVERY BACKEND UPLOADS THE SAME CPU MIP CHAIN
+int TextureCompressor::Compress(const std::vector<uint8_t*> &pixels, int width, int height, TextureCompression format, bool srgb, bool mipmaps, CompressedImage &result)
+{
+	if (pixels.empty() || (width < 1) || (height < 1) || ((format != TEXTURE_COMPRESSION_NONE) && (TextureCompressor::BlockBytes(format) == 0)))
+		return -1;
+
+	for (auto layer : pixels) {
+		if (layer == nullptr)
+			return -2;
+	}
+
+	uint32_t mipLevels = (mipmaps ? MipGenerator::LevelCount(width, height) : 1);
+	uint32_t layers    = (uint32_t)pixels.size();
+
+	result        = {};
+	result.Format = format;
+	result.Height = height;
+	result.Layers = (int)layers;
+	result.SRGB   = srgb;
+	result.Width  = width;
+
+	result.Levels.resize(mipLevels);
+
+	for (uint32_t layer = 0; layer < layers; layer++)
+	{
+		std::vector<MipLevel> chain     = MipGenerator::Generate(pixels[layer], width, height, srgb, mipLevels);
+		const uint8_t*        source    = pixels[layer];
+		int                   mipWidth  = width;
+		int                   mipHeight = height;
+
+		for (uint32_t level = 0; level < mipLevels; level++)
+		{
+			if (level > 0) {
+				source    = chain[level - 1].Pixels.data();
+				mipWidth  = chain[level - 1].Width;
+				mipHeight = chain[level - 1].Height;
+			}
+
+			CompressedLevel &mipLevel  = result.Levels[level];
+			size_t           layerSize = (size_t)TextureCompressor::TextureSize(format, mipWidth, mipHeight, 1, 1);
+
+			if (layer == 0) {
+				mipLevel.Width  = mipWidth;
+				mipLevel.Height = mipHeight;
+				mipLevel.Data.resize(layerSize * layers);
+			}
+
+			if (format == TEXTURE_COMPRESSION_NONE)
+				std::memcpy((mipLevel.Data.data() + (layerSize * layer)), source, layerSize);
+			else
+				TextureCompressor::encodeLevel(source, mipWidth, mipHeight, format, (mipLevel.Data.data() + (layerSize * layer)));
+		}
+	}
+
+	return 0;
+}
+
+// BC1 (DXT1) - 4-COLOR MODE, ENDPOINTS ON THE PRINCIPAL AXIS + ONE LEAST-SQUARES REFIT
+void TextureCompressor::encodeBC1(const uint8_t* block, uint8_t* result)
+{
+	auto toRGB565 = [](const float* color) {
+		int r = glm::clamp((int)std::round(color[0] * 31.0f / 255.0f), 0, 31);
+		int g = glm::clamp((int)std::round(color[1] * 63.0f / 255.0f), 0, 63);
+		int b = glm::clamp((int)std::round(color[2] * 31.0f / 255.0f), 0, 31);
+
+		return (uint16_t)((r << 11) | (g << 5) | b);
+	};
+
+	auto fromRGB565 = [](uint16_t color, float* rgb) {
+		int r = ((color >> 11) & 0x1F);
+		int g = ((color >> 5)  & 0x3F);
+		int b = (color & 0x1F);
+
+		rgb[0] = (float)((r << 3) | (r >> 2));
+		rgb[1] = (float)((g << 2) | (g >> 4));
+		rgb[2] = (float)((b << 3) | (b >> 2));
+	};
+
+	// PALETTE: 0 = C0, 1 = C1, 2 = 2/3 C0 + 1/3 C1, 3 = 1/3 C0 + 2/3 C1
+	auto fit = [&block, &fromRGB565](uint16_t &c0, uint16_t &c1, uint32_t &indices) {
+		if (c0 < c1)
+			std::swap(c0, c1);
+
+		float palette[4][3];
+
+		fromRGB565(c0, palette[0]);
+		fromRGB565(c1, palette[1]);
+
+		for (int c = 0; c < 3; c++) {
+			palette[2][c] = ((2.0f * palette[0][c] + palette[1][c]) / 3.0f);
+			palette[3][c] = ((palette[0][c] + 2.0f * palette[1][c]) / 3.0f);
+		}
+
+		float error = 0.0f;
+
+		indices = 0;
+
+		for (int i = 0; i < 16; i++)
+		{
+			float bestError = FLT_MAX;
+			int   bestIndex = 0;
+
+			// EQUAL ENDPOINTS SELECT THE 3-COLOR MODE, WHERE ONLY INDEX 0 IS SAFE
+			for (int p = 0; p < (c0 == c1 ? 1 : 4); p++)
+			{
+				float dr = (palette[p][0] - block[i * 4 + 0]);
+				float dg = (palette[p][1] - block[i * 4 + 1]);
+				float db = (palette[p][2] - block[i * 4 + 2]);
+				float e  = (dr * dr + dg * dg + db * db);
+
+				if (e < bestError) {
+					bestError = e;
+					bestIndex = p;
+				}
+			}
+
+			indices |= ((uint32_t)bestIndex << (i * 2));
+			error   += bestError;
+		}
+
+		return error;
+	};
+
+	float points[16 * 4];
+
+	for (int i = 0; i < 16; i++) {
+		for (int c = 0; c < 4; c++)
+			points[i * 4 + c] = (c < 3 ? (float)block[i * 4 + c] : 0.0f);
+	}
+
+	float axis[4];
+	float mean[4];
+
+	TextureCompressor::principalAxis(points, 3, mean, axis);
+
+	float minProjection = FLT_MAX;
+	float maxProjection = -FLT_MAX;
+
+	for (int i = 0; i < 16; i++)
+	{
+		float projection = 0.0f;
+
+		for (int c = 0; c < 3; c++)
+			projection += ((points[i * 4 + c] - mean[c]) * axis[c]);
+
+		minProjection = std::min(minProjection, projection);
+		maxProjection = std::max(maxProjection, projection);
+	}
+
+	// INSET THE ENDPOINTS SLIGHTLY, THE EXTREMES ARE RARELY WORTH A FULL PALETTE ENTRY
+	float inset = ((maxProjection - minProjection) / 16.0f);
+	float max[3], min[3];
+
+	for (int c = 0; c < 3; c++) {
+		max[c] = (mean[c] + axis[c] * (maxProjection - inset));
+		min[c] = (mean[c] + axis[c] * (minProjection + inset));
+	}
+
+	uint16_t c0      = toRGB565(max);
+	uint16_t c1      = toRGB565(min);
+	uint32_t indices = 0;
+	float    error   = fit(c0, c1, indices);
+
+	// LEAST-SQUARES REFIT OF THE ENDPOINTS FOR THE CHOSEN INDICES
+	if ((c0 != c1) && (error > 0.0f))
+	{
+		const float WEIGHTS[4] = { 1.0f, 0.0f, (2.0f / 3.0f), (1.0f / 3.0f) };
+
+		float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f;
+		float alphaX[3] = {}, betaX[3] = {};
+
+		for (int i = 0; i < 16; i++)
+		{
+			float a = WEIGHTS[(indices >> (i * 2)) & 0x3];
+			float b = (1.0f - a);
+
+			alpha2    += (a * a);
+			beta2     += (b * b);
+			alphaBeta += (a * b);
+
+			for (int c = 0; c < 3; c++) {
+				alphaX[c] += (a * block[i * 4 + c]);
+				betaX[c]  += (b * block[i * 4 + c]);
+			}
+		}
+
+		float denominator = (alpha2 * beta2 - alphaBeta * alphaBeta);
+
+		if (std::abs(denominator) > 1e-6f)
+		{
+			float refit0[3], refit1[3];
+
+			for (int c = 0; c < 3; c++) {
+				refit0[c] = ((alphaX[c] * beta2  - betaX[c]  * alphaBeta) / denominator);
+				refit1[c] = ((betaX[c]  * alpha2 - alphaX[c] * alphaBeta) / denominator);
+			}
+
+			uint16_t refitC0      = toRGB565(refit0);
+			uint16_t refitC1      = toRGB565(refit1);
+			uint32_t refitIndices = 0;
+			float    refitError   = fit(refitC0, refitC1, refitIndices);
+
+			if (refitError < error) {
+				c0      = refitC0;
+				c1      = refitC1;
+				indices = refitIndices;
+			}
+		}
+	}
+
+	result[0] = (uint8_t)(c0 & 0xFF);
+	result[1] = (uint8_t)(c0 >> 8);
+	result[2] = (uint8_t)(c1 & 0xFF);
+	result[3] = (uint8_t)(c1 >> 8);
+
+	for (int i = 0; i < 4; i++)
+		result[4 + i] = (uint8_t)((indices >> (i * 8)) & 0xFF);
+}
+
+// BC3 (DXT5) - BC4 ALPHA BLOCK + BC1 COLOR BLOCK
+void TextureCompressor::encodeBC3(const uint8_t* block, uint8_t* result)
+{
+	uint8_t alpha[16];
+
+	for (int i = 0; i < 16; i++)
+		alpha[i] = block[i * 4 + 3];
+
+	TextureCompressor::encodeBC4(alpha, result);
+	TextureCompressor::encodeBC1(block, (result + 8));
+}
+
+// BC4 - 8-VALUE MODE BETWEEN THE MIN AND MAX VALUE
+void TextureCompressor::encodeBC4(const uint8_t* values, uint8_t* result)
+{
+	int min = 255;
+	int max = 0;
+
+	for (int i = 0; i < 16; i++) {
+		min = std::min(min, (int)values[i]);
+		max = std::max(max, (int)values[i]);
+	}
+
+	result[0] = (uint8_t)max;
+	result[1] = (uint8_t)min;
+
+	int palette[8] = { max, min };
+
+	for (int i = 2; i < 8; i++)
+		palette[i] = (((8 - i) * max + (i - 1) * min + 3) / 7);
+
+	uint64_t indices = 0;
+
+	for (int i = 0; (i < 16) && (max > min); i++)
+	{
+		int bestError = INT_MAX;
+		int bestIndex = 0;
+
+		for (int p = 0; p < 8; p++)
+		{
+			int error = std::abs(palette[p] - (int)values[i]);
+
+			if (error < bestError) {
+				bestError = error;
+				bestIndex = p;
+			}
+		}
+
+		indices |= ((uint64_t)bestIndex << (i * 3));
+	}
+
+	for (int i = 0; i < 6; i++)
+		result[2 + i] = (uint8_t)((indices >> (i * 8)) & 0xFF);
+}
+
+// BC5 - TWO BC4 BLOCKS (RED, GREEN)
+void TextureCompressor::encodeBC5(const uint8_t* block, uint8_t* result)
+{
+	uint8_t red[16];
+	uint8_t green[16];
+
+	for (int i = 0; i < 16; i++) {
+		red[i]   = block[i * 4 + 0];
+		green[i] = block[i * 4 + 1];
+	}
+
+	TextureCompressor::encodeBC4(red,   result);
+	TextureCompressor::encodeBC4(green, (result + 8));
+}
+
+// BC7 MODE 6 - ONE SUBSET, RGBA 7.7.7.7 ENDPOINTS + P-BIT, 4-BIT INDICES
+void TextureCompressor::encodeBC7(const uint8_t* block, uint8_t* result)
+{
+	float points[16 * 4];
+
+	for (int i = 0; i < 64; i++)
+		points[i] = (float)block[i];
+
+	float axis[4];
+	float mean[4];
+
+	TextureCompressor::principalAxis(points, 4, mean, axis);
+
+	float minProjection = FLT_MAX;
+	float maxProjection = -FLT_MAX;
+
+	for (int i = 0; i < 16; i++)
+	{
+		float projection = 0.0f;
+
+		for (int c = 0; c < 4; c++)
+			projection += ((points[i * 4 + c] - mean[c]) * axis[c]);
+
+		minProjection = std::min(minProjection, projection);
+		maxProjection = std::max(maxProjection, projection);
+	}
+
+	// QUANTIZE EACH ENDPOINT TO 7 BITS + THE P-BIT WITH THE LOWEST ERROR
+	int endpoints[2][4];
+	int pBits[2];
+
+	for (int e = 0; e < 2; e++)
+	{
+		float projection = (e == 0 ? minProjection : maxProjection);
+		float bestError  = FLT_MAX;
+
+		for (int p = 0; p < 2; p++)
+		{
+			int   quantized[4];
+			float error = 0.0f;
+
+			for (int c = 0; c < 4; c++)
+			{
+				float value = glm::clamp((mean[c] + axis[c] * projection), 0.0f, 255.0f);
+
+				quantized[c] = glm::clamp((int)std::round((value - (float)p) / 2.0f), 0, 127);
+
+				float decoded = (float)((quantized[c] << 1) | p);
+
+				error += ((decoded - value) * (decoded - value));
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				pBits[e]  = p;
+
+				for (int c = 0; c < 4; c++)
+					endpoints[e][c] = quantized[c];
+			}
+		}
+	}
+
+	int decoded[2][4];
+
+	for (int e = 0; e < 2; e++) {
+		for (int c = 0; c < 4; c++)
+			decoded[e][c] = ((endpoints[e][c] << 1) | pBits[e]);
+	}
+
+	int indices[16];
+
+	for (int i = 0; i < 16; i++)
+	{
+		int bestError = INT_MAX;
+
+		for (int w = 0; w < 16; w++)
+		{
+			int error = 0;
+
+			for (int c = 0; c < 4; c++) {
+				int value = ((((64 - BC7_WEIGHTS[w]) * decoded[0][c]) + (BC7_WEIGHTS[w] * decoded[1][c]) + 32) >> 6);
+				error += ((value - block[i * 4 + c]) * (value - block[i * 4 + c]));
+			}
+
+			if (error < bestError) {
+				bestError  = error;
+				indices[i] = w;
+			}
+		}
+	}
+
+	// THE ANCHOR INDEX (PIXEL 0) IS STORED WITHOUT ITS MSB
+	if (indices[0] & 0x8)
+	{
+		std::swap(endpoints[0], endpoints[1]);
+		std::swap(pBits[0], pBits[1]);
+
+		for (int i = 0; i < 16; i++)
+			indices[i] = (15 - indices[i]);
+	}
+
+	uint64_t bits[2] = {};
+	int      offset  = 0;
+
+	auto write = [&bits, &offset](uint64_t value, int count) {
+		for (int i = 0; i < count; i++, offset++) {
+			if ((value >> i) & 0x1)
+				bits[offset / 64] |= (1ULL << (offset % 64));
+		}
+	};
+
+	write(0x40, 7);	// MODE 6
+
+	for (int c = 0; c < 4; c++) {
+		write(endpoints[0][c], 7);
+		write(endpoints[1][c], 7);
+	}
+
+	write(pBits[0], 1);
+	write(pBits[1], 1);
+
+	for (int i = 0; i < 16; i++)
+		write(indices[i], (i == 0 ? 3 : 4));
+
+	for (int i = 0; i < 16; i++)
+		result[i] = (uint8_t)((bits[i / 8] >> ((i % 8) * 8)) & 0xFF);
+}
+
+// ETC2 EAC ALPHA - BASE + MULTIPLIER * MODIFIER TABLE, 3-BIT INDICES (BIG-ENDIAN, COLUMN-MAJOR)
+void TextureCompressor::encodeEAC(const uint8_t* values, uint8_t* result)
+{
+	int min = 255;
+	int max = 0;
+
+	for (int i = 0; i < 16; i++) {
+		min = std::min(min, (int)values[i]);
+		max = std::max(max, (int)values[i]);
+	}
+
+	int      bestError      = INT_MAX;
+	int      bestBase       = min;
+	int      bestMultiplier = 1;
+	int      bestTable      = 13;
+	uint64_t bestIndices    = 0;
+
+	for (int t = 0; (t < 16) && (bestError > 0); t++)
+	{
+		int range      = (EAC_MODIFIERS[t][7] - EAC_MODIFIERS[t][3]);
+		int multiplier = glm::clamp((((max - min) + range - 1) / range), 1, 15);
+
+		for (int m = std::max((multiplier - 1), 1); m <= std::min((multiplier + 1), 15); m++)
+		{
+			int      base    = glm::clamp((min - EAC_MODIFIERS[t][3] * m), 0, 255);
+			int      error   = 0;
+			uint64_t indices = 0;
+
+			for (int i = 0; i < 16; i++)
+			{
+				// PIXEL ORDER IS COLUMN-MAJOR
+				int x         = (i % 4);
+				int y         = (i / 4);
+				int value     = values[i];
+				int bestPixel = INT_MAX;
+				int bestIndex = 0;
+
+				for (int p = 0; p < 8; p++)
+				{
+					int decoded = glm::clamp((base + EAC_MODIFIERS[t][p] * m), 0, 255);
+					int e       = ((decoded - value) * (decoded - value));
+
+					if (e < bestPixel) {
+						bestPixel = e;
+						bestIndex = p;
+					}
+				}
+
+				error   += bestPixel;
+				indices |= ((uint64_t)bestIndex << (45 - (x * 4 + y) * 3));
+			}
+
+			if (error < bestError) {
+				bestError      = error;
+				bestBase       = base;
+				bestMultiplier = m;
+				bestTable      = t;
+				bestIndices    = indices;
+			}
+		}
+	}
+
+	result[0] = (uint8_t)bestBase;
+	result[1] = (uint8_t)((bestMultiplier << 4) | bestTable);
+
+	for (int i = 0; i < 6; i++)
+		result[2 + i] = (uint8_t)((bestIndices >> ((5 - i) * 8)) & 0xFF);
+}
+
+// ETC2 RGB - ETC1-COMPATIBLE INDIVIDUAL/DIFFERENTIAL MODES, BEST OF BOTH SUB-BLOCK ORIENTATIONS
+void TextureCompressor::encodeETC2(const uint8_t* block, uint8_t* result)
+{
+	int      bestError = INT_MAX;
+	uint64_t bestBlock = 0;
+
+	for (int flip = 0; flip < 2; flip++)
+	{
+		// FLIP 0: TWO 2x4 SUB-BLOCKS SIDE BY SIDE, FLIP 1: TWO 4x2 SUB-BLOCKS ON TOP OF EACH OTHER
+		auto subBlock = [flip](int x, int y) { return (flip == 0 ? (x >= 2 ? 1 : 0) : (y >= 2 ? 1 : 0)); };
+
+		float average[2][3] = {};
+
+		for (int i = 0; i < 16; i++) {
+			for (int c = 0; c < 3; c++)
+				average[subBlock(i % 4, i / 4)][c] += (block[i * 4 + c] / 8.0f);
+		}
+
+		int  quantized[2][3];
+		int  base[2][3];
+		bool differential = true;
+
+		for (int s = 0; s < 2; s++) {
+			for (int c = 0; c < 3; c++)
+				quantized[s][c] = glm::clamp((int)std::round(average[s][c] * 31.0f / 255.0f), 0, 31);
+		}
+
+		for (int c = 0; c < 3; c++) {
+			int delta = (quantized[1][c] - quantized[0][c]);
+
+			if ((delta < -4) || (delta > 3))
+				differential = false;
+		}
+
+		for (int s = 0; s < 2; s++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				if (!differential)
+					quantized[s][c] = glm::clamp((int)std::round(average[s][c] * 15.0f / 255.0f), 0, 15);
+
+				base[s][c] = (differential ? ((quantized[s][c] << 3) | (quantized[s][c] >> 2)) : ((quantized[s][c] << 4) | quantized[s][c]));
+			}
+		}
+
+		int      error      = 0;
+		int      tables[2]  = {};
+		uint32_t indicesMSB = 0;
+		uint32_t indicesLSB = 0;
+
+		for (int s = 0; s < 2; s++)
+		{
+			int      bestSubError = INT_MAX;
+			uint32_t bestMSB      = 0;
+			uint32_t bestLSB      = 0;
+
+			for (int t = 0; t < 8; t++)
+			{
+				int      subError = 0;
+				uint32_t msb      = 0;
+				uint32_t lsb      = 0;
+
+				for (int i = 0; i < 16; i++)
+				{
+					int x = (i % 4);
+					int y = (i / 4);
+
+					if (subBlock(x, y) != s)
+						continue;
+
+					int bestPixel = INT_MAX;
+					int bestIndex = 0;
+
+					for (int p = 0; p < 4; p++)
+					{
+						int e = 0;
+
+						for (int c = 0; c < 3; c++) {
+							int decoded = glm::clamp((base[s][c] + ETC_MODIFIERS[t][p]), 0, 255);
+							e += ((decoded - block[i * 4 + c]) * (decoded - block[i * 4 + c]));
+						}
+
+						if (e < bestPixel) {
+							bestPixel = e;
+							bestIndex = p;
+						}
+					}
+
+					int bit = (x * 4 + y);
+
+					subError += bestPixel;
+					msb      |= ((uint32_t)(bestIndex >> 1)  << bit);
+					lsb      |= ((uint32_t)(bestIndex & 0x1) << bit);
+				}
+
+				if (subError < bestSubError) {
+					bestSubError = subError;
+					bestMSB      = msb;
+					bestLSB      = lsb;
+					tables[s]    = t;
+				}
+			}
+
+			error      += bestSubError;
+			indicesMSB |= bestMSB;
+			indicesLSB |= bestLSB;
+		}
+
+		if (error >= bestError)
+			continue;
+
+		uint64_t bits = 0;
+
+		for (int c = 0; c < 3; c++)
+		{
+			int shift = (59 - c * 8);
+
+			if (differential) {
+				bits |= ((uint64_t)quantized[0][c] << shift);
+				bits |= ((uint64_t)((quantized[1][c] - quantized[0][c]) & 0x7) << (shift - 3));
+			} else {
+				bits |= ((uint64_t)quantized[0][c] << (shift + 1));
+				bits |= ((uint64_t)quantized[1][c] << (shift - 3));
+			}
+		}
+
+		bits |= ((uint64_t)tables[0] << 37);
+		bits |= ((uint64_t)tables[1] << 34);
+		bits |= ((uint64_t)(differential ? 1 : 0) << 33);
+		bits |= ((uint64_t)flip << 32);
+		bits |= ((uint64_t)(indicesMSB & 0xFFFF) << 16);
+		bits |= (uint64_t)(indicesLSB & 0xFFFF);
+
+		bestError = error;
+		bestBlock = bits;
+	}
+
+	for (int i = 0; i < 8; i++)
+		result[i] = (uint8_t)((bestBlock >> ((7 - i) * 8)) & 0xFF);
+}
+
+// THE BLOCK ROWS ARE SPREAD OVER THE JOB SYSTEM, EDGE BLOCKS REPEAT THE LAST ROW/COLUMN
+void TextureCompressor::encodeLevel(const uint8_t* pixels, int width, int height, TextureCompression format, uint8_t* result)
+{
+	int      blocksX    = ((width  + 3) / 4);
+	int      blocksY    = ((height + 3) / 4);
+	uint32_t blockBytes = TextureCompressor::BlockBytes(format);
+
+	JobSystem::ParallelFor((size_t)blocksY, 1, [pixels, width, height, format, result, blocksX, blockBytes](size_t begin, size_t end)
+	{
+		uint8_t block[64];
+
+		for (size_t by = begin; by < end; by++)
+		{
+			for (int bx = 0; bx < blocksX; bx++)
+			{
+				for (int y = 0; y < 4; y++)
+				{
+					int sourceY = std::min(((int)by * 4 + y), (height - 1));
+
+					for (int x = 0; x < 4; x++) {
+						int sourceX = std::min((bx * 4 + x), (width - 1));
+						std::memcpy(&block[(y * 4 + x) * 4], &pixels[(sourceY * width + sourceX) * 4], 4);
+					}
+				}
+
+				uint8_t* output = (result + ((by * blocksX + bx) * blockBytes));
+
+				switch (format) {
+				case TEXTURE_COMPRESSION_BC1:
+					TextureCompressor::encodeBC1(block, output);
+					break;
+				case TEXTURE_COMPRESSION_BC3:
+					TextureCompressor::encodeBC3(block, output);
+					break;
+				case TEXTURE_COMPRESSION_BC5:
+					TextureCompressor::encodeBC5(block, output);
+					break;
+				case TEXTURE_COMPRESSION_BC7:
+					TextureCompressor::encodeBC7(block, output);
+					break;
+				case TEXTURE_COMPRESSION_ETC2_RGB:
+					TextureCompressor::encodeETC2(block, output);
+					break;
+				case TEXTURE_COMPRESSION_ETC2_RGBA:
+				{
+					uint8_t alpha[16];
+
+					for (int i = 0; i < 16; i++)
+						alpha[i] = block[i * 4 + 3];
+
+					TextureCompressor::encodeEAC(alpha, output);
+					TextureCompressor::encodeETC2(block, (output + 8));
+
+					break;
+				}
+				default:
+					throw;
+				}
+			}
+		}
+	});
+}
+
+// THE KTX2 CACHE AND THE DEVICE FORMATS ARE LEFT OUT OF THE CPU-ONLY BENCHMARK TARGET
+#if !defined S3DE_CPU_ONLY
+TextureCompression TextureCompressor::fromVkFormat(VkFormat format, bool &srgb)
+{
+	srgb = false;
+
+	switch (format) {
+		case VK_FORMAT_BC1_RGB_SRGB_BLOCK:         srgb = true; return TEXTURE_COMPRESSION_BC1;
+		case VK_FORMAT_BC1_RGB_UNORM_BLOCK:        return TEXTURE_COMPRESSION_BC1;
+		case VK_FORMAT_BC3_SRGB_BLOCK:             srgb = true; return TEXTURE_COMPRESSION_BC3;
+		case VK_FORMAT_BC3_UNORM_BLOCK:            return TEXTURE_COMPRESSION_BC3;
+		case VK_FORMAT_BC5_UNORM_BLOCK:            return TEXTURE_COMPRESSION_BC5;
+		case VK_FORMAT_BC7_SRGB_BLOCK:             srgb = true; return TEXTURE_COMPRESSION_BC7;
+		case VK_FORMAT_BC7_UNORM_BLOCK:            return TEXTURE_COMPRESSION_BC7;
+		case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:     srgb = true; return TEXTURE_COMPRESSION_ETC2_RGB;
+		case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:    return TEXTURE_COMPRESSION_ETC2_RGB;
+		case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:   srgb = true; return TEXTURE_COMPRESSION_ETC2_RGBA;
+		case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:  return TEXTURE_COMPRESSION_ETC2_RGBA;
+		default: break;
+	}
+
+	return TEXTURE_COMPRESSION_NONE;
+}
+
+wxString TextureCompressor::getCacheFile(const std::vector<wxString> &imageFiles, bool srgb, bool flipY)
+{
+	wxString family = (TextureCompressor::GetFormat(false) == TEXTURE_COMPRESSION_ETC2_RGB ? "etc2" : "bc");
+
+	return wxString::Format(
+		"%s.%s%s%s%s.ktx2", imageFiles[0], (imageFiles.size() > 1 ? "cube." : ""), family, (srgb ? ".srgb" : ""), (flipY ? ".flip" : "")
+	);
+}
+
+// THE CACHED FILE IS STALE WHEN ANY SOURCE FILE CHANGED SIZE OR MODIFICATION TIME
+std::string TextureCompressor::getCacheSource(const std::vector<wxString> &imageFiles, bool flipY)
+{
+	std::string source = wxString::Format("v%u;flip=%d;", KTX2_CACHE_VERSION, (int)flipY).ToStdString();
+
+	for (const auto &file : imageFiles)
+	{
+		if (!wxFileExists(file))
+			return "";
+
+		source.append(wxString::Format(
+			"%lld:%llu;", (long long)wxFileModificationTime(file), (unsigned long long)wxFileName::GetSize(file).GetValue()
+		).ToStdString());
+	}
+
+	return source;
+}
+
+// PREFERS BC7 FOR ALPHA AND BC1 FOR OPAQUE IMAGES, ETC2 ONLY WHEN THE DEVICE HAS NO BC SUPPORT
+TextureCompression TextureCompressor::GetFormat(bool alpha)
+{
+	if (!TextureCompressor::Enabled)
+		return TEXTURE_COMPRESSION_NONE;
+
+	std::vector<TextureCompression> formats;
+
+	if (alpha)
+		formats = { TEXTURE_COMPRESSION_BC7, TEXTURE_COMPRESSION_BC3, TEXTURE_COMPRESSION_ETC2_RGBA };
+	else
+		formats = { TEXTURE_COMPRESSION_BC1, TEXTURE_COMPRESSION_ETC2_RGB };
+
+	for (auto format : formats) {
+		if (TextureCompressor::isSupported(format))
+			return format;
+	}
+
+	return TEXTURE_COMPRESSION_NONE;
+}
+#endif
+
+bool TextureCompressor::HasAlpha(const uint8_t* pixels, int width, int height)
+{
+	if (pixels == nullptr)
+		return false;
+
+	size_t size = ((size_t)width * (size_t)height * 4);
+
+	for (size_t i = 3; i < size; i += 4) {
+		if (pixels[i] < 0xFF)
+			return true;
+	}
+
+	return false;
+}
+
+#if !defined S3DE_CPU_ONLY
+bool TextureCompressor::isSupported(TextureCompression format)
+{
+	switch (RenderEngine::SelectedGraphicsAPI) {
+	case GRAPHICS_API_OPENGL:
+		switch (format) {
+			case TEXTURE_COMPRESSION_BC1:
+			case TEXTURE_COMPRESSION_BC3:       return (GLEW_EXT_texture_compression_s3tc && GLEW_EXT_texture_sRGB);
+			case TEXTURE_COMPRESSION_BC5:       return (GLEW_VERSION_3_0 || GLEW_ARB_texture_compression_rgtc);
+			case TEXTURE_COMPRESSION_BC7:       return (GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc);
+			case TEXTURE_COMPRESSION_ETC2_RGB:
+			case TEXTURE_COMPRESSION_ETC2_RGBA: return (GLEW_VERSION_4_3 || GLEW_ARB_ES3_compatibility);
+			default: break;
+		}
+
+		break;
+	case GRAPHICS_API_VULKAN:
+		if ((format == TEXTURE_COMPRESSION_NONE) || (RenderEngine::Canvas.VK == nullptr))
+			return false;
+
+		return (
+			RenderEngine::Canvas.VK->IsFormatSupported(TextureCompressor::ToVkFormat(format, false)) &&
+			RenderEngine::Canvas.VK->IsFormatSupported(TextureCompressor::ToVkFormat(format, true))
+		);
+	default:
+		break;
+	}
+
+	return false;
+}
+
+int TextureCompressor::LoadCache(const std::vector<wxString> &imageFiles, bool srgb, bool flipY, CompressedImage &result)
+{
+	if (imageFiles.empty() || (TextureCompressor::GetFormat(false) == TEXTURE_COMPRESSION_NONE))
+		return -1;
+
+	wxString file   = TextureCompressor::getCacheFile(imageFiles, srgb, flipY);
+	wxString source = TextureCompressor::getCacheSource(imageFiles, flipY);
+
+	if (source.empty() || !wxFileExists(file))
+		return -2;
+
+	std::ifstream        fileStream(file.wc_str(), std::ios::binary);
+	std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+
+	if ((buffer.size() < KTX2_HEADER_SIZE) || (std::memcmp(buffer.data(), KTX2_ID, sizeof(KTX2_ID)) != 0))
+		return -3;
+
+	auto read32 = [&buffer](size_t offset) { uint32_t value; std::memcpy(&value, &buffer[offset], sizeof(value)); return value; };
+	auto read64 = [&buffer](size_t offset) { uint64_t value; std::memcpy(&value, &buffer[offset], sizeof(value)); return value; };
+
+	bool               formatSRGB = false;
+	TextureCompression format     = TextureCompressor::fromVkFormat((VkFormat)read32(12), formatSRGB);
+	int                width      = (int)read32(20);
+	int                height     = (int)read32(24);
+	uint32_t           faces      = read32(36);
+	uint32_t           levels     = read32(40);
+	uint32_t           kvdOffset  = read32(56);
+	uint32_t           kvdLength  = read32(60);
+
+	if ((format == TEXTURE_COMPRESSION_NONE) || (formatSRGB != srgb) || !TextureCompressor::isSupported(format))
+		return -4;
+
+	if ((width < 1) || (height < 1) || (faces != (uint32_t)imageFiles.size()) || (levels < 1) || (read32(44) != 0))
+		return -5;
+
+	if (((KTX2_HEADER_SIZE + levels * KTX2_LEVEL_SIZE) > buffer.size()) || (((size_t)kvdOffset + (size_t)kvdLength) > buffer.size()))
+		return -6;
+
+	// KEY/VALUE DATA - THE SOURCE STAMP MUST MATCH THE CURRENT SOURCE FILES
+	std::string cachedSource = "";
+
+	for (size_t offset = kvdOffset; (offset + 4) <= ((size_t)kvdOffset + (size_t)kvdLength);)
+	{
+		uint32_t length = read32(offset);
+
+		if ((offset + 4 + length) > buffer.size())
+			break;
+
+		std::string entry(reinterpret_cast<const char*>(&buffer[offset + 4]), length);
+		size_t      split = entry.find('\0');
+
+		if ((split != std::string::npos) && (entry.substr(0, split) == "S3DEsource"))
+			cachedSource = entry.substr((split + 1), (entry.size() - split - 2));
+
+		offset += (((4 + length) + 3) & ~(size_t)3);
+	}
+
+	if (cachedSource != source.ToStdString())
+		return -7;
+
+	result        = {};
+	result.Format = format;
+	result.Height = height;
+	result.Layers = (int)faces;
+	result.SRGB   = srgb;
+	result.Width  = width;
+
+	result.Levels.resize(levels);
+
+	for (uint32_t i = 0; i < levels; i++)
+	{
+		CompressedLevel &level  = result.Levels[i];
+		uint64_t         offset = read64(KTX2_HEADER_SIZE + i * KTX2_LEVEL_SIZE);
+		uint64_t         length = read64(KTX2_HEADER_SIZE + i * KTX2_LEVEL_SIZE + 8);
+
+		level.Width  = std::max((width  >> i), 1);
+		level.Height = std::max((height >> i), 1);
+
+		if ((length != TextureCompressor::TextureSize(format, level.Width, level.Height, faces, 1)) || ((offset + length) > buffer.size()))
+			return -8;
+
+		level.Data.assign((buffer.begin() + (size_t)offset), (buffer.begin() + (size_t)(offset + length)));
+	}
+
+	return 0;
+}
+#endif
+
+// POWER ITERATION ON THE COVARIANCE MATRIX OF 16 POINTS (STRIDE 4)
+void TextureCompressor::principalAxis(const float* points, int channels, float* mean, float* axis)
+{
+	float covariance[4][4] = {};
+
+	for (int c = 0; c < 4; c++)
+	{
+		mean[c] = 0.0f;
+		axis[c] = 0.0f;
+
+		for (int i = 0; (i < 16) && (c < channels); i++)
+			mean[c] += (points[i * 4 + c] / 16.0f);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		for (int a = 0; a < channels; a++) {
+			for (int b = 0; b < channels; b++)
+				covariance[a][b] += ((points[i * 4 + a] - mean[a]) * (points[i * 4 + b] - mean[b]));
+		}
+	}
+
+	for (int c = 0; c < channels; c++)
+		axis[c] = 1.0f;
+
+	for (int iteration = 0; iteration < 8; iteration++)
+	{
+		float next[4] = {};
+		float length  = 0.0f;
+
+		for (int a = 0; a < channels; a++) {
+			for (int b = 0; b < channels; b++)
+				next[a] += (covariance[a][b] * axis[b]);
+		}
+
+		for (int c = 0; c < channels; c++)
+			length += (next[c] * next[c]);
+
+		// A FLAT BLOCK HAS NO DOMINANT DIRECTION
+		if (length < 1e-12f)
+			break;
+
+		length = std::sqrt(length);
+
+		for (int c = 0; c < channels; c++)
+			axis[c] = (next[c] / length);
+	}
+
+	float length = 0.0f;
+
+	for (int c = 0; c < channels; c++)
+		length += (axis[c] * axis[c]);
+
+	length = std::sqrt(length);
+
+	for (int c = 0; c < channels; c++)
+		axis[c] = (length > 0.0f ? (axis[c] / length) : 0.0f);
+}
+
+#if !defined S3DE_CPU_ONLY
+// KTX2 - ONE BASIC DATA FORMAT DESCRIPTOR, THE SOURCE STAMP IN THE KEY/VALUE DATA, SMALLEST LEVEL FIRST
+int TextureCompressor::SaveCache(const std::vector<wxString> &imageFiles, bool flipY, const CompressedImage &image)
+{
+	if (imageFiles.empty() || image.Levels.empty() || (TextureCompressor::BlockBytes(image.Format) == 0))
+		return -1;
+
+	std::string source = TextureCompressor::getCacheSource(imageFiles, flipY);
+
+	if (source.empty())
+		return -2;
+
+	// DATA FORMAT DESCRIPTOR
+	const uint32_t LINEAR = (1u << 28);
+
+	uint32_t              alphaQualifiers = (image.SRGB ? LINEAR : 0);
+	uint32_t              colorModel;
+	std::vector<uint32_t> samples;
+
+	auto addSample = [&samples](uint32_t offset, uint32_t bits, uint32_t channel, uint32_t qualifiers) {
+		samples.insert(samples.end(), { (offset | ((bits - 1) << 16) | (channel << 24) | qualifiers), 0, 0, 0xFFFFFFFF });
+	};
+
+	switch (image.Format) {
+	case TEXTURE_COMPRESSION_BC1:
+		colorModel = 128;
+		addSample(0, 64, 0, 0);
+		break;
+	case TEXTURE_COMPRESSION_BC3:
+		colorModel = 130;
+		addSample(0,  64, 15, alphaQualifiers);
+		addSample(64, 64, 0,  0);
+		break;
+	case TEXTURE_COMPRESSION_BC5:
+		colorModel = 132;
+		addSample(0,  64, 0, 0);
+		addSample(64, 64, 1, 0);
+		break;
+	case TEXTURE_COMPRESSION_BC7:
+		colorModel = 134;
+		addSample(0, 128, 0, 0);
+		break;
+	case TEXTURE_COMPRESSION_ETC2_RGB:
+		colorModel = 161;
+		addSample(0, 64, 2, 0);
+		break;
+	case TEXTURE_COMPRESSION_ETC2_RGBA:
+		colorModel = 161;
+		addSample(0,  64, 15, alphaQualifiers);
+		addSample(64, 64, 2,  0);
+		break;
+	default:
+		throw;
+	}
+
+	uint32_t              blockSize = (24 + (uint32_t)samples.size() * 4);
+	std::vector<uint32_t> dfd       = {
+		(4 + blockSize),
+		0,
+		(2 | (blockSize << 16)),
+		(colorModel | (1 << 8) | ((image.SRGB ? 2 : 1) << 16)),
+		(3 | (3 << 8)),
+		TextureCompressor::BlockBytes(image.Format),
+		0
+	};
+
+	dfd.insert(dfd.end(), samples.begin(), samples.end());
+
+	// KEY/VALUE DATA
+	std::vector<uint8_t> kvd;
+
+	auto addKeyValue = [&kvd](const std::string &key, const std::string &value) {
+		uint32_t length = (uint32_t)(key.size() + 1 + value.size() + 1);
+
+		kvd.insert(kvd.end(), reinterpret_cast<const uint8_t*>(&length), (reinterpret_cast<const uint8_t*>(&length) + sizeof(length)));
+		kvd.insert(kvd.end(), key.begin(), key.end());
+		kvd.push_back(0);
+		kvd.insert(kvd.end(), value.begin(), value.end());
+		kvd.push_back(0);
+
+		while (kvd.size() % 4 != 0)
+			kvd.push_back(0);
+	};
+
+	addKeyValue("KTXwriter",  wxString(Utils::APP_NAME).append(" ").append(Utils::APP_VERSION).ToStdString());
+	addKeyValue("S3DEsource", source);
+
+	// LAYOUT
+	uint32_t              levels    = (uint32_t)image.Levels.size();
+	uint32_t              dfdOffset = (uint32_t)(KTX2_HEADER_SIZE + levels * KTX2_LEVEL_SIZE);
+	uint32_t              kvdOffset = (dfdOffset + (uint32_t)dfd.size() * 4);
+	uint64_t              offset    = (kvdOffset + kvd.size());
+	std::vector<uint64_t> offsets(levels);
+
+	for (int i = (int)levels - 1; i >= 0; i--) {
+		offset     = ((offset + 15) & ~(uint64_t)15);
+		offsets[i] = offset;
+		offset    += image.Levels[i].Data.size();
+	}
+
+	std::vector<uint8_t> buffer;
+
+	buffer.reserve((size_t)offset);
+
+	auto write32 = [&buffer](uint32_t value) { buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&value), (reinterpret_cast<uint8_t*>(&value) + sizeof(value))); };
+	auto write64 = [&buffer](uint64_t value) { buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&value), (reinterpret_cast<uint8_t*>(&value) + sizeof(value))); };
+
+	buffer.insert(buffer.end(), KTX2_ID, (KTX2_ID + sizeof(KTX2_ID)));
+
+	write32((uint32_t)TextureCompressor::ToVkFormat(image.Format, image.SRGB));
+	write32(1);
+	write32((uint32_t)image.Width);
+	write32((uint32_t)image.Height);
+	write32(0);
+	write32(0);
+	write32((uint32_t)image.Layers);
+	write32(levels);
+	write32(0);
+
+	write32(dfdOffset);
+	write32((uint32_t)dfd.size() * 4);
+	write32(kvdOffset);
+	write32((uint32_t)kvd.size());
+	write64(0);
+	write64(0);
+
+	for (uint32_t i = 0; i < levels; i++) {
+		write64(offsets[i]);
+		write64(image.Levels[i].Data.size());
+		write64(image.Levels[i].Data.size());
+	}
+
+	for (auto value : dfd)
+		write32(value);
+
+	buffer.insert(buffer.end(), kvd.begin(), kvd.end());
+
+	for (int i = (int)levels - 1; i >= 0; i--) {
+		buffer.resize((size_t)offsets[i], 0);
+		buffer.insert(buffer.end(), image.Levels[i].Data.begin(), image.Levels[i].Data.end());
+	}
+
+	std::ofstream fileStream(TextureCompressor::getCacheFile(imageFiles, image.SRGB, flipY).wc_str(), std::ios::binary);
+
+	if (!fileStream.good())
+		return -3;
+
+	fileStream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+	return (fileStream.good() ? 0 : -4);
+}
+#endif
+
+uint64_t TextureCompressor::TextureSize(TextureCompression format, int width, int height, uint32_t layers, uint32_t mipLevels)
+{
+	uint64_t blockBytes = TextureCompressor::BlockBytes(format);
+	uint64_t bytes      = 0;
+
+	for (uint32_t i = 0; i < std::max(mipLevels, 1u); i++)
+	{
+		if (format == TEXTURE_COMPRESSION_NONE)
+			bytes += ((uint64_t)width * (uint64_t)height * 4);
+		else
+			bytes += ((uint64_t)((width + 3) / 4) * (uint64_t)((height + 3) / 4) * blockBytes);
+
+		width  = std::max((width  / 2), 1);
+		height = std::max((height / 2), 1);
+	}
+
+	return (bytes * layers);
+}
+
+#if !defined S3DE_CPU_ONLY
+GLenum TextureCompressor::ToGLFormat(TextureCompression format, bool srgb)
+{
+	switch (format) {
+		case TEXTURE_COMPRESSION_NONE:      return (srgb ? GL_SRGB8_ALPHA8                         : GL_RGBA8);
+		case TEXTURE_COMPRESSION_BC1:       return (srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT        : GL_COMPRESSED_RGB_S3TC_DXT1_EXT);
+		case TEXTURE_COMPRESSION_BC3:       return (srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT  : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+		case TEXTURE_COMPRESSION_BC5:       return GL_COMPRESSED_RG_RGTC2;
+		case TEXTURE_COMPRESSION_BC7:       return (srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM     : GL_COMPRESSED_RGBA_BPTC_UNORM);
+		case TEXTURE_COMPRESSION_ETC2_RGB:  return (srgb ? GL_COMPRESSED_SRGB8_ETC2                : GL_COMPRESSED_RGB8_ETC2);
+		case TEXTURE_COMPRESSION_ETC2_RGBA: return (srgb ? GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC     : GL_COMPRESSED_RGBA8_ETC2_EAC);
+		default: throw;
+	}
+
+	return 0;
+}
+
+VkFormat TextureCompressor::ToVkFormat(TextureCompression format, bool srgb)
+{
+	switch (format) {
+		case TEXTURE_COMPRESSION_NONE:      return (srgb ? VK_FORMAT_R8G8B8A8_SRGB            : VK_FORMAT_R8G8B8A8_UNORM);
+		case TEXTURE_COMPRESSION_BC1:       return (srgb ? VK_FORMAT_BC1_RGB_SRGB_BLOCK       : VK_FORMAT_BC1_RGB_UNORM_BLOCK);
+		case TEXTURE_COMPRESSION_BC3:       return (srgb ? VK_FORMAT_BC3_SRGB_BLOCK           : VK_FORMAT_BC3_UNORM_BLOCK);
+		case TEXTURE_COMPRESSION_BC5:       return VK_FORMAT_BC5_UNORM_BLOCK;
+		case TEXTURE_COMPRESSION_BC7:       return (srgb ? VK_FORMAT_BC7_SRGB_BLOCK           : VK_FORMAT_BC7_UNORM_BLOCK);
+		case TEXTURE_COMPRESSION_ETC2_RGB:  return (srgb ? VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK   : VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK);
+		case TEXTURE_COMPRESSION_ETC2_RGBA: return (srgb ? VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK : VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK);
+		default: throw;
+	}
+
+	return VK_FORMAT_UNDEFINED;
+}
+#endif
@@ -0,0 +1,74 @@
+#ifndef S3DE_GLOBALS_H
+	#include "../globals.h"
+#endif
+
+#ifndef S3DE_TEXTURECOMPRESSOR_H
+#define S3DE_TEXTURECOMPRESSOR_H
+
+struct CompressedLevel
+{
+	std::vector<uint8_t> Data;	// ALL LAYERS (CUBEMAP FACES) OF THE LEVEL
+	int                  Height = 0;
+	int                  Width  = 0;
+};
+
+// TEXTURE_COMPRESSION_NONE HOLDS RGBA8 LEVELS
+struct CompressedImage
+{
+	TextureCompression           Format = TEXTURE_COMPRESSION_NONE;
+	int                          Height = 0;
+	int                          Layers = 0;
+	std::vector<CompressedLevel> Levels;
+	bool                         SRGB   = false;
+	int                          Width  = 0;
+
+	bool     HasAlpha() const;
+	uint64_t Size()     const;
+};
+
+// BLOCK COMPRESSES RGBA8 IMAGES (BC1/BC3/BC5/BC7 OR ETC2) ON THE JOB SYSTEM,
+// AND KEEPS THE RESULT IN A KTX2 FILE NEXT TO THE SOURCE IMAGE.
+class TextureCompressor
+{
+private:
+	TextureCompressor()  {}
+	~TextureCompressor() {}
+
+public:
+	static bool Enabled;
+
+public:
+	static uint32_t           BlockBytes(TextureCompression format);
+	static int                Compress(const std::vector<uint8_t*> &pixels, int width, int height, TextureCompression format, bool srgb, bool mipmaps, CompressedImage &result);
+	static bool               HasAlpha(const uint8_t* pixels, int width, int height);
+	static uint64_t           TextureSize(TextureCompression format, int width, int height, uint32_t layers, uint32_t mipLevels);
+
+#if !defined S3DE_CPU_ONLY
+	static TextureCompression GetFormat(bool alpha);
+	static int                LoadCache(const std::vector<wxString> &imageFiles, bool srgb, bool flipY, CompressedImage &result);
+	static int                SaveCache(const std::vector<wxString> &imageFiles, bool flipY, const CompressedImage &image);
+	static GLenum             ToGLFormat(TextureCompression format, bool srgb);
+	static VkFormat           ToVkFormat(TextureCompression format, bool srgb);
+#endif
+
+private:
+	static void               encodeBC1(const uint8_t* block, uint8_t* result);
+	static void               encodeBC3(const uint8_t* block, uint8_t* result);
+	static void               encodeBC4(const uint8_t* values, uint8_t* result);
+	static void               encodeBC5(const uint8_t* block, uint8_t* result);
+	static void               encodeBC7(const uint8_t* block, uint8_t* result);
+	static void               encodeEAC(const uint8_t* values, uint8_t* result);
+	static void               encodeETC2(const uint8_t* block, uint8_t* result);
+	static void               encodeLevel(const uint8_t* pixels, int width, int height, TextureCompression format, uint8_t* result);
+	static void               principalAxis(const float* points, int channels, float* mean, float* axis);
+
+#if !defined S3DE_CPU_ONLY
+	static TextureCompression fromVkFormat(VkFormat format, bool &srgb);
+	static wxString           getCacheFile(const std::vector<wxString> &imageFiles, bool srgb, bool flipY);
+	static std::string        getCacheSource(const std::vector<wxString> &imageFiles, bool flipY);
+	static bool               isSupported(TextureCompression format);
+#endif
+
+};
+
+#endif
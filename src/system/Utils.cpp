@@ -313,6 +313,7 @@ wxString Utils::GetGraphicsAPI(GraphicsAPI api)
 		#endif
 		case GRAPHICS_API_OPENGL:    return "OpenGL";
 		case GRAPHICS_API_VULKAN:    return "Vulkan";
+		case GRAPHICS_API_NULL:      return "Null";
 		default: throw;
 	}
 
@@ -390,6 +391,8 @@ wxImage* Utils::LoadImageFile(const wxString &file, wxBitmapType type)
 
 std::vector<AssImpMesh*> Utils::LoadModelFile(const wxString &file)
 {
+	PROFILE_SCOPE("Utils::LoadModelFile");
+
 	std::vector<AssImpMesh*> meshes;
 	const aiScene*           scene = aiImportFile(file.c_str(), (aiProcess_Triangulate | aiProcess_GenNormals | aiProcess_ImproveCacheLocality | aiProcess_OptimizeMeshes));
 
@@ -466,6 +469,9 @@ std::vector<AssImpMesh*> Utils::LoadModelFile(const wxString &file)
 
 std::vector<Component*> Utils::LoadModelFile(const wxString &file, Component* parent)
 {
+	if (Primitives::GetType(file) != ID_ICON_UNKNOWN)
+		return Primitives::Load(file, parent);
+
 	std::vector<Component*>  children;
 	Mesh*                    mesh;
 	std::vector<AssImpMesh*> aiMeshes = Utils::LoadModelFile(file);
@@ -592,7 +598,7 @@ int Utils::SaveTextToFile(const wxString &text, const wxString &file)
 		return -1;
 	}
 
-	fileStream << file.wc_str();
+	fileStream << text.wc_str();
 	fileStream.close();
 
 	return 0;
@@ -660,27 +666,6 @@ json11::Json::array Utils::ToJsonArray(const glm::vec4 &arr)
 	return jsonArray;
 }
 
-uint8_t* Utils::ToRGBA(const wxImage &image)
-{
-	int      size  = (image.GetWidth() * image.GetHeight() * 4);
-	uint8_t* rgb   = image.GetData();
-	uint8_t* alpha = image.GetAlpha();
-	uint8_t* rgba  = (uint8_t*)std::malloc(size);
-
-	if ((rgb == nullptr) || (rgba == nullptr))
-		return nullptr;
-
-	for (int i = 0, r = 0, a = 0; i < size; i += 4, r += 3, a++)
-	{
-		rgba[i + 0] = rgb[r + 0];
-		rgba[i + 1] = rgb[r + 1];
-		rgba[i + 2] = rgb[r + 2];
-		rgba[i + 3] = (alpha != nullptr ? alpha[a] : 0xFF);
-	}
-
-	return rgba;
-}
-
 std::string Utils::ToString(const std::vector<uint8_t> &data)
 {
 	if (data.empty())
@@ -87,7 +87,6 @@ public:
 	static json11::Json::array      ToJsonArray(const glm::vec2 &arr);
 	static json11::Json::array      ToJsonArray(const glm::vec3 &arr);
 	static json11::Json::array      ToJsonArray(const glm::vec4 &arr);
-	static uint8_t*                 ToRGBA(const wxImage &image);
 	static std::string              ToString(const std::vector<uint8_t> &data);
 	static glm::vec2                ToVec2(const json11::Json::array &jsonArray);
 	static glm::vec3                ToVec3(const json11::Json::array &jsonArray);
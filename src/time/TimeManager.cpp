@@ -1,30 +1,78 @@
 #include "TimeManager.h"
 
-double      TimeManager::DeltaTime = 0.0;
-int         TimeManager::FPS       = 0;
-wxStopWatch TimeManager::deltaTimer;
-wxStopWatch TimeManager::totalTimer;
+double                                TimeManager::DeltaTime      = (1.0 / 60.0);
+double                                TimeManager::FixedDeltaTime = (1.0 / 60.0);
+int                                   TimeManager::FPS            = 0;
+double                                TimeManager::Interpolation  = 0.0;
+bool                                  TimeManager::LockStep       = false;
+int                                   TimeManager::MaxSteps       = 5;
+uint64_t                              TimeManager::Steps          = 0;
+uint64_t                              TimeManager::StepsDropped   = 0;
+double                                TimeManager::accumulator    = 0.0;
+std::chrono::steady_clock::time_point TimeManager::fpsTime;
+std::chrono::steady_clock::time_point TimeManager::frameTime;
+std::chrono::steady_clock::time_point TimeManager::startTime;
 
 void TimeManager::Start()
 {
-	TimeManager::DeltaTime = (1.0 / 60.0);
-	TimeManager::FPS       = 0;
+	TimeManager::accumulator   = 0.0;
+	TimeManager::DeltaTime     = TimeManager::FixedDeltaTime;
+	TimeManager::FPS           = 0;
+	TimeManager::Interpolation = 0.0;
 
-	TimeManager::deltaTimer.Start();
-	TimeManager::totalTimer.Start();
+	TimeManager::startTime = std::chrono::steady_clock::now();
+	TimeManager::fpsTime   = TimeManager::startTime;
+	TimeManager::frameTime = TimeManager::startTime;
+}
+
+// RUNS ONE FIXED SIMULATION STEP PER CALL UNTIL THE ACCUMULATED FRAME TIME HAS BEEN CONSUMED
+bool TimeManager::Step()
+{
+	if (TimeManager::accumulator < TimeManager::FixedDeltaTime) {
+		TimeManager::Interpolation = (TimeManager::accumulator / TimeManager::FixedDeltaTime);
+		return false;
+	}
+
+	TimeManager::accumulator -= TimeManager::FixedDeltaTime;
+	TimeManager::Steps++;
+
+	return true;
 }
 
 long TimeManager::TimeElapsedMS()
 {
-	return totalTimer.Time();
+	return (long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - TimeManager::startTime).count();
+}
+
+void TimeManager::Update()
+{
+	auto now = std::chrono::steady_clock::now();
+
+	// LOCK-STEP - EXACTLY ONE SIMULATION STEP PER FRAME, INDEPENDENT OF THE WALL CLOCK
+	if (TimeManager::LockStep)
+		TimeManager::DeltaTime = TimeManager::FixedDeltaTime;
+	else
+		TimeManager::DeltaTime = std::chrono::duration<double>(now - TimeManager::frameTime).count();
+
+	TimeManager::frameTime    = now;
+	TimeManager::accumulator += TimeManager::DeltaTime;
+
+	// SPIRAL OF DEATH - DROP THE SIMULATION TIME THAT CAN NOT BE CAUGHT UP
+	double maxTime = ((double)std::max(TimeManager::MaxSteps, 1) * TimeManager::FixedDeltaTime);
+
+	if (TimeManager::accumulator > maxTime) {
+		TimeManager::StepsDropped += (uint64_t)((TimeManager::accumulator - maxTime) / TimeManager::FixedDeltaTime);
+		TimeManager::accumulator   = maxTime;
+	}
 }
 
 void TimeManager::UpdateFPS()
 {
-	if (TimeManager::deltaTimer.Time() >= 1000)
+	auto now = std::chrono::steady_clock::now();
+
+	if (std::chrono::duration_cast<std::chrono::milliseconds>(now - TimeManager::fpsTime).count() >= 1000)
 	{
-		TimeManager::DeltaTime = (1.0 / (double)TimeManager::FPS);
-		Time              time = Time(totalTimer.Time());
+		Time time = Time(TimeManager::TimeElapsedMS());
 
 		std::swprintf(
 			RenderEngine::Canvas.Window->Title,
@@ -42,8 +90,8 @@ void TimeManager::UpdateFPS()
 
 		RenderEngine::Canvas.Window->SetTitle(RenderEngine::Canvas.Window->Title);
 
-		TimeManager::FPS = 0;
-		TimeManager::deltaTimer.Start();
+		TimeManager::FPS     = 0;
+		TimeManager::fpsTime = now;
 	}
 
 	TimeManager::FPS++;
@@ -12,16 +12,26 @@ private:
 	~TimeManager() {}
 
 public:
-	static double DeltaTime;
-	static int    FPS;
+	static double   DeltaTime;
+	static double   FixedDeltaTime;
+	static int      FPS;
+	static double   Interpolation;
+	static bool     LockStep;
+	static int      MaxSteps;
+	static uint64_t Steps;
+	static uint64_t StepsDropped;
 
 private:
-	static wxStopWatch deltaTimer;
-	static wxStopWatch totalTimer;
+	static double                                accumulator;
+	static std::chrono::steady_clock::time_point fpsTime;
+	static std::chrono::steady_clock::time_point frameTime;
+	static std::chrono::steady_clock::time_point startTime;
 
 public:
 	static void Start();
+	static bool Step();
 	static long TimeElapsedMS();
+	static void Update();
 	static void UpdateFPS();
 
 };
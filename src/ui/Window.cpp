@@ -4,21 +4,95 @@ void Window::GameLoop(wxIdleEvent &event)
 {
 	if (RenderEngine::Ready)
 	{
+		PROFILE_SCOPE("Window::GameLoop");
+
 		event.RequestMore();
 
+		if (this->decodeBenchmark) {
+			this->decodeBenchmark = false;
+			this->runDecodeBenchmark();
+		}
+
+		if (this->jobBenchmark) {
+			this->jobBenchmark = false;
+			this->runJobBenchmark();
+		}
+
+		if (this->shaderBenchmark) {
+			this->shaderBenchmark = false;
+			this->runShaderBenchmark();
+		}
+
+		if (this->stressScene) {
+			this->stressScene = false;
+			this->runStressScene();
+		}
+
+		if (this->terrainFlyThrough) {
+			this->terrainFlyThrough = false;
+			this->runTerrainFlyThrough();
+		}
+
+		InputRecorder::Update();
+
 		TimeManager::UpdateFPS();
-		PhysicsEngine::Update();
-		RenderEngine::Draw();
+		TimeManager::Update();
+
+		while (TimeManager::Step())
+			PhysicsEngine::Update();
+
+		TerrainStreamer::Update();
+		TextureStreamer::Update();
+
+		if (RenderThread::IsRunning())
+			RenderThread::Publish();
+		else
+			RenderEngine::Draw();
+
+		GPUTimer::UpdateOverlay();
+		MemoryTracker::Update();
+
+		if ((this->gpuTimerFrames > 0) && (--this->gpuTimerFrames == 0))
+			this->saveGPUTimers();
+
+		if ((this->profileFrames > 0) && (--this->profileFrames == 0))
+			this->saveProfile();
+
+		if ((this->renderStatsFrames > 0) && (--this->renderStatsFrames == 0))
+			this->saveRenderStats();
+
+		if ((this->screenshotFrames > 0) && (--this->screenshotFrames == 0))
+			this->saveScreenshot();
+
+		if (!this->replayInput.empty() && !InputRecorder::IsReplaying())
+			this->saveReplay();
+
+		// HEADLESS RUNS EXIT AS SOON AS ALL THE REQUESTED RESULTS HAVE BEEN SAVED
+		if (Headless::Enabled && (this->gpuTimerFrames == 0) && (this->profileFrames == 0) && (this->renderStatsFrames == 0) && (this->screenshotFrames == 0) && this->replayInput.empty() && !this->frame->IsBeingDeleted())
+			this->frame->Close(true);
 	}
 }
 
 int Window::OnExit()
 {
+	RenderThread::Stop();
+	InputRecorder::Stop();
+
+	if (this->memoryLog)
+		Utils::SaveTextToFile(MemoryTracker::ToJSON().dump(), "memory.json");
+
 	RenderEngine::Ready         = false;
 	RenderEngine::Canvas.Canvas = nullptr;
 	RenderEngine::Canvas.Window = nullptr;
 
+	if (TextureStreamer::Enabled)
+		Utils::SaveTextToFile(TextureStreamer::ToJSON().dump(), "texture-streaming.json");
+
+	TextureStreamer::Close();
 	RenderEngine::Close();
+	GlyphAtlas::Close();
+	ImageDecoder::Close();
+	JobSystem::Close();
 
 	return 0;
 }
@@ -28,11 +102,114 @@ bool Window::OnInit()
 	// IMAGE HANDLERS
 	wxInitAllImageHandlers();
 
+	// COMMAND LINE
+	this->decodeBenchmark    = false;
+	this->gpuTimerFrames     = 0;
+	this->jobBenchmark       = false;
+	this->memoryLog          = false;
+	this->profileFrames      = 0;
+	this->recordInput        = "";
+	this->renderStatsFrames  = 0;
+	this->renderThread       = false;
+	this->replayInput        = "";
+	this->screenshotFile     = "";
+	this->screenshotFrames   = 0;
+	this->shaderBenchmark    = false;
+	this->stressFrames       = 0;
+	this->stressLights       = 8;
+	this->stressModels       = 200;
+	this->stressScene        = false;
+	this->stressSeed         = 1;
+	this->terrainFlyThrough  = false;
+
+	for (int i = 1; i < this->argc; i++) {
+		if (this->argv[i] == "--decode-benchmark")
+			this->decodeBenchmark = true;
+		else if (this->argv[i] == "--gpu-timers")
+			this->gpuTimerFrames = 600;
+		else if (this->argv[i] == "--headless")
+			Headless::Enabled = true;
+		else if (this->argv[i] == "--job-benchmark")
+			this->jobBenchmark = true;
+		else if (this->argv[i] == "--memory-log")
+			this->memoryLog = true;
+		else if (this->argv[i] == "--no-texture-compression")
+			TextureCompressor::Enabled = false;
+		else if (this->argv[i] == "--null-renderer")
+			RenderEngine::SelectedGraphicsAPI = GRAPHICS_API_NULL;
+		else if (this->argv[i] == "--profile")
+			this->profileFrames = 600;
+		else if (this->argv[i].StartsWith("--record-input="))
+			this->recordInput = this->argv[i].AfterFirst('=');
+		else if (this->argv[i] == "--render-stats")
+			this->renderStatsFrames = 600;
+		else if (this->argv[i] == "--render-thread")
+			this->renderThread = true;
+		else if (this->argv[i].StartsWith("--replay-input="))
+			this->replayInput = this->argv[i].AfterFirst('=');
+		else if (this->argv[i].StartsWith("--screenshot=")) {
+			this->screenshotFile   = this->argv[i].AfterFirst('=');
+			this->screenshotFrames = 60;
+		}
+		else if (this->argv[i] == "--shader-benchmark")
+			this->shaderBenchmark = true;
+		else if (this->argv[i].StartsWith("--shadow-cascades="))
+			ShadowCascades::Count = glm::clamp(wxAtoi(this->argv[i].AfterFirst('=')), 1, (int)MAX_SHADOW_CASCADES);
+		else if (this->argv[i].StartsWith("--shadow-caster-distance=")) {
+			double distance = 0.0;
+
+			if (this->argv[i].AfterFirst('=').ToDouble(&distance) && (distance >= 0.0))
+				ShadowCascades::CasterDistance = (float)distance;
+		}
+		else if (this->argv[i].StartsWith("--shadow-distance=")) {
+			double distance = 0.0;
+
+			if (this->argv[i].AfterFirst('=').ToDouble(&distance) && (distance > 0.0))
+				ShadowCascades::Distance = (float)distance;
+		}
+		else if (this->argv[i].StartsWith("--shadow-split-lambda=")) {
+			double lambda = 0.0;
+
+			if (this->argv[i].AfterFirst('=').ToDouble(&lambda))
+				ShadowCascades::Lambda = glm::clamp((float)lambda, 0.0f, 1.0f);
+		}
+		else if (this->argv[i].StartsWith("--stress-benchmark")) {
+			this->stressFrames = (this->argv[i].Contains("=") ? wxAtoi(this->argv[i].AfterFirst('=')) : 1000);
+			this->stressScene  = true;
+		}
+		else if (this->argv[i] == "--stress-scene")
+			this->stressScene = true;
+		else if (this->argv[i].StartsWith("--stress-models="))
+			this->stressModels = wxAtoi(this->argv[i].AfterFirst('='));
+		else if (this->argv[i].StartsWith("--stress-lights="))
+			this->stressLights = wxAtoi(this->argv[i].AfterFirst('='));
+		else if (this->argv[i].StartsWith("--stress-seed="))
+			this->stressSeed = (uint32_t)wxAtol(this->argv[i].AfterFirst('='));
+		else if (this->argv[i] == "--terrain-flythrough")
+			this->terrainFlyThrough = true;
+		else if (this->argv[i].StartsWith("--texture-budget=")) {
+			TextureStreamer::Budget  = ((uint64_t)std::max(wxAtol(this->argv[i].AfterFirst('=')), 1L) * 1024 * 1024);
+			TextureStreamer::Enabled = true;
+		}
+		else if (this->argv[i] == "--texture-streaming")
+			TextureStreamer::Enabled = true;
+	}
+
+	// THE HEADLESS CONTEXT BELONGS TO THE MAIN THREAD, AND THE NULL BACKEND HAS NO CONTEXT TO SHARE
+	if (Headless::Enabled || (RenderEngine::SelectedGraphicsAPI == GRAPHICS_API_NULL))
+		this->renderThread = false;
+
+	// PROFILER
+	PROFILE_THREAD("Main");
+
+	// JOB SYSTEM
+	JobSystem::Init();
+
 	// WINDOW
 	wxString title = wxString(Utils::APP_NAME).append(" ").append(Utils::APP_VERSION);
 
 	this->frame = new WindowFrame(title, wxDefaultPosition, Utils::UI_WINDOW_SIZE, this);
-	this->frame->Show(true);
+	this->frame->Show(!Headless::Enabled);
 	//this->frame->Maximize(true);
 
 	// RENDER ENGINE
@@ -79,11 +256,209 @@ bool Window::OnInit()
 		return false;
 	}
 
+	// RENDER THREAD
+	if (this->renderThread)
+	{
+		this->frame->SetStatusText("Starting the Render Thread ...");
+
+		result = RenderThread::Start();
+
+		if (result < 0) {
+			wxMessageBox(("ERROR: Failed to start the render thread: " + std::to_wstring(result)), this->frame->GetTitle().c_str(), wxOK | wxICON_ERROR);
+			this->frame->SetStatusText("Starting the Render Thread ... FAIL");
+		}
+	}
+
 	this->frame->SetStatusText(wxString("Successfully started ").append(Utils::APP_NAME));
 
 	// START GAME LOOP
+	if (this->profileFrames > 0)
+		Profiler::Start();
+
+	if (this->gpuTimerFrames > 0)
+		GPUTimer::Enabled = true;
+
+	if (this->renderStatsFrames > 0)
+		RenderStats::Reset();
+
+	if (this->memoryLog)
+		MemoryTracker::StartLog("memory-log.txt", 5000);
+
+	if (!this->recordInput.empty())
+		InputRecorder::Start(this->recordInput);
+	else if (!this->replayInput.empty() && (InputRecorder::Replay(this->replayInput) < 0))
+		this->replayInput = "";
+
 	TimeManager::Start();
 	this->Connect(wxEVT_IDLE, wxIdleEventHandler(Window::GameLoop));
 
 	return true;
 }
+
+// SIMD RGBA EXPANSION VS THE OLD MIRROR + INTERLEAVE, AND SERIAL VS PARALLEL FILE DECODING, ON 4K IMAGES
+void Window::runDecodeBenchmark()
+{
+	RenderEngine::Canvas.Window->SetStatusText("Running the image decode benchmark ...");
+
+	ImageDecodeBenchmark result = ImageDecoder::Benchmark();
+
+	if (result.Runs < 1) {
+		RenderEngine::Canvas.Window->SetStatusText("Running the image decode benchmark ... FAIL");
+		return;
+	}
+
+	Utils::SaveTextToFile(result.ToJSON().dump(), "decode-benchmark.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Running the image decode benchmark ... OK");
+}
+
+void Window::runJobBenchmark()
+{
+	RenderEngine::Canvas.Window->SetStatusText("Running the Job System benchmarks ...");
+
+	JobBenchmark result = JobSystem::Benchmark();
+
+	json11::Json resultJSON = json11::Json::object {
+		{ "threads",                 result.Threads },
+		{ "jobs",                    result.Jobs },
+		{ "throughput_jobs_per_sec", result.ThroughputJobsPerSec },
+		{ "latency_avg_us",          result.LatencyAvgUS },
+		{ "latency_max_us",          result.LatencyMaxUS },
+		{ "parallel_for_serial_ms",  result.ParallelForSerialMS },
+		{ "parallel_for_ms",         result.ParallelForMS },
+		{ "parallel_for_speedup",    result.ParallelForSpeedup }
+	};
+
+	Utils::SaveTextToFile(resultJSON.dump(), "job-benchmark.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Running the Job System benchmarks ... OK");
+}
+
+// RECOMPILES ALL THE SHADERS WITH AN EMPTY (COLD) AND A FILLED (WARM) PROGRAM BINARY CACHE
+void Window::runShaderBenchmark()
+{
+	RenderEngine::Canvas.Window->SetStatusText("Running the shader startup benchmark ...");
+
+	ShaderStartupBenchmark result = ShaderManager::Benchmark();
+
+	if (result.Runs < 1) {
+		RenderEngine::Canvas.Window->SetStatusText("Running the shader startup benchmark ... FAIL");
+		return;
+	}
+
+	Utils::SaveTextToFile(result.ToJSON().dump(), "shader-benchmark.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Running the shader startup benchmark ... OK");
+}
+
+void Window::runStressScene()
+{
+	wxString file = wxString::Format("stress-%d-%d-%u.scene", this->stressModels, this->stressLights, this->stressSeed);
+
+	if ((StressScene::Generate(file, this->stressModels, this->stressLights, this->stressSeed) < 0) || (SceneManager::LoadScene(file) < 0))
+		return;
+
+	if (this->stressFrames < 1)
+		return;
+
+	StressSceneBenchmark result = StressScene::FlyThrough(this->stressFrames, this->stressSeed);
+
+	Utils::SaveTextToFile(result.ToJSON().dump(), "stress-benchmark.json");
+}
+
+void Window::runTerrainFlyThrough()
+{
+	if (SceneManager::LoadTerrain(33, 1, 2.0f, true) == nullptr)
+		return;
+
+	TerrainFlyThrough    result = TerrainStreamer::FlyThrough(2000, 0.25f);
+	TerrainStreamerStats stats  = TerrainStreamer::Stats();
+
+	json11::Json resultJSON = json11::Json::object {
+		{ "frames",               result.Frames },
+		{ "frame_time_avg_ms",    result.FrameTimeAvgMS },
+		{ "frame_time_p50_ms",    result.FrameTimeP50MS },
+		{ "frame_time_p99_ms",    result.FrameTimeP99MS },
+		{ "frame_time_max_ms",    result.FrameTimeMaxMS },
+		{ "boundary_crossings",   result.BoundaryCrossings },
+		{ "crossing_time_max_ms", result.CrossingTimeMaxMS },
+		{ "spikes",               result.Spikes },
+		{ "tiles_generated",      (double)stats.TilesGenerated },
+		{ "tiles_uploaded",       (double)stats.TilesUploaded },
+		{ "tiles_evicted",        (double)stats.TilesEvicted },
+		{ "memory_peak",          (double)stats.MemoryUsagePeak }
+	};
+
+	Utils::SaveTextToFile(resultJSON.dump(), "terrain-flythrough.json");
+}
+
+void Window::saveGPUTimers()
+{
+	json11::Json::object passesJSON;
+
+	for (int i = 0; i < NR_OF_GPU_PASSES; i++)
+	{
+		GPUTimerStats stats = GPUTimer::Stats((GPUTimerPass)i);
+
+		passesJSON[GPUTimer::PassName((GPUTimerPass)i).Lower().ToStdString()] = json11::Json::object {
+			{ "samples", stats.Samples },
+			{ "avg_ms",  stats.AvgMS },
+			{ "last_ms", stats.LastMS },
+			{ "max_ms",  stats.MaxMS },
+			{ "p50_ms",  stats.P50MS },
+			{ "p95_ms",  stats.P95MS },
+			{ "p99_ms",  stats.P99MS }
+		};
+	}
+
+	json11::Json resultJSON = json11::Json::object {
+		{ "renderer",       RenderEngine::GPU.Renderer.ToStdString() },
+		{ "supported",      GPUTimer::IsSupported() },
+		{ "dropped_frames", (double)GPUTimer::DroppedFrames() },
+		{ "passes",         passesJSON }
+	};
+
+	Utils::SaveTextToFile(resultJSON.dump(), "gpu-timers.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Saved the GPU timers to gpu-timers.json");
+}
+
+void Window::saveProfile()
+{
+	Profiler::Stop();
+
+	Utils::SaveTextToFile(Profiler::ToJSON(), "profile-trace.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Saved the profiler trace to profile-trace.json");
+}
+
+void Window::saveRenderStats()
+{
+	Utils::SaveTextToFile(RenderStats::ToJSON().dump(), "render-stats.json");
+
+	// COMMAND COUNTS AND HASH OF THE LAST FRAME THE NULL BACKEND RECORDED
+	if (RenderEngine::Canvas.Null != nullptr)
+		Utils::SaveTextToFile(RenderEngine::Canvas.Null->ToJSON().dump(), "null-frame.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Saved the render statistics to render-stats.json");
+}
+
+void Window::saveReplay()
+{
+	Utils::SaveTextToFile(InputRecorder::ToJSON().dump(), "replay.json");
+
+	RenderEngine::Canvas.Window->SetStatusText("Saved the replay results to replay.json");
+
+	this->replayInput = "";
+}
+
+// ONLY THE HEADLESS OFFSCREEN TARGET CAN BE READ BACK
+void Window::saveScreenshot()
+{
+	if (Headless::SaveImage(this->screenshotFile) < 0) {
+		RenderEngine::Canvas.Window->SetStatusText("Failed to save the screenshot to " + this->screenshotFile);
+		return;
+	}
+
+	RenderEngine::Canvas.Window->SetStatusText("Saved the screenshot to " + this->screenshotFile);
+}
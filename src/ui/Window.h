@@ -8,12 +8,42 @@
 class Window : public wxApp
 {
 private:
+	bool         decodeBenchmark;
 	WindowFrame* frame;
+	int          gpuTimerFrames;
+	bool         jobBenchmark;
+	bool         memoryLog;
+	int          profileFrames;
+	wxString     recordInput;
+	int          renderStatsFrames;
+	bool         renderThread;
+	wxString     replayInput;
+	wxString     screenshotFile;
+	int          screenshotFrames;
+	bool         shaderBenchmark;
+	int          stressFrames;
+	int          stressLights;
+	int          stressModels;
+	bool         stressScene;
+	uint32_t     stressSeed;
+	bool         terrainFlyThrough;
 
 public:
 	void         GameLoop(wxIdleEvent &event);
 	virtual int  OnExit();
 	virtual bool OnInit();
+
+private:
+	void runDecodeBenchmark();
+	void runJobBenchmark();
+	void runShaderBenchmark();
+	void runStressScene();
+	void runTerrainFlyThrough();
+	void saveGPUTimers();
+	void saveProfile();
+	void saveRenderStats();
+	void saveReplay();
+	void saveScreenshot();
 };
 
 #endif
@@ -1,5 +1,10 @@
 #include "WindowFrame.h"
 
+wxBEGIN_EVENT_TABLE(WindowFrame, wxFrame)
+	EVT_MENU(wxID_ABOUT, WindowFrame::OnAbout)
+	EVT_MENU(wxID_EXIT,  WindowFrame::OnExit)
+wxEND_EVENT_TABLE()
+
 WindowFrame::WindowFrame(const wxString &title, const wxPoint &pos, const wxSize &size, Window* parent) : wxFrame(NULL, wxID_ANY, title, pos, size)
 {
 	this->Parent = parent;
@@ -316,6 +321,10 @@ int WindowFrame::init()
 	this->addTextLabel(sizerDropDowns, "V-sync:", wxGBPosition(1, column++), (wxALIGN_CENTER_VERTICAL | wxLEFT), 20);
 	this->VSyncEnable = this->addCheckBox(sizerDropDowns, ID_VSYNC, wxGBPosition(1, column++), true);
 
+	// GPU TIMERS
+	this->addTextLabel(sizerDropDowns, "GPU Timers:", wxGBPosition(1, column++), (wxALIGN_CENTER_VERTICAL | wxLEFT), 20);
+	this->addCheckBox(sizerDropDowns,  ID_GPU_TIMERS, wxGBPosition(1, column++));
+
 	sizer->Add(sizerDropDowns, 0, wxBOTTOM, 10);
 
 	// MIDDLE
@@ -437,7 +446,7 @@ int WindowFrame::InitProperties()
 
 			// AUTO-ROTATE
 			glm::vec3 autoRotation = selected->AutoRotation;
-			this->addPropertyXYZ("Auto-Rotate (rad)", Utils::PROPERTY_IDS[PROPERTY_ID_AUTO_ROTATION], autoRotation[0], autoRotation[1], autoRotation[2], -glm::pi<float>(), glm::pi<float>(), 0.01f);
+			this->addPropertyXYZ("Auto-Rotate (rad/s)", Utils::PROPERTY_IDS[PROPERTY_ID_AUTO_ROTATION], autoRotation[0], autoRotation[1], autoRotation[2], -glm::pi<float>(), glm::pi<float>(), 0.01f);
 			this->addPropertyCheckbox("Enable", Utils::PROPERTY_IDS[PROPERTY_ID_ENABLE_AUTO_ROTATION], selected->AutoRotate);
 			
 			// MATERIAL
@@ -586,7 +595,7 @@ void WindowFrame::initPropertiesTextures(Component* selected)
 	{
 		this->properties->Append(new wxPropertyCategory("Texture"));
 
-		this->properties->Append(new wxImageFileProperty("Texture", Utils::PROPERTY_IDS[PROPERTY_ID_HUD_TEXTURE], selected->Textures[0]->ImageFile()));
+		this->properties->Append(new wxImageFileProperty("Texture", Utils::PROPERTY_IDS[PROPERTY_ID_HUD_TEXTURE], selected->TextureFiles[0]));
 		this->properties->SetPropertyAttribute(Utils::PROPERTY_IDS[PROPERTY_ID_HUD_TEXTURE], wxPG_FILE_WILDCARD, Utils::IMAGE_FILE_FORMATS);
 
 		this->addPropertyCheckbox(" Remove Texture", Utils::PROPERTY_IDS[PROPERTY_ID_HUD_REMOVE_TEXTURE], false);
@@ -610,19 +619,19 @@ void WindowFrame::initPropertiesTextures(Component* selected)
 			}
 			else if (selected->Type() == COMPONENT_TERRAIN)
 			{
-				if (selected->Textures[i]->ImageFile(0).empty())
+				if (selected->TextureFiles[i].empty())
 					continue;
 
 				label     = terrainLabels[i];
-				imageFile = selected->Textures[i]->ImageFile(0);
+				imageFile = selected->TextureFiles[i];
 			}
 			else if (selected->Type() == COMPONENT_WATER)
 			{
-				if (selected->Textures[i]->ImageFile(0).empty())
+				if (selected->TextureFiles[i].empty())
 					continue;
 
 				label     = waterLabels[i];
-				imageFile = selected->Textures[i]->ImageFile(0);
+				imageFile = selected->TextureFiles[i];
 			}
 			else
 			{
@@ -630,7 +639,7 @@ void WindowFrame::initPropertiesTextures(Component* selected)
 					continue;
 
 				label     = defaultLabels[i];
-				imageFile = selected->Textures[i]->ImageFile(0);
+				imageFile = selected->TextureFiles[i];
 			}
 
 			this->properties->Append(new wxImageFileProperty(label, wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TEXTURE_] + std::to_string(i)), imageFile));
@@ -643,8 +652,8 @@ void WindowFrame::initPropertiesTextures(Component* selected)
 				this->addPropertyCheckbox(" Repeat", wxString(Utils::PROPERTY_IDS[PROPERTY_ID_REPEAT_TEXTURE_] + std::to_string(i)), selected->Textures[i]->Repeat());
 			}
 
-			this->addPropertyRange(" Tiling U", wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_U_] + std::to_string(i)), selected->Textures[i]->Scale[0], 1.0f, 100.0f, 0.01f);
-			this->addPropertyRange(" Tiling V", wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_V_] + std::to_string(i)), selected->Textures[i]->Scale[1], 1.0f, 100.0f, 0.01f);
+			this->addPropertyRange(" Tiling U", wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_U_] + std::to_string(i)), selected->TextureScales[i][0], 1.0f, 100.0f, 0.01f);
+			this->addPropertyRange(" Tiling V", wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_V_] + std::to_string(i)), selected->TextureScales[i][1], 1.0f, 100.0f, 0.01f);
 		}
 	}
 }
@@ -762,6 +771,9 @@ int WindowFrame::UpdateComponents(wxPGProperty* property)
 	if (selected == nullptr)
 		return -1;
 
+	// THE RENDER THREAD READS THE TEXTURES, MATERIALS AND HUDS OF THE COMPONENTS
+	RenderThreadLock renderLock;
+
 	wxString propertyName      = property->GetName();
 	wxString propertyNameFirst = propertyName.substr(0, propertyName.size() - 1);
 	wxString propertyNameLast  = propertyName.substr(propertyName.size() - 1);
@@ -837,19 +849,19 @@ int WindowFrame::UpdateComponents(wxPGProperty* property)
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_AUTO_ROTATION_])
 		selected->AutoRotation = this->updatePropertyXYZ(propertyName, property->GetValue().GetDouble(), selected->AutoRotation);
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_FLIP_TEXTURE_])
-		dynamic_cast<Mesh*>(selected)->Textures[std::atoi(propertyNameLast.c_str().AsChar())]->SetFlipY(property->GetValue().GetBool());
+		dynamic_cast<Mesh*>(selected)->SetTextureFlipY(std::atoi(propertyNameLast.c_str().AsChar()), property->GetValue().GetBool());
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_LOCATION_])
 		selected->MoveTo(this->updatePropertyXYZ(propertyName, property->GetValue().GetDouble(), selected->Position()));
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_REMOVE_TEXTURE_])
 		dynamic_cast<Mesh*>(selected)->RemoveTexture(std::atoi(propertyNameLast.c_str().AsChar()));
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_REPEAT_TEXTURE_])
-		dynamic_cast<Mesh*>(selected)->Textures[std::atoi(propertyNameLast.c_str().AsChar())]->SetRepeat(property->GetValue().GetBool());
+		dynamic_cast<Mesh*>(selected)->SetTextureRepeat(std::atoi(propertyNameLast.c_str().AsChar()), property->GetValue().GetBool());
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_ROTATION_])
 		selected->RotateTo(this->updatePropertyXYZ(propertyName, property->GetValue().GetDouble(), selected->Rotation()));
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_TILING_U_])
-		dynamic_cast<Mesh*>(selected)->Textures[std::atoi(propertyNameLast.c_str().AsChar())]->Scale[0] = property->GetValue().GetDouble();
+		selected->TextureScales[std::atoi(propertyNameLast.c_str().AsChar())][0] = property->GetValue().GetDouble();
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_TILING_V_])
-		dynamic_cast<Mesh*>(selected)->Textures[std::atoi(propertyNameLast.c_str().AsChar())]->Scale[1] = property->GetValue().GetDouble();
+		selected->TextureScales[std::atoi(propertyNameLast.c_str().AsChar())][1] = property->GetValue().GetDouble();
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_SCALE_])
 		selected->ScaleTo(this->updatePropertyXYZ(propertyName, property->GetValue().GetDouble(), selected->Scale()));
 	else if (propertyNameFirst == Utils::PROPERTY_IDS[PROPERTY_ID_TEXTURE_])
@@ -949,7 +961,7 @@ int WindowFrame::UpdateProperties(bool autoRotate)
 		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_TEXT_FONT],          dynamic_cast<HUD*>(selected->Parent)->TextFont);
 		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_TEXT_SIZE],          dynamic_cast<HUD*>(selected->Parent)->TextSize);
 		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_TEXT_COLOR],         dynamic_cast<HUD*>(selected->Parent)->TextColor);
-		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_HUD_TEXTURE],        selected->Textures[0]->ImageFile());
+		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_HUD_TEXTURE],        selected->TextureFiles[0]);
 		this->properties->SetPropertyValue(Utils::PROPERTY_IDS[PROPERTY_ID_HUD_REMOVE_TEXTURE], false);
 	}
 	else
@@ -957,17 +969,17 @@ int WindowFrame::UpdateProperties(bool autoRotate)
 		for (int i = 0; i < MAX_TEXTURES; i++)
 		{
 			if (selected->Type() == COMPONENT_TERRAIN) {
-				if (selected->Textures[i]->ImageFile(0).empty())
+				if (selected->TextureFiles[i].empty())
 					continue;
 			} else if (selected->Type() == COMPONENT_WATER) {
-				if (selected->Textures[i]->ImageFile(0).empty())
+				if (selected->TextureFiles[i].empty())
 					continue;
 			} else {
 				if (i > 1)
 					continue;
 			}
 
-			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TEXTURE_]        + std::to_string(i)), selected->Textures[i]->ImageFile());
+			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TEXTURE_]        + std::to_string(i)), selected->TextureFiles[i]);
 			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_REMOVE_TEXTURE_] + std::to_string(i)), false);
 
 			if ((selected->Type() != COMPONENT_SKYBOX) && (selected->Type() != COMPONENT_TERRAIN) && (selected->Type() != COMPONENT_WATER)) {
@@ -975,8 +987,8 @@ int WindowFrame::UpdateProperties(bool autoRotate)
 				this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_REPEAT_TEXTURE_] + std::to_string(i)), selected->Textures[i]->Repeat());
 			}
 
-			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_U_] + std::to_string(i)), selected->Textures[i]->Scale[0]);
-			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_V_] + std::to_string(i)), selected->Textures[i]->Scale[1]);
+			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_U_] + std::to_string(i)), selected->TextureScales[i][0]);
+			this->properties->SetPropertyValue(wxString(Utils::PROPERTY_IDS[PROPERTY_ID_TILING_V_] + std::to_string(i)), selected->TextureScales[i][1]);
 		}
 	}
 